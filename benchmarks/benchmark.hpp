@@ -0,0 +1,221 @@
+/*
+
+File: benchmark.hpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+// Small timing and reporting helpers shared by the benchmark executables
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "allocationCounter.hpp"
+#include "perfCounters.hpp"
+
+class Stopwatch
+{
+public:
+
+    Stopwatch() : start(clock::now()) {}
+
+    void restart() { start = clock::now(); }
+
+    // Seconds since construction or the last restart
+    double elapsed() const
+    {
+        return std::chrono::duration<double>(clock::now() - start).count();
+    }
+
+private:
+
+    typedef std::chrono::steady_clock clock;
+
+    clock::time_point start;
+};
+
+// Keeps the optimizer from discarding a result that is otherwise unused
+template <typename T>
+inline void do_not_optimize(const T& value)
+{
+#if defined(__GNUC__)
+    asm volatile("" : : "g"(&value) : "memory");
+#else
+    static const volatile void* sink;
+    sink = &value;
+#endif
+}
+
+// Writes one comma separated row, no quoting is done on the fields
+template <typename Field>
+inline void csv_row(std::ostream& out, const Field& last)
+{
+    out << last << '\n';
+}
+
+template <typename Field, typename... Fields>
+inline void csv_row(std::ostream& out, const Field& first, const Fields&... rest)
+{
+    out << first << ',';
+    csv_row(out, rest...);
+}
+
+// Time, heap allocations and, when counters are given, hardware events over
+// one measured region. Allocations stay zero unless the program installed the
+// hooks of allocationCounter.hpp.
+struct sample
+{
+    explicit sample(PerfCounters* counters = nullptr)
+        : seconds(0), counters(counters), allocations() {}
+
+    double seconds;
+    PerfCounters* counters;
+    counter_values events;
+    allocation::counts allocations;
+};
+
+// Measures from construction until stop() into a sample
+class SampleTimer
+{
+public:
+
+    explicit SampleTimer(sample& out) : out(out)
+    {
+        if (out.counters != nullptr) { out.counters->start(); }
+        timer.restart();
+    }
+
+    void stop()
+    {
+        out.seconds = timer.elapsed();
+        out.allocations = allocations.delta();
+        if (out.counters != nullptr) { out.events = out.counters->stop(); }
+    }
+
+private:
+
+    sample& out;
+    allocation::Counter allocations;
+    Stopwatch timer;
+};
+
+// One timed run of one operation, ops counts the elements it processed
+struct benchmark_result
+{
+    std::string container;
+    std::string type;
+    std::string operation;
+    size_t size;
+    size_t repetition;
+    size_t ops;
+    double seconds;
+    counter_values events;
+    allocation::counts allocations;
+
+    double ns_per_op() const
+    {
+        return (ops == 0) ? 0 : seconds * 1e9 / ops;
+    }
+
+    // Negative when the event is unavailable
+    double per_op(counter_event event) const
+    {
+        return (ops == 0 || events.values[event] < 0) ? -1 : events.values[event] / ops;
+    }
+
+    double per_op(size_t allocation::counts::* field) const
+    {
+        return (ops == 0) ? 0 : double(allocations.*field) / ops;
+    }
+};
+
+struct report_columns
+{
+    bool counters;
+    bool allocations;
+};
+
+// With counters every row has one column per event, counted per op and left
+// empty where the event is unavailable. With allocations it ends in the
+// allocations, frees and bytes allocated per op.
+inline void write_csv_header(std::ostream& out, report_columns columns = report_columns())
+{
+    out << "container,type,operation,size,repetition,ops,seconds,ns_per_op";
+    for (int event = 0; columns.counters && event < counter_event_count; ++event)
+    {
+        out << ',' << counter_name(counter_event(event)) << "_per_op";
+    }
+    if (columns.allocations)
+    {
+        out << ",allocations_per_op,frees_per_op,bytes_per_op";
+    }
+    out << '\n';
+}
+
+inline void write_csv(std::ostream& out, const benchmark_result& result,
+                      report_columns columns = report_columns())
+{
+    out << result.container << ',' << result.type << ',' << result.operation << ','
+        << result.size << ',' << result.repetition << ',' << result.ops << ','
+        << result.seconds << ',' << result.ns_per_op();
+    for (int event = 0; columns.counters && event < counter_event_count; ++event)
+    {
+        out << ',';
+        double value = result.per_op(counter_event(event));
+        if (value >= 0) { out << value; }
+    }
+    if (columns.allocations)
+    {
+        out << ',' << result.per_op(&allocation::counts::allocations)
+            << ',' << result.per_op(&allocation::counts::frees)
+            << ',' << result.per_op(&allocation::counts::bytes);
+    }
+    out << '\n';
+}
+
+// The names written are plain identifiers and need no escaping. Events are
+// written only when counted, unavailable ones as null.
+inline void write_json(std::ostream& out, const std::vector<benchmark_result>& results,
+                       report_columns columns = report_columns())
+{
+    out << "[\n";
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const benchmark_result& result = results[i];
+        out << "  {\"container\": \"" << result.container
+            << "\", \"type\": \"" << result.type
+            << "\", \"operation\": \"" << result.operation
+            << "\", \"size\": " << result.size
+            << ", \"repetition\": " << result.repetition
+            << ", \"ops\": " << result.ops
+            << ", \"seconds\": " << result.seconds
+            << ", \"ns_per_op\": " << result.ns_per_op();
+        for (int event = 0; result.events.any() && event < counter_event_count; ++event)
+        {
+            out << ", \"" << counter_name(counter_event(event)) << "_per_op\": ";
+            double value = result.per_op(counter_event(event));
+            if (value >= 0) { out << value; } else { out << "null"; }
+        }
+        if (columns.allocations)
+        {
+            out << ", \"allocations_per_op\": " << result.per_op(&allocation::counts::allocations)
+                << ", \"frees_per_op\": " << result.per_op(&allocation::counts::frees)
+                << ", \"bytes_per_op\": " << result.per_op(&allocation::counts::bytes);
+        }
+        out << ((i + 1 < results.size()) ? "},\n" : "}\n");
+    }
+    out << "]\n";
+}
+
+#endif // BENCHMARK_H
@@ -0,0 +1,226 @@
+/*
+
+File: compactionBenchmark.cpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+Walks of a LinkedList<int> whose nodes are scattered over the heap, before
+and after LinkedList::compact(), at sizes of 1000, 100000 and 1000000
+elements. The list is scattered by sorting it on a scrambled key, which
+leaves every link pointing to an unrelated heap block the way long insert
+and erase churn does.
+
+    iterate/allocated    sum the elements of a list just filled by push_back
+    iterate/fragmented   sum the elements of the scattered list
+    iterate/compacted    sum them again after compact()
+    find_if/fragmented   find_if the last element of the scattered list
+    find_if/compacted    the same after compact()
+    compact              compact() the scattered list
+    compact_steps        compact(steps) the scattered list until it returns
+                         true
+
+ops is the number of elements an operation processed and ns_per_op the time
+per element. Every row ends in the heap allocations, frees and bytes per op.
+
+Usage: compactionBenchmark [--format=csv|json] [--repetitions=N]
+                           [--budget=N] [--steps=N] [--filter=TEXT]
+
+--budget bounds the elements walked per operation and repetition, --steps
+is the number of nodes compact_steps moves per call, 1024 by default.
+
+*/
+
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include "benchmark.hpp"
+#include "linkedList.hpp"
+
+// Counts the allocations of every measured region
+#define ALLOCATION_COUNTER_HOOKS
+#include "allocationCounter.hpp"
+
+struct options
+{
+    bool json;
+    size_t repetitions;
+    size_t budget;
+    size_t steps;
+    std::string filter;
+};
+
+/*****
+LISTS
+*****/
+
+LinkedList<int> allocated(size_t size)
+{
+    LinkedList<int> list;
+    for (size_t i = 0; i < size; ++i)
+    {
+        list.push_back(static_cast<int>(i));
+    }
+    return list;
+}
+
+LinkedList<int> fragmented(size_t size)
+{
+    LinkedList<int> list = allocated(size);
+
+    const long long scale = 7919;
+    const long long modulus = static_cast<long long>(size);
+    list.sort([scale, modulus](int lhs, int rhs)
+    {
+        return (lhs * scale) % modulus < (rhs * scale) % modulus;
+    });
+    return list;
+}
+
+/*****
+OPERATIONS
+*****/
+
+// Each walks the list calls times and returns the elements processed
+
+size_t iterate(LinkedList<int>& list, size_t size, size_t calls)
+{
+    long long sum = 0;
+    for (size_t i = 0; i < calls; ++i)
+    {
+        for (int value : list) { sum += value; }
+        do_not_optimize(sum);
+    }
+    return calls * size;
+}
+
+size_t find_last(LinkedList<int>& list, size_t size, size_t calls)
+{
+    int last = 0;
+    for (int value : list) { last = value; }
+
+    for (size_t i = 0; i < calls; ++i)
+    {
+        LinkedList<int>::iterator found = list.find_if([last](int value) { return value == last; });
+        do_not_optimize(found);
+    }
+    return calls * size;
+}
+
+/*****
+DRIVER
+*****/
+
+bool selected(const std::string& operation, const options& opts)
+{
+    return ("LinkedList/int/" + operation).find(opts.filter) != std::string::npos;
+}
+
+void record(const std::string& operation, size_t size, size_t repetition, size_t ops,
+            const sample& measured, std::vector<benchmark_result>& results)
+{
+    benchmark_result result = { "LinkedList", "int", operation, size, repetition,
+                                ops, measured.seconds, measured.events, measured.allocations };
+    results.push_back(result);
+}
+
+void run_walk(const std::string& operation, LinkedList<int>& list,
+              size_t (*walk)(LinkedList<int>&, size_t, size_t), size_t size, size_t repetition,
+              const options& opts, std::vector<benchmark_result>& results)
+{
+    if (!selected(operation, opts)) { return; }
+
+    const size_t calls = std::max<size_t>(1, opts.budget / size);
+
+    sample measured;
+    SampleTimer timer(measured);
+    size_t ops = walk(list, size, calls);
+    timer.stop();
+
+    record(operation, size, repetition, ops, measured, results);
+}
+
+void run_all(size_t size, const options& opts, std::vector<benchmark_result>& results)
+{
+    for (size_t repetition = 0; repetition < opts.repetitions; ++repetition)
+    {
+        LinkedList<int> fresh = allocated(size);
+        run_walk("iterate/allocated", fresh, iterate, size, repetition, opts, results);
+
+        LinkedList<int> list = fragmented(size);
+        run_walk("iterate/fragmented", list, iterate, size, repetition, opts, results);
+        run_walk("find_if/fragmented", list, find_last, size, repetition, opts, results);
+
+        if (selected("compact_steps", opts))
+        {
+            LinkedList<int> stepped = fragmented(size);
+
+            sample measured;
+            SampleTimer timer(measured);
+            while (!stepped.compact(opts.steps)) {}
+            timer.stop();
+
+            record("compact_steps", size, repetition, size, measured, results);
+        }
+
+        sample measured;
+        SampleTimer timer(measured);
+        list.compact();
+        timer.stop();
+
+        if (selected("compact", opts)) { record("compact", size, repetition, size, measured, results); }
+
+        run_walk("iterate/compacted", list, iterate, size, repetition, opts, results);
+        run_walk("find_if/compacted", list, find_last, size, repetition, opts, results);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    options opts = { false, 3, 10000000, 1024, "" };
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        std::string value = arg.substr(arg.find('=') + 1);
+
+        if (arg == "--format=json")                { opts.json = true; }
+        else if (arg == "--format=csv")            { opts.json = false; }
+        else if (arg.find("--repetitions=") == 0)  { opts.repetitions = std::strtoul(value.c_str(), nullptr, 10); }
+        else if (arg.find("--budget=") == 0)       { opts.budget = std::strtoul(value.c_str(), nullptr, 10); }
+        else if (arg.find("--steps=") == 0)        { opts.steps = std::strtoul(value.c_str(), nullptr, 10); }
+        else if (arg.find("--filter=") == 0)       { opts.filter = value; }
+        else
+        {
+            std::cerr << "usage: compactionBenchmark [--format=csv|json] [--repetitions=N]"
+                         " [--budget=N] [--steps=N] [--filter=TEXT]\n";
+            return (arg == "--help") ? 0 : 2;
+        }
+    }
+
+    std::vector<benchmark_result> results;
+    for (size_t size : { 1000, 100000, 1000000 })
+    {
+        run_all(size, opts, results);
+    }
+
+    report_columns columns = { false, true };
+    if (opts.json)
+    {
+        write_json(std::cout, results, columns);
+        return 0;
+    }
+
+    write_csv_header(std::cout, columns);
+    for (const benchmark_result& result : results)
+    {
+        write_csv(std::cout, result, columns);
+    }
+    return 0;
+}
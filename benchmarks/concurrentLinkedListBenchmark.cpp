@@ -0,0 +1,172 @@
+/*
+
+File: concurrentLinkedListBenchmark.cpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+Contention benchmark: every thread runs a mix of 80% find, 10% insert and 10%
+erase at random positions. ConcurrentLinkedList (lock coupling) is compared to
+a LinkedList guarded by a single mutex, varying list length and thread count.
+
+Usage: concurrentLinkedListBenchmark [max_threads] [ops_per_thread]
+
+*/
+
+#include <cstdlib>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+#include "benchmark.hpp"
+#include "linkedList.hpp"
+#include "concurrentLinkedList.hpp"
+
+// Coarse-grained baseline, one lock around the whole list
+class CoarseList
+{
+public:
+
+    explicit CoarseList(int length)
+    {
+        for (int i = 0; i < length; ++i)
+        {
+            list.push_back(i);
+        }
+    }
+
+    bool find(int key)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        return list.find(key) != list.end();
+    }
+
+    void insert(int key)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        LinkedList<int>::iterator it = list.find(key);
+        if (it != list.end())
+        {
+            list.insert(it, key);
+        }
+    }
+
+    void erase(int key)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        LinkedList<int>::iterator it = list.find(key);
+        if (it != list.end())
+        {
+            list.erase(it);
+        }
+    }
+
+private:
+
+    std::mutex lock;
+    LinkedList<int> list;
+};
+
+// Fine-grained list, iterators hold the locks of the window they point at
+class FineList
+{
+public:
+
+    explicit FineList(int length)
+    {
+        for (int i = length - 1; i >= 0; --i)
+        {
+            list.push_front(i);
+        }
+    }
+
+    bool find(int key)
+    {
+        return list.find(key) != list.end();
+    }
+
+    void insert(int key)
+    {
+        ConcurrentLinkedList<int>::iterator it = list.find(key);
+        if (it != list.end())
+        {
+            list.insert(it, key);
+        }
+    }
+
+    void erase(int key)
+    {
+        ConcurrentLinkedList<int>::iterator it = list.find(key);
+        if (it != list.end())
+        {
+            list.erase(it);
+        }
+    }
+
+private:
+
+    ConcurrentLinkedList<int> list;
+};
+
+template <typename List>
+double run(int length, int threads, int ops)
+{
+    List list(length);
+
+    std::vector<std::thread> workers;
+    Stopwatch timer;
+    for (int t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([&list, length, ops, t]()
+        {
+            std::mt19937 engine(t + 1);
+            std::uniform_int_distribution<int> keys(0, length - 1);
+            std::uniform_int_distribution<int> mix(0, 9);
+
+            bool found = false;
+            for (int i = 0; i < ops; ++i)
+            {
+                int key = keys(engine);
+                int op = mix(engine);
+
+                if (op == 0)      { list.insert(key); }
+                else if (op == 1) { list.erase(key); }
+                else              { found ^= list.find(key); }
+            }
+            do_not_optimize(found);
+        });
+    }
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+    return timer.elapsed();
+}
+
+int main(int argc, char* argv[])
+{
+    int max_threads = argc > 1 ? std::atoi(argv[1]) : 8;
+    int ops = argc > 2 ? std::atoi(argv[2]) : 2000;
+
+    const int lengths[] = { 100, 1000, 10000 };
+
+    csv_row(std::cout, "list", "length", "threads", "ops", "seconds", "ops_per_second");
+    for (int length : lengths)
+    {
+        for (int threads = 1; threads <= max_threads; threads *= 2)
+        {
+            double coarse = run<CoarseList>(length, threads, ops);
+            double fine = run<FineList>(length, threads, ops);
+
+            long total = static_cast<long>(ops) * threads;
+            csv_row(std::cout, "coarse", length, threads, total, coarse, total / coarse);
+            csv_row(std::cout, "fine", length, threads, total, fine, total / fine);
+        }
+    }
+    return 0;
+}
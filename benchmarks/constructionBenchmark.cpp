@@ -0,0 +1,198 @@
+/*
+
+File: constructionBenchmark.cpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+Building a list of ints from a std::vector of 1000, 100000 and 10000000
+elements, and destroying it again:
+
+    push_back     push_back every element, one allocation per node
+    range         the range constructor, every node in one block
+    assign        assign() the range to a list of one element
+    copy          copy construct from a list built with push_back
+    fill          the fill constructor with size copies of one value
+    resize        resize() an empty list to size elements
+
+std::list runs push_back, range and copy as the baseline. Destroying the
+list is measured with building it, so the cost of freeing nodes one by one
+shows up too. ops is the number of elements and ns_per_op the time per
+element.
+
+Usage: constructionBenchmark [--format=csv|json] [--repetitions=N]
+                             [--size=N] [--filter=TEXT]
+
+--size replaces the three sizes with one.
+
+*/
+
+#include <cstdlib>
+#include <list>
+#include <string>
+#include <vector>
+#include "benchmark.hpp"
+#include "linkedList.hpp"
+
+// Counts the allocations of every measured region
+#define ALLOCATION_COUNTER_HOOKS
+#include "allocationCounter.hpp"
+
+struct options
+{
+    bool json;
+    size_t repetitions;
+    size_t size;
+    std::string filter;
+};
+
+/*****
+OPERATIONS
+*****/
+
+// Each builds a list from values and returns its first element
+
+template <class List>
+int push_back(const std::vector<int>& values, const List&)
+{
+    List list;
+    for (int value : values)
+    {
+        list.push_back(value);
+    }
+    return *list.begin();
+}
+
+template <class List>
+int range(const std::vector<int>& values, const List&)
+{
+    List list(values.begin(), values.end());
+    return *list.begin();
+}
+
+template <class List>
+int copy(const std::vector<int>&, const List& origin)
+{
+    List list(origin);
+    return *list.begin();
+}
+
+int assign(const std::vector<int>& values, const LinkedList<int>&)
+{
+    LinkedList<int> list { -1 };
+    list.assign(values.begin(), values.end());
+    return *list.begin();
+}
+
+int fill(const std::vector<int>& values, const LinkedList<int>&)
+{
+    LinkedList<int> list(values.size(), 7);
+    return *list.begin();
+}
+
+int resize(const std::vector<int>& values, const LinkedList<int>&)
+{
+    LinkedList<int> list;
+    list.resize(values.size());
+    return *list.begin();
+}
+
+/*****
+DRIVER
+*****/
+
+template <class List>
+void run(const char* container, const char* operation,
+         int (*build)(const std::vector<int>&, const List&), const std::vector<int>& values,
+         const options& opts, std::vector<benchmark_result>& results)
+{
+    if ((std::string(container) + "/int/" + operation).find(opts.filter) == std::string::npos)
+    {
+        return;
+    }
+
+    List origin;
+    for (int value : values)
+    {
+        origin.push_back(value);
+    }
+
+    for (size_t repetition = 0; repetition < opts.repetitions; ++repetition)
+    {
+        sample measured;
+        SampleTimer timer(measured);
+        int first = build(values, origin);
+        timer.stop();
+
+        do_not_optimize(first);
+        benchmark_result result = { container, "int", operation, values.size(), repetition,
+                                    values.size(), measured.seconds, measured.events,
+                                    measured.allocations };
+        results.push_back(result);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    options opts = { false, 3, 0, "" };
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        std::string value = arg.substr(arg.find('=') + 1);
+
+        if (arg == "--format=json")                { opts.json = true; }
+        else if (arg == "--format=csv")            { opts.json = false; }
+        else if (arg.find("--repetitions=") == 0)  { opts.repetitions = std::strtoul(value.c_str(), nullptr, 10); }
+        else if (arg.find("--size=") == 0)         { opts.size = std::strtoul(value.c_str(), nullptr, 10); }
+        else if (arg.find("--filter=") == 0)       { opts.filter = value; }
+        else
+        {
+            std::cerr << "usage: constructionBenchmark [--format=csv|json] [--repetitions=N]"
+                         " [--size=N] [--filter=TEXT]\n";
+            return (arg == "--help") ? 0 : 2;
+        }
+    }
+
+    std::vector<size_t> sizes { 1000, 100000, 10000000 };
+    if (opts.size > 0) { sizes.assign(1, opts.size); }
+
+    std::vector<benchmark_result> results;
+    for (size_t size : sizes)
+    {
+        std::vector<int> values;
+        for (size_t i = 0; i < size; ++i)
+        {
+            values.push_back(static_cast<int>(i));
+        }
+
+        run<LinkedList<int> >("LinkedList", "push_back", push_back, values, opts, results);
+        run<LinkedList<int> >("LinkedList", "range", range, values, opts, results);
+        run<LinkedList<int> >("LinkedList", "assign", assign, values, opts, results);
+        run<LinkedList<int> >("LinkedList", "copy", copy, values, opts, results);
+        run<LinkedList<int> >("LinkedList", "fill", fill, values, opts, results);
+        run<LinkedList<int> >("LinkedList", "resize", resize, values, opts, results);
+        run<std::list<int> >("std::list", "push_back", push_back, values, opts, results);
+        run<std::list<int> >("std::list", "range", range, values, opts, results);
+        run<std::list<int> >("std::list", "copy", copy, values, opts, results);
+    }
+
+    report_columns columns = { false, true };
+    if (opts.json)
+    {
+        write_json(std::cout, results, columns);
+        return 0;
+    }
+
+    write_csv_header(std::cout, columns);
+    for (const benchmark_result& result : results)
+    {
+        write_csv(std::cout, result, columns);
+    }
+    return 0;
+}
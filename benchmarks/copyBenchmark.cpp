@@ -0,0 +1,191 @@
+/*
+
+File: copyBenchmark.cpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+Copying and comparing lists of 10 million elements by default, of int and
+of a 64 byte POD, laid out two ways:
+
+    block      assigned from a vector, the nodes in list order in one block
+    scattered  pushed back one by one, then sorted on a scrambled key so
+               every link jumps across the heap
+
+The operations are copy, copy constructing the list and destroying the
+copy, and equal, comparing the list with an equal copy of it. Operations
+are named like copy/block. ops is the number of elements and ns_per_op the
+time per element.
+
+Usage: copyBenchmark [--format=csv|json] [--repetitions=N] [--size=N]
+                     [--filter=TEXT]
+
+*/
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include "benchmark.hpp"
+#include "linkedList.hpp"
+
+// Counts the allocations of every measured region
+#define ALLOCATION_COUNTER_HOOKS
+#include "allocationCounter.hpp"
+
+struct options
+{
+    bool json;
+    size_t repetitions;
+    size_t size;
+    std::string filter;
+};
+
+struct pod
+{
+    int key;
+    int payload[15];
+
+    bool operator==(const pod& rhs) const { return key == rhs.key; }
+    bool operator!=(const pod& rhs) const { return key != rhs.key; }
+};
+
+template <typename T> T make(int key);
+template <> int make<int>(int key) { return key; }
+template <> pod make<pod>(int key) { pod value = { key, { 0 } }; return value; }
+
+template <typename T> int key(const T& value);
+template <> int key<int>(const int& value) { return value; }
+template <> int key<pod>(const pod& value) { return value.key; }
+
+template <typename T> const char* type_name();
+template <> const char* type_name<int>() { return "int"; }
+template <> const char* type_name<pod>() { return "pod64"; }
+
+// Fills the empty list, which is not returned by value since a copy would
+// put its nodes in a block
+template <typename T>
+void build(LinkedList<T>& list, const std::string& layout, size_t size)
+{
+    if (layout == "block")
+    {
+        std::vector<T> values;
+        values.reserve(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            values.push_back(make<T>(static_cast<int>(i)));
+        }
+        list.assign(values.begin(), values.end());
+        return;
+    }
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        list.push_back(make<T>(static_cast<int>(i)));
+    }
+
+    const long long scale = 7919;
+    const long long modulus = static_cast<long long>(size);
+    list.sort([scale, modulus](const T& lhs, const T& rhs)
+    {
+        return (key(lhs) * scale) % modulus < (key(rhs) * scale) % modulus;
+    });
+}
+
+/*****
+DRIVER
+*****/
+
+template <typename T>
+void run(const std::string& layout, const options& opts, std::vector<benchmark_result>& results)
+{
+    const std::string copy = "copy/" + layout;
+    const std::string equal = "equal/" + layout;
+    const std::string prefix = std::string("LinkedList/") + type_name<T>() + "/";
+    const bool run_copy = (prefix + copy).find(opts.filter) != std::string::npos;
+    const bool run_equal = (prefix + equal).find(opts.filter) != std::string::npos;
+    if (!run_copy && !run_equal) { return; }
+
+    LinkedList<T> list;
+    LinkedList<T> same;
+    build(list, layout, opts.size);
+    build(same, layout, opts.size);
+
+    for (size_t repetition = 0; repetition < opts.repetitions && run_copy; ++repetition)
+    {
+        sample measured;
+        SampleTimer timer(measured);
+        {
+            LinkedList<T> copied(list);
+            do_not_optimize(*copied.begin());
+        }
+        timer.stop();
+
+        benchmark_result result = { "LinkedList", type_name<T>(), copy, opts.size, repetition,
+                                    opts.size, measured.seconds, measured.events,
+                                    measured.allocations };
+        results.push_back(result);
+    }
+
+    for (size_t repetition = 0; repetition < opts.repetitions && run_equal; ++repetition)
+    {
+        sample measured;
+        SampleTimer timer(measured);
+        bool equal_lists = (list == same);
+        do_not_optimize(equal_lists);
+        timer.stop();
+
+        benchmark_result result = { "LinkedList", type_name<T>(), equal, opts.size, repetition,
+                                    opts.size, measured.seconds, measured.events,
+                                    measured.allocations };
+        results.push_back(result);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    options opts = { false, 3, 10000000, "" };
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        std::string value = arg.substr(arg.find('=') + 1);
+
+        if (arg == "--format=json")                { opts.json = true; }
+        else if (arg == "--format=csv")            { opts.json = false; }
+        else if (arg.find("--repetitions=") == 0)  { opts.repetitions = std::strtoul(value.c_str(), nullptr, 10); }
+        else if (arg.find("--size=") == 0)         { opts.size = std::strtoul(value.c_str(), nullptr, 10); }
+        else if (arg.find("--filter=") == 0)       { opts.filter = value; }
+        else
+        {
+            std::cerr << "usage: copyBenchmark [--format=csv|json] [--repetitions=N]"
+                         " [--size=N] [--filter=TEXT]\n";
+            return (arg == "--help") ? 0 : 2;
+        }
+    }
+
+    std::vector<benchmark_result> results;
+    for (const char* layout : { "block", "scattered" })
+    {
+        run<int>(layout, opts, results);
+        run<pod>(layout, opts, results);
+    }
+
+    report_columns columns = { false, true };
+    if (opts.json)
+    {
+        write_json(std::cout, results, columns);
+        return 0;
+    }
+
+    write_csv_header(std::cout, columns);
+    for (const benchmark_result& result : results)
+    {
+        write_csv(std::cout, result, columns);
+    }
+    return 0;
+}
@@ -0,0 +1,111 @@
+/*
+
+File: heapTracker.hpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+/*
+Tracks the heap in use for the benchmarks that report memory. Replacements
+of operator new and delete store the size of every allocation in a header
+in front of it, so the bytes live at any moment are known:
+
+    live        bytes requested and not yet freed
+    blocks      the same allocations as the allocator holds them, with its
+                header and rounding, estimated by footprint::allocated_size
+    peak        the highest live since the last reset_peak()
+    allocations allocations made
+
+The header of the tracker itself is not counted. Define HEAP_TRACKER_HOOKS
+in the one translation unit that installs the hooks, the benchmark's main
+file, and do not combine it with the hooks of allocationCounter.hpp.
+Counts are plain globals, track single threaded code only.
+*/
+
+#ifndef HEAP_TRACKER_H
+#define HEAP_TRACKER_H
+
+#include <cstddef>
+#include "memoryFootprint.hpp"
+
+namespace heap
+{
+
+struct totals
+{
+    size_t live;
+    size_t blocks;
+    size_t peak;
+    size_t allocations;
+};
+
+inline totals& current()
+{
+    static totals counts = { 0, 0, 0, 0 };
+    return counts;
+}
+
+inline void reset_peak() { current().peak = current().live; }
+
+} // namespace heap
+
+#endif // HEAP_TRACKER_H
+
+#if defined(HEAP_TRACKER_HOOKS) && !defined(HEAP_TRACKER_HOOKS_DEFINED)
+#define HEAP_TRACKER_HOOKS_DEFINED
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+namespace heap
+{
+    const size_t header = alignof(std::max_align_t);
+
+    inline void* tracked_allocate(size_t size)
+    {
+        char* memory = static_cast<char*>(std::malloc(size + header));
+        if (memory == nullptr) { throw std::bad_alloc(); }
+
+        *reinterpret_cast<size_t*>(memory) = size;
+
+        totals& counts = current();
+        counts.live += size;
+        counts.blocks += footprint::allocated_size(size);
+        counts.peak = std::max(counts.peak, counts.live);
+        ++counts.allocations;
+        return memory + header;
+    }
+
+    inline void tracked_free(void* pointer)
+    {
+        if (pointer == nullptr) { return; }
+
+        char* memory = static_cast<char*>(pointer) - header;
+        size_t size = *reinterpret_cast<size_t*>(memory);
+
+        totals& counts = current();
+        counts.live -= size;
+        counts.blocks -= footprint::allocated_size(size);
+        std::free(memory);
+    }
+}
+
+void* operator new(size_t size) { return heap::tracked_allocate(size); }
+void* operator new[](size_t size) { return heap::tracked_allocate(size); }
+void operator delete(void* pointer) noexcept { heap::tracked_free(pointer); }
+void operator delete[](void* pointer) noexcept { heap::tracked_free(pointer); }
+
+#if defined(__cpp_sized_deallocation)
+void operator delete(void* pointer, size_t) noexcept { heap::tracked_free(pointer); }
+void operator delete[](void* pointer, size_t) noexcept { heap::tracked_free(pointer); }
+#endif
+
+#endif // HEAP_TRACKER_HOOKS
@@ -0,0 +1,307 @@
+/*
+
+File: latencyBenchmark.cpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+Tail latency of single list operations. Every call is timed on its own and
+recorded in a LatencyHistogram, reported as min, p50, p90, p99, p99.9, max
+and mean in nanoseconds. LinkedList is measured with std::list as the
+reference, on int and std::string elements.
+
+Each workload starts from a list of --size elements, and the list stays
+that size while the workload runs:
+
+    push_back   push_back a value, then an untimed pop_front
+    pop_front   pop_front, then an untimed push_back
+    erase       erase at a random position, then an untimed push_back
+    find        find a random element
+    sort        sort a shuffled list, rebuilt untimed between calls
+    clear       clear a full list, refilled untimed between calls
+    destroy     destroy a full list, rebuilt untimed between calls
+
+The timer row is the cost of reading the clock twice, a floor under every
+other latency.
+
+Usage: latencyBenchmark [--format=json|csv] [--size=N] [--samples=N]
+                        [--slow-samples=N] [--filter=TEXT]
+
+--samples applies to push_back and pop_front. erase and find take a tenth of
+it, and sort, clear and destroy take --slow-samples.
+
+*/
+
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "latencyHistogram.hpp"
+#include "listCases.hpp"
+
+struct options
+{
+    options() : json(true), size(100000), samples(1000000), slow_samples(50) {}
+
+    bool json;
+    size_t size;
+    size_t samples;
+    size_t slow_samples;
+    std::string filter;
+};
+
+struct latency_result
+{
+    std::string container;
+    std::string type;
+    std::string operation;
+    size_t size;
+    LatencyHistogram histogram;
+};
+
+typedef std::chrono::steady_clock latency_clock;
+
+inline std::uint64_t nanoseconds(latency_clock::time_point start, latency_clock::time_point stop)
+{
+    return std::uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count());
+}
+
+// Times the region between construction and stop() into a histogram
+class LatencyTimer
+{
+public:
+
+    explicit LatencyTimer(LatencyHistogram& histogram) : histogram(histogram), start(latency_clock::now()) {}
+
+    void stop() { histogram.record(nanoseconds(start, latency_clock::now())); }
+
+private:
+
+    LatencyHistogram& histogram;
+    latency_clock::time_point start;
+};
+
+/*******************************************************************************
+WORKLOADS
+*******************************************************************************/
+
+template <class Adapter, typename T>
+void run_workloads(const options& opts, std::vector<latency_result>& results)
+{
+    typedef typename Adapter::container container;
+    typedef typename Adapter::iterator iterator;
+
+    const size_t n = opts.size;
+    const std::vector<T> values = ascending<T>(n);
+    const std::vector<T> mixed = shuffled<T>(n);
+    std::mt19937 random(42);
+    std::uniform_int_distribution<size_t> position(0, n - 1);
+
+    std::string prefix = std::string(Adapter::name()) + "/" + element<T>::name() + "/";
+    auto wanted = [&](const char* operation) { return (prefix + operation).find(opts.filter) != std::string::npos; };
+    auto result = [&](const char* operation) -> LatencyHistogram&
+    {
+        latency_result entry = { Adapter::name(), element<T>::name(), operation, n, LatencyHistogram() };
+        results.push_back(entry);
+        return results.back().histogram;
+    };
+
+    if (wanted("push_back"))
+    {
+        LatencyHistogram& histogram = result("push_back");
+        container list(values.begin(), values.end());
+        for (size_t i = 0; i < opts.samples; ++i)
+        {
+            LatencyTimer timer(histogram);
+            Adapter::push_back(list, values[i % n]);
+            timer.stop();
+            Adapter::pop_front(list);
+        }
+    }
+    if (wanted("pop_front"))
+    {
+        LatencyHistogram& histogram = result("pop_front");
+        container list(values.begin(), values.end());
+        for (size_t i = 0; i < opts.samples; ++i)
+        {
+            LatencyTimer timer(histogram);
+            Adapter::pop_front(list);
+            timer.stop();
+            Adapter::push_back(list, values[i % n]);
+        }
+    }
+    if (wanted("erase"))
+    {
+        LatencyHistogram& histogram = result("erase");
+        container list(values.begin(), values.end());
+        for (size_t i = 0; i < opts.samples / 10; ++i)
+        {
+            iterator it = list.begin();
+            std::advance(it, position(random));
+            T value = *it;
+
+            LatencyTimer timer(histogram);
+            Adapter::erase(list, it);
+            timer.stop();
+            Adapter::push_back(list, value);
+        }
+    }
+    if (wanted("find"))
+    {
+        LatencyHistogram& histogram = result("find");
+        container list(values.begin(), values.end());
+        for (size_t i = 0; i < opts.samples / 10; ++i)
+        {
+            const T& target = values[position(random)];
+
+            LatencyTimer timer(histogram);
+            do_not_optimize(Adapter::find(list, target));
+            timer.stop();
+        }
+    }
+    if (wanted("sort"))
+    {
+        LatencyHistogram& histogram = result("sort");
+        for (size_t i = 0; i < opts.slow_samples; ++i)
+        {
+            container list(mixed.begin(), mixed.end());
+
+            LatencyTimer timer(histogram);
+            Adapter::sort(list);
+            timer.stop();
+        }
+    }
+    if (wanted("clear"))
+    {
+        LatencyHistogram& histogram = result("clear");
+        container list;
+        for (size_t i = 0; i < opts.slow_samples; ++i)
+        {
+            for (const T& value : values)
+            {
+                Adapter::push_back(list, value);
+            }
+
+            LatencyTimer timer(histogram);
+            list.clear();
+            timer.stop();
+        }
+    }
+    if (wanted("destroy"))
+    {
+        LatencyHistogram& histogram = result("destroy");
+        for (size_t i = 0; i < opts.slow_samples; ++i)
+        {
+            std::unique_ptr<container> list(new container(values.begin(), values.end()));
+
+            LatencyTimer timer(histogram);
+            list.reset();
+            timer.stop();
+        }
+    }
+}
+
+/*******************************************************************************
+DRIVER
+*******************************************************************************/
+
+void write_results(std::ostream& out, const std::vector<latency_result>& results, bool json)
+{
+    if (!json)
+    {
+        csv_row(out, "container", "type", "operation", "size", "samples", "min_ns", "p50_ns",
+                "p90_ns", "p99_ns", "p999_ns", "max_ns", "mean_ns");
+    }
+    else
+    {
+        out << "[\n";
+    }
+
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const latency_result& result = results[i];
+        const LatencyHistogram& histogram = result.histogram;
+        if (!json)
+        {
+            csv_row(out, result.container, result.type, result.operation, result.size,
+                    histogram.count(), histogram.min(), histogram.percentile(50),
+                    histogram.percentile(90), histogram.percentile(99), histogram.percentile(99.9),
+                    histogram.max(), histogram.mean());
+            continue;
+        }
+        out << "  {\"container\": \"" << result.container
+            << "\", \"type\": \"" << result.type
+            << "\", \"operation\": \"" << result.operation
+            << "\", \"size\": " << result.size
+            << ", \"samples\": " << histogram.count()
+            << ", \"min_ns\": " << histogram.min()
+            << ", \"p50_ns\": " << histogram.percentile(50)
+            << ", \"p90_ns\": " << histogram.percentile(90)
+            << ", \"p99_ns\": " << histogram.percentile(99)
+            << ", \"p999_ns\": " << histogram.percentile(99.9)
+            << ", \"max_ns\": " << histogram.max()
+            << ", \"mean_ns\": " << histogram.mean()
+            << ((i + 1 < results.size()) ? "},\n" : "}\n");
+    }
+
+    if (json) { out << "]\n"; }
+}
+
+bool parse(int argc, char* argv[], options& opts)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        std::string value = arg.substr(arg.find('=') + 1);
+
+        if (arg == "--format=json")                 { opts.json = true; }
+        else if (arg == "--format=csv")             { opts.json = false; }
+        else if (arg.find("--size=") == 0)          { opts.size = std::strtoul(value.c_str(), nullptr, 10); }
+        else if (arg.find("--samples=") == 0)       { opts.samples = std::strtoul(value.c_str(), nullptr, 10); }
+        else if (arg.find("--slow-samples=") == 0)  { opts.slow_samples = std::strtoul(value.c_str(), nullptr, 10); }
+        else if (arg.find("--filter=") == 0)        { opts.filter = value; }
+        else if (arg == "--help")                   { return false; }
+        else
+        {
+            std::cerr << "unknown argument " << arg << '\n';
+            return false;
+        }
+    }
+    return opts.size > 0;
+}
+
+int main(int argc, char* argv[])
+{
+    options opts;
+    if (!parse(argc, argv, opts))
+    {
+        std::cerr << "usage: latencyBenchmark [--format=json|csv] [--size=N] [--samples=N]"
+                     " [--slow-samples=N] [--filter=TEXT]\n";
+        return 1;
+    }
+
+    std::vector<latency_result> results;
+
+    latency_result timer = { "clock", "none", "timer", 0, LatencyHistogram() };
+    for (size_t i = 0; i < opts.samples; ++i)
+    {
+        LatencyTimer empty(timer.histogram);
+        empty.stop();
+    }
+    results.push_back(timer);
+
+    run_workloads<linked_list_adapter<int>, int>(opts, results);
+    run_workloads<list_adapter<int>, int>(opts, results);
+    run_workloads<linked_list_adapter<std::string>, std::string>(opts, results);
+    run_workloads<list_adapter<std::string>, std::string>(opts, results);
+
+    write_results(std::cout, results, opts.json);
+    return 0;
+}
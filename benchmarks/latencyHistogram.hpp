@@ -0,0 +1,129 @@
+/*
+
+File: latencyHistogram.hpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+/*
+Histogram of latencies in the style of HdrHistogram. Values below 128 are
+counted exactly. Above that every power of two is split into 64 buckets of
+equal width, so a recorded value is off by less than 1/64 of itself while
+the whole range of a 64 bit count of nanoseconds fits in about 3800 buckets.
+Percentiles report the highest value of their bucket, and min and max are
+exact.
+*/
+
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+class LatencyHistogram
+{
+public:
+
+    LatencyHistogram()
+        : counts(bucket_count(), 0), total(0), sum(0),
+          minimum(std::numeric_limits<std::uint64_t>::max()), maximum(0) {}
+
+    void record(std::uint64_t value)
+    {
+        ++counts[index(value)];
+        ++total;
+        sum += double(value);
+        minimum = std::min(minimum, value);
+        maximum = std::max(maximum, value);
+    }
+
+    void merge(const LatencyHistogram& other)
+    {
+        for (size_t i = 0; i < counts.size(); ++i)
+        {
+            counts[i] += other.counts[i];
+        }
+        total += other.total;
+        sum += other.sum;
+        minimum = std::min(minimum, other.minimum);
+        maximum = std::max(maximum, other.maximum);
+    }
+
+    // The value at or below which the given percent of the values lie
+    std::uint64_t percentile(double percent) const
+    {
+        if (total == 0) { return 0; }
+
+        std::uint64_t rank = std::uint64_t(percent / 100 * total + 0.5);
+        rank = std::max<std::uint64_t>(1, std::min(rank, total));
+
+        std::uint64_t seen = 0;
+        for (size_t i = 0; i < counts.size(); ++i)
+        {
+            seen += counts[i];
+            if (seen >= rank)
+            {
+                return std::min(highest_in(i), maximum);
+            }
+        }
+        return maximum;
+    }
+
+    std::uint64_t count() const { return total; }
+    std::uint64_t min() const { return (total == 0) ? 0 : minimum; }
+    std::uint64_t max() const { return maximum; }
+    double mean() const { return (total == 0) ? 0 : sum / total; }
+
+private:
+
+    static const int sub_bits = 7;
+    static const std::uint64_t sub_count = std::uint64_t(1) << sub_bits;
+    static const std::uint64_t half_count = sub_count / 2;
+
+    static size_t bucket_count()
+    {
+        return size_t(sub_count + (64 - sub_bits) * half_count);
+    }
+
+    static int highest_bit(std::uint64_t value)
+    {
+        int bit = 0;
+        while (value >>= 1) { ++bit; }
+        return bit;
+    }
+
+    static size_t index(std::uint64_t value)
+    {
+        if (value < sub_count) { return size_t(value); }
+
+        int shift = highest_bit(value) - sub_bits + 1;
+        std::uint64_t sub = value >> shift;
+        return size_t(sub_count + (shift - 1) * half_count + (sub - half_count));
+    }
+
+    static std::uint64_t highest_in(size_t bucket)
+    {
+        if (bucket < sub_count) { return bucket; }
+
+        std::uint64_t shift = (bucket - sub_count) / half_count + 1;
+        std::uint64_t sub = (bucket - sub_count) % half_count + half_count;
+        return ((sub + 1) << shift) - 1;
+    }
+
+    std::vector<std::uint64_t> counts;
+    std::uint64_t total;
+    double sum;
+    std::uint64_t minimum;
+    std::uint64_t maximum;
+};
+
+#endif // LATENCY_HISTOGRAM_H
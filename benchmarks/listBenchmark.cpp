@@ -0,0 +1,153 @@
+/*
+
+File: listBenchmark.cpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+Benchmark suite for LinkedList with std::forward_list, std::list and
+std::vector as baselines. Every operation the containers support is timed for
+int, a 64 byte POD and std::string elements over sizes growing by a factor of
+ten. ops is the number of elements an operation processed and ns_per_op the
+time per element.
+
+Operations whose calls are linear in the size (pop_back on LinkedList, insert
+and erase in a vector, find, ...) are called at most budget / size times.
+Operations that are quadratic or recurse per node in LinkedList are skipped
+above the limit named in linked_list_adapter::limit().
+
+Usage: listBenchmark [--format=csv|json] [--min-size=N] [--max-size=N]
+                     [--repetitions=N] [--budget=N] [--filter=TEXT] [--counters]
+                     [--allocations]
+
+--filter keeps the cases whose "container/type/operation" contains TEXT.
+
+--counters adds the hardware events of perfCounters.hpp, cycles,
+instructions, L1 data, last level cache and data TLB misses and branch
+misses, each per op. Where the events cannot be counted the benchmark says
+why and reports time alone.
+
+--allocations adds the heap allocations, frees and bytes allocated per op.
+
+*/
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include "listCases.hpp"
+
+// Counts the allocations of every measured region for --allocations
+#define ALLOCATION_COUNTER_HOOKS
+#include "allocationCounter.hpp"
+
+struct options
+{
+    options()
+        : min_size(100), max_size(1000000), repetitions(1), budget(100000000), json(false),
+          counters(false), allocations(false) {}
+
+    size_t min_size;
+    size_t max_size;
+    size_t repetitions;
+    size_t budget;
+    bool json;
+    bool counters;
+    bool allocations;
+    std::string filter;
+};
+
+bool parse(int argc, char* argv[], options& opts)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        std::string value = arg.substr(arg.find('=') + 1);
+
+        if (arg == "--format=json")                { opts.json = true; }
+        else if (arg == "--format=csv")            { opts.json = false; }
+        else if (arg.find("--min-size=") == 0)     { opts.min_size = std::strtoul(value.c_str(), nullptr, 10); }
+        else if (arg.find("--max-size=") == 0)     { opts.max_size = std::strtoul(value.c_str(), nullptr, 10); }
+        else if (arg.find("--repetitions=") == 0)  { opts.repetitions = std::strtoul(value.c_str(), nullptr, 10); }
+        else if (arg.find("--budget=") == 0)       { opts.budget = std::strtoul(value.c_str(), nullptr, 10); }
+        else if (arg.find("--filter=") == 0)       { opts.filter = value; }
+        else if (arg == "--counters")              { opts.counters = true; }
+        else if (arg == "--allocations")           { opts.allocations = true; }
+        else if (arg == "--help")                  { return false; }
+        else
+        {
+            std::cerr << "unknown argument " << arg << '\n';
+            return false;
+        }
+    }
+    return opts.min_size > 0 && opts.repetitions > 0 && opts.budget > 0;
+}
+
+int main(int argc, char* argv[])
+{
+    options opts;
+    if (!parse(argc, argv, opts))
+    {
+        std::cerr << "usage: listBenchmark [--format=csv|json] [--min-size=N] [--max-size=N]"
+                     " [--repetitions=N] [--budget=N] [--filter=TEXT] [--counters] [--allocations]\n";
+        return 1;
+    }
+
+    std::vector<suite> suites;
+    add_suites<int>(suites);
+    add_suites<pod64>(suites);
+    add_suites<std::string>(suites);
+
+    PerfCounters counters;
+    if (opts.counters && !counters.available())
+    {
+        std::cerr << "hardware counters unavailable (" << counters.reason() << "), reporting time only\n";
+        opts.counters = false;
+    }
+
+    report_columns columns = { opts.counters, opts.allocations };
+
+    std::vector<benchmark_result> results;
+    if (!opts.json) { write_csv_header(std::cout, columns); }
+
+    for (size_t size = opts.min_size; size <= opts.max_size; size *= 10)
+    {
+        for (const suite& current : suites)
+        {
+            for (const benchmark_case& test : current.cases)
+            {
+                std::string id = current.container + "/" + current.type + "/" + test.operation;
+                if (id.find(opts.filter) == std::string::npos) { continue; }
+                if (size > current.limit(test.operation)) { continue; }
+
+                for (size_t repetition = 0; repetition < opts.repetitions; ++repetition)
+                {
+                    sample measured(opts.counters ? &counters : nullptr);
+
+                    benchmark_result result;
+                    result.container = current.container;
+                    result.type = current.type;
+                    result.operation = test.operation;
+                    result.size = size;
+                    result.repetition = repetition;
+                    result.ops = test.run(size, opts.budget, measured);
+                    result.seconds = measured.seconds;
+                    result.events = measured.events;
+                    result.allocations = measured.allocations;
+
+                    if (opts.json) { results.push_back(result); }
+                    else           { write_csv(std::cout, result, columns); }
+                }
+            }
+        }
+        // Guards the loop against overflow when max_size is close to the limit
+        if (size > opts.max_size / 10) { break; }
+    }
+
+    if (opts.json) { write_json(std::cout, results, columns); }
+    return 0;
+}
@@ -0,0 +1,508 @@
+/*
+
+File: listCases.hpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+// Benchmark cases for LinkedList and the std containers it is compared with,
+// shared by listBenchmark and perfGate
+
+#ifndef LIST_CASES_H
+#define LIST_CASES_H
+
+#include <algorithm>
+#include <cstdint>
+#include <forward_list>
+#include <functional>
+#include <list>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "benchmark.hpp"
+#include "linkedList.hpp"
+
+/*******************************************************************************
+ELEMENT TYPES
+*******************************************************************************/
+
+struct pod64
+{
+    std::int64_t values[8];
+};
+
+inline bool operator==(const pod64& lhs, const pod64& rhs)
+{
+    return std::equal(lhs.values, lhs.values + 8, rhs.values);
+}
+
+inline bool operator!=(const pod64& lhs, const pod64& rhs)
+{
+    return !(lhs == rhs);
+}
+
+inline bool operator<(const pod64& lhs, const pod64& rhs)
+{
+    return std::lexicographical_compare(lhs.values, lhs.values + 8, rhs.values, rhs.values + 8);
+}
+
+namespace std
+{
+    template <>
+    struct hash<pod64>
+    {
+        size_t operator()(const pod64& value) const
+        {
+            return std::hash<std::int64_t>()(value.values[0]);
+        }
+    };
+}
+
+// Values made from increasing indices compare in increasing order
+template <typename T> struct element;
+
+template <>
+struct element<int>
+{
+    static const char* name() { return "int"; }
+    static int make(size_t i) { return static_cast<int>(i); }
+};
+
+template <>
+struct element<pod64>
+{
+    static const char* name() { return "pod64"; }
+    static pod64 make(size_t i)
+    {
+        pod64 value;
+        std::fill(value.values, value.values + 8, static_cast<std::int64_t>(i));
+        return value;
+    }
+};
+
+template <>
+struct element<std::string>
+{
+    static const char* name() { return "string"; }
+
+    // Zero padded and too long for the small string buffer, so every copy allocates
+    static std::string make(size_t i)
+    {
+        std::string value(24, '0');
+        for (size_t digit = value.size(); i != 0 && digit > 0; i /= 10)
+        {
+            value[--digit] = static_cast<char>('0' + i % 10);
+        }
+        return value;
+    }
+};
+
+template <typename T>
+std::vector<T> ascending(size_t n, size_t repeat = 1)
+{
+    std::vector<T> values;
+    values.reserve(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        values.push_back(element<T>::make(i / repeat));
+    }
+    return values;
+}
+
+template <typename T>
+std::vector<T> shuffled(size_t n)
+{
+    std::vector<T> values = ascending<T>(n);
+    std::shuffle(values.begin(), values.end(), std::mt19937(42));
+    return values;
+}
+
+/*******************************************************************************
+CONTAINER ADAPTERS
+*******************************************************************************/
+
+const size_t unlimited = static_cast<size_t>(-1);
+
+template <typename T>
+struct linked_list_adapter
+{
+    typedef LinkedList<T> container;
+    typedef typename container::iterator iterator;
+
+    static const char* name() { return "LinkedList"; }
+
+    static size_t limit(const std::string&) { return unlimited; }
+
+    static void push_back(container& list, const T& value) { list.push_back(value); }
+    static void push_front(container& list, const T& value) { list.push_front(value); }
+    static void pop_back(container& list) { list.pop_back(); }
+    static void pop_front(container& list) { list.pop_front(); }
+
+    static iterator middle(container& list, size_t n) { iterator it = list.begin(); std::advance(it, n / 2); return it; }
+    static void insert(container& list, iterator& position, const T& value) { list.insert(position, value); }
+    static void erase(container& list, iterator& position) { list.erase(position); }
+
+    static bool find(container& list, const T& value) { return list.find(value) != list.end(); }
+    static void sort(container& list) { list.sort(); }
+    static void unique(container& list) { list.unique(); }
+    static void reverse(container& list) { list.reverse(); }
+};
+
+template <typename T>
+struct list_adapter
+{
+    typedef std::list<T> container;
+    typedef typename container::iterator iterator;
+
+    static const char* name() { return "std::list"; }
+    static size_t limit(const std::string&) { return unlimited; }
+
+    static void push_back(container& list, const T& value) { list.push_back(value); }
+    static void push_front(container& list, const T& value) { list.push_front(value); }
+    static void pop_back(container& list) { list.pop_back(); }
+    static void pop_front(container& list) { list.pop_front(); }
+
+    static iterator middle(container& list, size_t n) { return std::next(list.begin(), n / 2); }
+    static void insert(container& list, iterator& position, const T& value) { list.insert(position, value); }
+    static void erase(container& list, iterator& position) { position = list.erase(position); }
+
+    static bool find(container& list, const T& value)
+    {
+        return std::find(list.begin(), list.end(), value) != list.end();
+    }
+    static void sort(container& list) { list.sort(); }
+    static void unique(container& list) { list.unique(); }
+    static void reverse(container& list) { list.reverse(); }
+};
+
+template <typename T>
+struct forward_list_adapter
+{
+    typedef std::forward_list<T> container;
+    typedef typename container::iterator iterator;
+
+    static const char* name() { return "std::forward_list"; }
+    static size_t limit(const std::string&) { return unlimited; }
+
+    static void push_front(container& list, const T& value) { list.push_front(value); }
+    static void pop_front(container& list) { list.pop_front(); }
+
+    // Insertion and removal happen after position
+    static iterator middle(container& list, size_t n) { return std::next(list.begin(), n / 2); }
+    static void insert(container& list, iterator& position, const T& value) { list.insert_after(position, value); }
+    static void erase(container& list, iterator& position) { list.erase_after(position); }
+
+    static bool find(container& list, const T& value)
+    {
+        return std::find(list.begin(), list.end(), value) != list.end();
+    }
+    static void sort(container& list) { list.sort(); }
+    static void unique(container& list) { list.unique(); }
+    static void reverse(container& list) { list.reverse(); }
+};
+
+template <typename T>
+struct vector_adapter
+{
+    typedef std::vector<T> container;
+    typedef typename container::iterator iterator;
+
+    static const char* name() { return "std::vector"; }
+    static size_t limit(const std::string&) { return unlimited; }
+
+    static void push_back(container& vector, const T& value) { vector.push_back(value); }
+    static void pop_back(container& vector) { vector.pop_back(); }
+
+    static iterator middle(container& vector, size_t n) { return vector.begin() + n / 2; }
+    static void insert(container& vector, iterator& position, const T& value) { position = vector.insert(position, value); }
+    static void erase(container& vector, iterator& position) { position = vector.erase(position); }
+
+    static bool find(container& vector, const T& value)
+    {
+        return std::find(vector.begin(), vector.end(), value) != vector.end();
+    }
+    static void sort(container& vector) { std::sort(vector.begin(), vector.end()); }
+    static void unique(container& vector) { vector.erase(std::unique(vector.begin(), vector.end()), vector.end()); }
+    static void reverse(container& vector) { std::reverse(vector.begin(), vector.end()); }
+};
+
+/*******************************************************************************
+CASES
+*******************************************************************************/
+
+// Runs the operation on a container of n elements and returns the ops
+// processed, the sample measures the operation alone without setup and teardown
+typedef std::function<size_t(size_t n, size_t budget, sample& out)> case_function;
+
+struct benchmark_case
+{
+    std::string operation;
+    case_function run;
+};
+
+// Number of calls for an operation whose calls each cost O(n)
+inline size_t linear_calls(size_t n, size_t limit, size_t budget)
+{
+    return std::max<size_t>(1, std::min(limit, budget / n));
+}
+
+template <class Adapter, typename T>
+void add_common(std::vector<benchmark_case>& cases)
+{
+    typedef typename Adapter::container container;
+
+    cases.push_back({ "construct_fill", [](size_t n, size_t, sample& out)
+    {
+        T value = element<T>::make(7);
+        SampleTimer timer(out);
+        container list(n, value);
+        timer.stop();
+        return n;
+    }});
+    cases.push_back({ "construct_range", [](size_t n, size_t, sample& out)
+    {
+        std::vector<T> values = ascending<T>(n);
+        SampleTimer timer(out);
+        container list(values.begin(), values.end());
+        timer.stop();
+        return n;
+    }});
+    cases.push_back({ "construct_initializer_list", [](size_t n, size_t, sample& out)
+    {
+        std::vector<T> v = ascending<T>(16);
+        size_t rounds = std::max<size_t>(1, n / 16);
+        SampleTimer timer(out);
+        for (size_t i = 0; i < rounds; ++i)
+        {
+            container list { v[0], v[1], v[2], v[3], v[4], v[5], v[6], v[7],
+                             v[8], v[9], v[10], v[11], v[12], v[13], v[14], v[15] };
+            do_not_optimize(list);
+        }
+        timer.stop();
+        return rounds * 16;
+    }});
+    cases.push_back({ "copy", [](size_t n, size_t, sample& out)
+    {
+        std::vector<T> values = ascending<T>(n);
+        container source(values.begin(), values.end());
+        std::unique_ptr<container> copy;
+        SampleTimer timer(out);
+        copy.reset(new container(source));
+        timer.stop();
+        return n;
+    }});
+    cases.push_back({ "equality", [](size_t n, size_t, sample& out)
+    {
+        std::vector<T> values = ascending<T>(n);
+        container left(values.begin(), values.end());
+        container right(values.begin(), values.end());
+        SampleTimer timer(out);
+        do_not_optimize(left == right);
+        timer.stop();
+        return n;
+    }});
+    cases.push_back({ "destroy", [](size_t n, size_t, sample& out)
+    {
+        std::vector<T> values = ascending<T>(n);
+        std::unique_ptr<container> list(new container(values.begin(), values.end()));
+        SampleTimer timer(out);
+        list.reset();
+        timer.stop();
+        return n;
+    }});
+    cases.push_back({ "find", [](size_t n, size_t budget, sample& out)
+    {
+        std::vector<T> values = ascending<T>(n);
+        container list(values.begin(), values.end());
+        T absent = element<T>::make(n + 1);
+        size_t calls = linear_calls(n, 100, budget);
+        SampleTimer timer(out);
+        for (size_t i = 0; i < calls; ++i)
+        {
+            do_not_optimize(Adapter::find(list, absent));
+        }
+        timer.stop();
+        return calls * n;
+    }});
+    cases.push_back({ "sort", [](size_t n, size_t, sample& out)
+    {
+        std::vector<T> values = shuffled<T>(n);
+        container list(values.begin(), values.end());
+        SampleTimer timer(out);
+        Adapter::sort(list);
+        timer.stop();
+        return n;
+    }});
+    cases.push_back({ "unique", [](size_t n, size_t, sample& out)
+    {
+        std::vector<T> values = ascending<T>(n, 4);
+        container list(values.begin(), values.end());
+        SampleTimer timer(out);
+        Adapter::unique(list);
+        timer.stop();
+        return n;
+    }});
+    cases.push_back({ "reverse", [](size_t n, size_t, sample& out)
+    {
+        std::vector<T> values = ascending<T>(n);
+        container list(values.begin(), values.end());
+        SampleTimer timer(out);
+        Adapter::reverse(list);
+        timer.stop();
+        return n;
+    }});
+}
+
+template <class Adapter, typename T>
+void add_back(std::vector<benchmark_case>& cases)
+{
+    typedef typename Adapter::container container;
+
+    cases.push_back({ "push_back", [](size_t n, size_t, sample& out)
+    {
+        std::vector<T> values = ascending<T>(n);
+        container list;
+        SampleTimer timer(out);
+        for (const T& value : values)
+        {
+            Adapter::push_back(list, value);
+        }
+        timer.stop();
+        return n;
+    }});
+    cases.push_back({ "pop_back", [](size_t n, size_t budget, sample& out)
+    {
+        std::vector<T> values = ascending<T>(n);
+        container list(values.begin(), values.end());
+        size_t calls = linear_calls(n, n, budget);
+        SampleTimer timer(out);
+        for (size_t i = 0; i < calls; ++i)
+        {
+            Adapter::pop_back(list);
+        }
+        timer.stop();
+        return calls;
+    }});
+}
+
+template <class Adapter, typename T>
+void add_front(std::vector<benchmark_case>& cases)
+{
+    typedef typename Adapter::container container;
+
+    cases.push_back({ "push_front", [](size_t n, size_t, sample& out)
+    {
+        std::vector<T> values = ascending<T>(n);
+        container list;
+        SampleTimer timer(out);
+        for (const T& value : values)
+        {
+            Adapter::push_front(list, value);
+        }
+        timer.stop();
+        return n;
+    }});
+    cases.push_back({ "pop_front", [](size_t n, size_t, sample& out)
+    {
+        std::vector<T> values = ascending<T>(n);
+        container list(values.begin(), values.end());
+        SampleTimer timer(out);
+        for (size_t i = 0; i < n; ++i)
+        {
+            Adapter::pop_front(list);
+        }
+        timer.stop();
+        return n;
+    }});
+}
+
+template <class Adapter, typename T>
+void add_middle(std::vector<benchmark_case>& cases)
+{
+    typedef typename Adapter::container container;
+    typedef typename Adapter::iterator iterator;
+
+    cases.push_back({ "insert_middle", [](size_t n, size_t budget, sample& out)
+    {
+        std::vector<T> values = ascending<T>(n);
+        container list(values.begin(), values.end());
+        iterator position = Adapter::middle(list, n);
+        size_t calls = linear_calls(n, n, budget);
+        SampleTimer timer(out);
+        for (size_t i = 0; i < calls; ++i)
+        {
+            Adapter::insert(list, position, values[i]);
+        }
+        timer.stop();
+        return calls;
+    }});
+    cases.push_back({ "erase_middle", [](size_t n, size_t budget, sample& out)
+    {
+        std::vector<T> values = ascending<T>(n);
+        container list(values.begin(), values.end());
+        iterator position = Adapter::middle(list, n);
+        size_t calls = linear_calls(n, n / 2 - 1, budget);
+        SampleTimer timer(out);
+        for (size_t i = 0; i < calls; ++i)
+        {
+            Adapter::erase(list, position);
+        }
+        timer.stop();
+        return calls;
+    }});
+}
+
+/*******************************************************************************
+SUITES
+*******************************************************************************/
+
+// The cases of one container and element type
+struct suite
+{
+    std::string container;
+    std::string type;
+    size_t (*limit)(const std::string&);
+    std::vector<benchmark_case> cases;
+};
+
+template <typename T>
+void add_suites(std::vector<suite>& suites)
+{
+    suite linked = { linked_list_adapter<T>::name(), element<T>::name(),
+                     &linked_list_adapter<T>::limit, {} };
+    add_common<linked_list_adapter<T>, T>(linked.cases);
+    add_back<linked_list_adapter<T>, T>(linked.cases);
+    add_front<linked_list_adapter<T>, T>(linked.cases);
+    add_middle<linked_list_adapter<T>, T>(linked.cases);
+    suites.push_back(linked);
+
+    suite forward = { forward_list_adapter<T>::name(), element<T>::name(),
+                      &forward_list_adapter<T>::limit, {} };
+    add_common<forward_list_adapter<T>, T>(forward.cases);
+    add_front<forward_list_adapter<T>, T>(forward.cases);
+    add_middle<forward_list_adapter<T>, T>(forward.cases);
+    suites.push_back(forward);
+
+    suite list = { list_adapter<T>::name(), element<T>::name(), &list_adapter<T>::limit, {} };
+    add_common<list_adapter<T>, T>(list.cases);
+    add_back<list_adapter<T>, T>(list.cases);
+    add_front<list_adapter<T>, T>(list.cases);
+    add_middle<list_adapter<T>, T>(list.cases);
+    suites.push_back(list);
+
+    suite vector = { vector_adapter<T>::name(), element<T>::name(), &vector_adapter<T>::limit, {} };
+    add_common<vector_adapter<T>, T>(vector.cases);
+    add_back<vector_adapter<T>, T>(vector.cases);
+    add_middle<vector_adapter<T>, T>(vector.cases);
+    suites.push_back(vector);
+}
+
+#endif // LIST_CASES_H
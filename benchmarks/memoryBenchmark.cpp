@@ -0,0 +1,387 @@
+/*
+
+File: memoryBenchmark.cpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+Memory held per element by LinkedList, CompactLinkedList,
+VectorLinkedList, ConcurrentLinkedList and the std containers, for char, int, a 64 byte POD and std::string elements too long
+for the small string buffer. Each container is filled with push_back
+(push_front for std::forward_list) and the heap it then holds is read from
+heapTracker.hpp:
+
+    object_bytes       sizeof the container object
+    requested_bytes    heap bytes requested, values' own buffers included
+    allocated_bytes    the same as the allocator holds them, with its header
+                       and rounding
+    bytes_per_element  (object_bytes + allocated_bytes) / elements
+    memory_usage       what the list's memory_usage() reports, for the lists
+                       that have one
+
+--lists=N measures N lists of int instead, sized like adjacency lists: half
+of them empty, a quarter with one element, most of the rest with 2 to 4 and
+one in twenty with 5 to 16. Each list lives in a std::vector of N lists, and
+total_bytes is everything the vector and the lists hold, with the
+allocator's overhead.
+
+Usage: memoryBenchmark [--format=csv|json] [--max-size=N] [--filter=TEXT]
+                       [--lists=N]
+
+*/
+
+#include <cstdlib>
+#include <deque>
+#include <forward_list>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+#include "compactLinkedList.hpp"
+#include "concurrentLinkedList.hpp"
+#include "listCases.hpp"
+#include "vectorLinkedList.hpp"
+
+// Tracks the heap held by each container
+#define HEAP_TRACKER_HOOKS
+#include "heapTracker.hpp"
+
+template <>
+struct element<char>
+{
+    static const char* name() { return "char"; }
+    static char make(size_t i) { return static_cast<char>('a' + i % 26); }
+};
+
+struct memory_result
+{
+    std::string container;
+    std::string type;
+    size_t value_bytes;
+    size_t elements;
+    size_t object_bytes;
+    size_t requested_bytes;
+    size_t allocated_bytes;
+    long long memory_usage;
+
+    double per_element() const
+    {
+        return double(object_bytes + allocated_bytes) / double(elements);
+    }
+};
+
+/*****
+CONTAINERS
+*****/
+
+// add() puts one value in the container, usage() is its own estimate or -1
+// when it has none
+
+template <typename T>
+struct linked_list_memory
+{
+    typedef LinkedList<T> container;
+    static const char* name() { return "LinkedList"; }
+    static void add(container& list, const T& value) { list.push_back(value); }
+    static long long usage(const container& list) { return static_cast<long long>(list.memory_usage()); }
+};
+
+template <typename T>
+struct compact_list_memory
+{
+    typedef CompactLinkedList<T> container;
+    static const char* name() { return "CompactLinkedList"; }
+    static void add(container& list, const T& value) { list.push_back(value); }
+    static long long usage(const container& list) { return static_cast<long long>(list.memory_usage()); }
+};
+
+template <typename T>
+struct vector_list_memory
+{
+    typedef VectorLinkedList<T> container;
+    static const char* name() { return "VectorLinkedList"; }
+    static void add(container& list, const T& value) { list.push_back(value); }
+    static long long usage(const container& list) { return static_cast<long long>(list.memory_usage()); }
+};
+
+template <typename T>
+struct concurrent_list_memory
+{
+    typedef ConcurrentLinkedList<T> container;
+    static const char* name() { return "ConcurrentLinkedList"; }
+    static void add(container& list, const T& value) { list.push_back(value); }
+    static long long usage(const container& list) { return static_cast<long long>(list.memory_usage()); }
+};
+
+template <typename T>
+struct list_memory
+{
+    typedef std::list<T> container;
+    static const char* name() { return "std::list"; }
+    static void add(container& list, const T& value) { list.push_back(value); }
+    static long long usage(const container&) { return -1; }
+};
+
+template <typename T>
+struct forward_list_memory
+{
+    typedef std::forward_list<T> container;
+    static const char* name() { return "std::forward_list"; }
+    static void add(container& list, const T& value) { list.push_front(value); }
+    static long long usage(const container&) { return -1; }
+};
+
+template <typename T>
+struct vector_memory
+{
+    typedef std::vector<T> container;
+    static const char* name() { return "std::vector"; }
+    static void add(container& vector, const T& value) { vector.push_back(value); }
+    static long long usage(const container&) { return -1; }
+};
+
+template <typename T>
+struct deque_memory
+{
+    typedef std::deque<T> container;
+    static const char* name() { return "std::deque"; }
+    static void add(container& deque, const T& value) { deque.push_back(value); }
+    static long long usage(const container&) { return -1; }
+};
+
+/*****
+MEASURE
+*****/
+
+template <class Adapter, typename T>
+memory_result measure(const std::vector<T>& values)
+{
+    typedef typename Adapter::container container;
+
+    memory_result result = { Adapter::name(), element<T>::name(), sizeof(T), values.size(),
+                             sizeof(container), 0, 0, -1 };
+
+    const heap::totals before = heap::current();
+    {
+        container list;
+        for (const T& value : values)
+        {
+            Adapter::add(list, value);
+        }
+
+        result.requested_bytes = heap::current().live - before.live;
+        result.allocated_bytes = heap::current().blocks - before.blocks;
+        result.memory_usage = Adapter::usage(list);
+    }
+    return result;
+}
+
+template <typename T>
+void measure_all(size_t max_size, const std::string& filter, std::vector<memory_result>& results)
+{
+    for (size_t n = 1; n <= max_size; n *= 10)
+    {
+        std::vector<T> values = ascending<T>(n);
+        std::vector<memory_result> round;
+
+        round.push_back(measure<linked_list_memory<T>, T>(values));
+        round.push_back(measure<compact_list_memory<T>, T>(values));
+        round.push_back(measure<vector_list_memory<T>, T>(values));
+        round.push_back(measure<concurrent_list_memory<T>, T>(values));
+        round.push_back(measure<list_memory<T>, T>(values));
+        round.push_back(measure<forward_list_memory<T>, T>(values));
+        round.push_back(measure<vector_memory<T>, T>(values));
+        round.push_back(measure<deque_memory<T>, T>(values));
+
+        for (const memory_result& result : round)
+        {
+            if ((result.container + "/" + result.type).find(filter) != std::string::npos)
+            {
+                results.push_back(result);
+            }
+        }
+    }
+}
+
+/*****
+MANY LISTS
+*****/
+
+struct many_result
+{
+    std::string container;
+    size_t lists;
+    size_t elements;
+    size_t object_bytes;
+    size_t total_bytes;
+};
+
+// The number of elements of each list, mostly empty or tiny
+std::vector<size_t> list_sizes(size_t lists)
+{
+    std::mt19937 random(11);
+    std::uniform_int_distribution<int> percent(0, 99);
+    std::vector<size_t> sizes(lists);
+
+    for (size_t& size : sizes)
+    {
+        int pick = percent(random);
+        if (pick < 50)      { size = 0; }
+        else if (pick < 75) { size = 1; }
+        else if (pick < 95) { size = std::uniform_int_distribution<size_t>(2, 4)(random); }
+        else                { size = std::uniform_int_distribution<size_t>(5, 16)(random); }
+    }
+    return sizes;
+}
+
+template <class Adapter>
+many_result measure_many(const std::vector<size_t>& sizes)
+{
+    typedef typename Adapter::container container;
+
+    many_result result = { Adapter::name(), sizes.size(), 0, sizeof(container), 0 };
+
+    const heap::totals before = heap::current();
+    {
+        std::vector<container> lists(sizes.size());
+        for (size_t i = 0; i < sizes.size(); ++i)
+        {
+            for (size_t j = 0; j < sizes[i]; ++j)
+            {
+                Adapter::add(lists[i], static_cast<int>(j));
+            }
+            result.elements += sizes[i];
+        }
+        result.total_bytes = heap::current().blocks - before.blocks;
+    }
+    return result;
+}
+
+void write_many(std::ostream& out, const std::vector<many_result>& results, bool json)
+{
+    if (!json)
+    {
+        csv_row(out, "container", "lists", "elements", "object_bytes", "total_bytes", "bytes_per_list");
+    }
+    else
+    {
+        out << "[\n";
+    }
+
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const many_result& result = results[i];
+        double per_list = double(result.total_bytes) / double(result.lists);
+        if (!json)
+        {
+            csv_row(out, result.container, result.lists, result.elements, result.object_bytes,
+                    result.total_bytes, per_list);
+            continue;
+        }
+        out << "  {\"container\": \"" << result.container
+            << "\", \"lists\": " << result.lists
+            << ", \"elements\": " << result.elements
+            << ", \"object_bytes\": " << result.object_bytes
+            << ", \"total_bytes\": " << result.total_bytes
+            << ", \"bytes_per_list\": " << per_list
+            << ((i + 1 < results.size()) ? "},\n" : "}\n");
+    }
+
+    if (json) { out << "]\n"; }
+}
+
+/*****
+DRIVER
+*****/
+
+void write_results(std::ostream& out, const std::vector<memory_result>& results, bool json)
+{
+    if (!json)
+    {
+        csv_row(out, "container", "type", "value_bytes", "elements", "object_bytes",
+                "requested_bytes", "allocated_bytes", "bytes_per_element", "memory_usage");
+    }
+    else
+    {
+        out << "[\n";
+    }
+
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const memory_result& result = results[i];
+        std::string usage = (result.memory_usage < 0) ? "" : std::to_string(result.memory_usage);
+        if (!json)
+        {
+            csv_row(out, result.container, result.type, result.value_bytes, result.elements,
+                    result.object_bytes, result.requested_bytes, result.allocated_bytes,
+                    result.per_element(), usage);
+            continue;
+        }
+        out << "  {\"container\": \"" << result.container
+            << "\", \"type\": \"" << result.type
+            << "\", \"value_bytes\": " << result.value_bytes
+            << ", \"elements\": " << result.elements
+            << ", \"object_bytes\": " << result.object_bytes
+            << ", \"requested_bytes\": " << result.requested_bytes
+            << ", \"allocated_bytes\": " << result.allocated_bytes
+            << ", \"bytes_per_element\": " << result.per_element()
+            << ", \"memory_usage\": " << (usage.empty() ? "null" : usage)
+            << ((i + 1 < results.size()) ? "},\n" : "}\n");
+    }
+
+    if (json) { out << "]\n"; }
+}
+
+int main(int argc, char* argv[])
+{
+    bool json = false;
+    size_t max_size = 100000;
+    size_t lists = 0;
+    std::string filter;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        std::string value = arg.substr(arg.find('=') + 1);
+
+        if (arg == "--format=json")               { json = true; }
+        else if (arg == "--format=csv")           { json = false; }
+        else if (arg.find("--max-size=") == 0)    { max_size = std::strtoul(value.c_str(), nullptr, 10); }
+        else if (arg.find("--filter=") == 0)      { filter = value; }
+        else if (arg.find("--lists=") == 0)       { lists = std::strtoul(value.c_str(), nullptr, 10); }
+        else
+        {
+            std::cerr << "usage: memoryBenchmark [--format=csv|json] [--max-size=N] [--filter=TEXT]"
+                         " [--lists=N]\n";
+            return (arg == "--help") ? 0 : 2;
+        }
+    }
+
+    if (lists > 0)
+    {
+        std::vector<size_t> sizes = list_sizes(lists);
+        std::vector<many_result> many;
+        many.push_back(measure_many<linked_list_memory<int> >(sizes));
+        many.push_back(measure_many<compact_list_memory<int> >(sizes));
+        many.push_back(measure_many<list_memory<int> >(sizes));
+        many.push_back(measure_many<forward_list_memory<int> >(sizes));
+        many.push_back(measure_many<vector_memory<int> >(sizes));
+
+        write_many(std::cout, many, json);
+        return 0;
+    }
+
+    std::vector<memory_result> results;
+    measure_all<char>(max_size, filter, results);
+    measure_all<int>(max_size, filter, results);
+    measure_all<pod64>(max_size, filter, results);
+    measure_all<std::string>(max_size, filter, results);
+
+    write_results(std::cout, results, json);
+    return 0;
+}
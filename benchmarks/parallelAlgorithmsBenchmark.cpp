@@ -0,0 +1,113 @@
+/*
+
+File: parallelAlgorithmsBenchmark.cpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+Scaling benchmark for the parallel list algorithms. Every operation is timed
+once sequentially through the std algorithms (threads = 0) and then on pools of
+1, 2, 4, ... up to max_threads workers.
+
+Usage: parallelAlgorithmsBenchmark [elements] [max_threads]
+
+*/
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <numeric>
+#include <string>
+#include "benchmark.hpp"
+#include "linkedList.hpp"
+
+typedef LinkedList<long> list_type;
+
+void report(const std::string& operation, size_t threads, size_t elements, double seconds)
+{
+    csv_row(std::cout, operation, threads, elements, seconds, elements / seconds);
+}
+
+void sequential(list_type& list, size_t elements)
+{
+    Stopwatch timer;
+    std::for_each(list.begin(), list.end(), [](long& value) { ++value; });
+    report("for_each", 0, elements, timer.elapsed());
+
+    timer.restart();
+    std::transform(list.begin(), list.end(), list.begin(), [](long value) { return value - 1; });
+    report("transform", 0, elements, timer.elapsed());
+
+    timer.restart();
+    do_not_optimize(std::accumulate(list.begin(), list.end(), 0L));
+    report("reduce", 0, elements, timer.elapsed());
+
+    timer.restart();
+    do_not_optimize(std::count_if(list.begin(), list.end(), [](long value) { return value % 3 == 0; }));
+    report("count_if", 0, elements, timer.elapsed());
+
+    timer.restart();
+    do_not_optimize(std::any_of(list.begin(), list.end(), [](long value) { return value < 0; }));
+    report("any_of", 0, elements, timer.elapsed());
+}
+
+void parallel(list_type& list, size_t elements, size_t threads)
+{
+    ThreadPool pool(threads);
+    const execution::parallel_policy policy = execution::par.on(pool);
+
+    Stopwatch timer;
+    list.for_each(policy, [](long& value) { ++value; });
+    report("for_each", threads, elements, timer.elapsed());
+
+    timer.restart();
+    list.transform(policy, [](long value) { return value - 1; });
+    report("transform", threads, elements, timer.elapsed());
+
+    timer.restart();
+    do_not_optimize(list.reduce(policy, 0L, std::plus<long>()));
+    report("reduce", threads, elements, timer.elapsed());
+
+    timer.restart();
+    do_not_optimize(list.transform_reduce(policy, 0L, std::plus<long>(),
+                    [](long value) { return value * value; }));
+    report("transform_reduce", threads, elements, timer.elapsed());
+
+    timer.restart();
+    do_not_optimize(list.count_if(policy, [](long value) { return value % 3 == 0; }));
+    report("count_if", threads, elements, timer.elapsed());
+
+    timer.restart();
+    do_not_optimize(list.any_of(policy, [](long value) { return value < 0; }));
+    report("any_of", threads, elements, timer.elapsed());
+
+    timer.restart();
+    do_not_optimize(list.all_of(policy, [](long value) { return value >= 0; }));
+    report("all_of", threads, elements, timer.elapsed());
+}
+
+int main(int argc, char* argv[])
+{
+    size_t elements = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000000;
+    size_t max_threads = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 64;
+
+    list_type list;
+    for (size_t i = 0; i < elements; ++i)
+    {
+        list.push_back(static_cast<long>(i));
+    }
+
+    csv_row(std::cout, "operation", "threads", "elements", "seconds", "elements_per_second");
+
+    sequential(list, elements);
+    for (size_t threads = 1; threads <= max_threads; threads *= 2)
+    {
+        parallel(list, elements, threads);
+    }
+    return 0;
+}
@@ -0,0 +1,82 @@
+/*
+
+File: parallelCleanupBenchmark.cpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+Benchmark for the cleanup passes, remove_if removing half of the elements and
+unique on a list where every value appears about eight times. Sequential runs
+are reported as threads = 0.
+
+Usage: parallelCleanupBenchmark [elements] [max_threads]
+
+*/
+
+#include <cstdlib>
+#include <string>
+#include "benchmark.hpp"
+#include "linkedList.hpp"
+
+typedef LinkedList<long> list_type;
+
+void fill(list_type& list, size_t elements, long distinct)
+{
+    list = list_type();
+    for (size_t i = 0; i < elements; ++i)
+    {
+        list.push_back(static_cast<long>(i) % distinct);
+    }
+}
+
+void report(const std::string& operation, size_t threads, size_t elements, double seconds)
+{
+    csv_row(std::cout, operation, threads, elements, seconds, elements / seconds);
+}
+
+int main(int argc, char* argv[])
+{
+    size_t elements = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000000;
+    size_t max_threads = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 64;
+
+    const long all_distinct = static_cast<long>(elements);
+    const long eighth = static_cast<long>(elements / 8 + 1);
+    auto odd = [](long value) { return value % 2 != 0; };
+
+    list_type list;
+    Stopwatch timer;
+
+    csv_row(std::cout, "operation", "threads", "elements", "seconds", "elements_per_second");
+
+    fill(list, elements, all_distinct);
+    timer.restart();
+    list.remove_if(odd);
+    report("remove_if", 0, elements, timer.elapsed());
+
+    fill(list, elements, eighth);
+    timer.restart();
+    list.unique();
+    report("unique", 0, elements, timer.elapsed());
+
+    for (size_t threads = 1; threads <= max_threads; threads *= 2)
+    {
+        ThreadPool pool(threads);
+        const execution::parallel_policy policy = execution::par.on(pool);
+
+        fill(list, elements, all_distinct);
+        timer.restart();
+        list.remove_if(policy, odd);
+        report("remove_if", threads, elements, timer.elapsed());
+
+        fill(list, elements, eighth);
+        timer.restart();
+        list.unique(policy);
+        report("unique", threads, elements, timer.elapsed());
+    }
+    return 0;
+}
@@ -0,0 +1,90 @@
+/*
+
+File: parallelFindBenchmark.cpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+Benchmark for find_if(par, pred). A cheap and an expensive predicate are run
+with the only match placed early (1%), late (99%) or absent, sequentially
+(threads = 0) and on pools of 1, 2, 4, ... up to max_threads workers.
+
+Usage: parallelFindBenchmark [elements] [max_threads]
+
+*/
+
+#include <cstdlib>
+#include <string>
+#include "benchmark.hpp"
+#include "linkedList.hpp"
+
+typedef LinkedList<long> list_type;
+
+// Stands in for a costly validation, a few hundred dependent multiplies
+bool expensive_match(long value, long target)
+{
+    unsigned long hash = static_cast<unsigned long>(value);
+    for (int i = 0; i < 256; ++i)
+    {
+        hash = hash * 6364136223846793005UL + 1442695040888963407UL;
+    }
+    do_not_optimize(hash);
+    return value == target;
+}
+
+template <class Predicate>
+void run(list_type& list, const std::string& predicate, const std::string& match,
+         size_t elements, size_t max_threads, Predicate pred)
+{
+    Stopwatch timer;
+    do_not_optimize(list.find_if(pred));
+    double seconds = timer.elapsed();
+    csv_row(std::cout, predicate, match, 0, elements, seconds, elements / seconds);
+
+    for (size_t threads = 1; threads <= max_threads; threads *= 2)
+    {
+        ThreadPool pool(threads);
+
+        timer.restart();
+        do_not_optimize(list.find_if(execution::par.on(pool), pred));
+        seconds = timer.elapsed();
+        csv_row(std::cout, predicate, match, threads, elements, seconds, elements / seconds);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    size_t elements = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000000;
+    size_t max_threads = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 64;
+
+    list_type list;
+    for (size_t i = 0; i < elements; ++i)
+    {
+        list.push_back(static_cast<long>(i));
+    }
+
+    struct placement { const char* name; long target; };
+    const placement placements[] = {
+        { "early", static_cast<long>(elements / 100) },
+        { "late", static_cast<long>(elements - elements / 100 - 1) },
+        { "absent", -1 }
+    };
+
+    csv_row(std::cout, "predicate", "match", "threads", "elements", "seconds", "elements_per_second");
+    for (const placement& place : placements)
+    {
+        long target = place.target;
+
+        run(list, "cheap", place.name, elements, max_threads,
+            [target](long value) { return value == target; });
+
+        run(list, "expensive", place.name, elements, max_threads,
+            [target](long value) { return expensive_match(value, target); });
+    }
+    return 0;
+}
@@ -0,0 +1,194 @@
+/*
+
+File: perfCounters.hpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+/*
+Hardware performance counters read through Linux perf_event_open. Every event
+is opened on its own, so a machine or container that lacks some of them still
+reports the others. Where perf_event_open is missing or refused, for example
+with kernel.perf_event_paranoid set high or under a seccomp profile, and on
+systems other than Linux, available() is false and every event reads as
+unavailable.
+
+    PerfCounters counters;
+    counters.start();
+    ...
+    counter_values events = counters.stop();
+*/
+
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+#include <cstdint>
+#include <string>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+enum counter_event
+{
+    cycles,
+    instructions,
+    l1d_misses,
+    llc_misses,
+    dtlb_misses,
+    branch_misses,
+    counter_event_count
+};
+
+inline const char* counter_name(counter_event event)
+{
+    static const char* names[counter_event_count] = {
+        "cycles", "instructions", "l1d_misses", "llc_misses", "dtlb_misses", "branch_misses"
+    };
+    return names[event];
+}
+
+// Event counts over one measured region, negative where an event is unavailable
+struct counter_values
+{
+    counter_values() { for (double& value : values) { value = -1; } }
+
+    bool any() const
+    {
+        for (double value : values)
+        {
+            if (value >= 0) { return true; }
+        }
+        return false;
+    }
+
+    double values[counter_event_count];
+};
+
+class PerfCounters
+{
+public:
+
+    PerfCounters()
+    {
+        for (int& fd : fds) { fd = -1; }
+#if defined(__linux__)
+        open(cycles, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+        open(instructions, PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+        open(l1d_misses, PERF_TYPE_HW_CACHE, cache_miss(PERF_COUNT_HW_CACHE_L1D));
+        open(llc_misses, PERF_TYPE_HW_CACHE, cache_miss(PERF_COUNT_HW_CACHE_LL));
+        open(dtlb_misses, PERF_TYPE_HW_CACHE, cache_miss(PERF_COUNT_HW_CACHE_DTLB));
+        open(branch_misses, PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+#else
+        error = "perf_event_open is only available on Linux";
+#endif
+    }
+
+    ~PerfCounters()
+    {
+#if defined(__linux__)
+        for (int fd : fds)
+        {
+            if (fd != -1) { close(fd); }
+        }
+#endif
+    }
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    // True when at least one event could be opened
+    bool available() const
+    {
+        for (int fd : fds)
+        {
+            if (fd != -1) { return true; }
+        }
+        return false;
+    }
+
+    // Why the first event that failed to open was refused
+    const std::string& reason() const { return error; }
+
+    void start()
+    {
+#if defined(__linux__)
+        for (int fd : fds)
+        {
+            if (fd == -1) { continue; }
+            ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    // Counts since start(), scaled up when the kernel multiplexed an event
+    counter_values stop()
+    {
+        counter_values events;
+#if defined(__linux__)
+        for (int fd : fds)
+        {
+            if (fd != -1) { ioctl(fd, PERF_EVENT_IOC_DISABLE, 0); }
+        }
+        for (int event = 0; event < counter_event_count; ++event)
+        {
+            // value, time enabled, time running
+            std::uint64_t read_format[3] = { 0, 0, 0 };
+            if (fds[event] == -1 || read(fds[event], read_format, sizeof(read_format)) != sizeof(read_format))
+            {
+                continue;
+            }
+            events.values[event] = (read_format[2] == 0)
+                ? 0 : double(read_format[0]) * read_format[1] / read_format[2];
+        }
+#endif
+        return events;
+    }
+
+private:
+
+#if defined(__linux__)
+    static std::uint64_t cache_miss(std::uint64_t cache)
+    {
+        return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    }
+
+    void open(counter_event event, std::uint32_t type, std::uint64_t config)
+    {
+        perf_event_attr attributes;
+        std::memset(&attributes, 0, sizeof(attributes));
+        attributes.size = sizeof(attributes);
+        attributes.type = type;
+        attributes.config = config;
+        attributes.disabled = 1;
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv = 1;
+        attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        // this process, any CPU, no group
+        fds[event] = static_cast<int>(syscall(__NR_perf_event_open, &attributes, 0, -1, -1, 0));
+        if (fds[event] == -1 && error.empty())
+        {
+            error = std::string(counter_name(event)) + ": " + std::strerror(errno);
+        }
+    }
+#endif
+
+    int fds[counter_event_count];
+    std::string error;
+};
+
+#endif // PERF_COUNTERS_H
@@ -0,0 +1,376 @@
+/*
+
+File: perfGate.cpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+Performance regression gate for LinkedList. Every LinkedList case of
+listBenchmark is run a number of times next to the same case on std::list,
+and the time of LinkedList relative to std::list is compared against a
+checked-in baseline. The ratio rather than the raw time is kept so the
+baseline holds on machines faster or slower than the one that recorded it.
+
+Every repetition times both cases in batches, until min-time seconds were
+timed or the number of batches ran, and keeps the fastest batch of each,
+which drops the batches a page fault, an interrupt or the allocator slowed
+down. The ratio of a case is the median of its repetitions. A case regresses
+when the lower end of the 95% confidence interval of that median lies more
+than the threshold above the baseline ratio. The gate prints a report of
+every case and exits with 1 when any case regressed.
+
+Usage: perfGate [--baseline=PATH] [--update] [--size=N] [--repetitions=N]
+                [--threshold=FRACTION] [--min-time=SECONDS] [--batches=N]
+                [--filter=TEXT]
+
+--update writes the measured ratios to the baseline instead of comparing.
+
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "listCases.hpp"
+
+struct options
+{
+    options()
+        : baseline("benchmarks/baseline.json"), update(false), size(10000), repetitions(11),
+          threshold(0.5), min_time(0.01), batches(20), budget(1000000) {}
+
+    std::string baseline;
+    bool update;
+    size_t size;
+    size_t repetitions;
+    double threshold;
+    double min_time;
+    size_t batches;
+    size_t budget;
+    std::string filter;
+};
+
+// One LinkedList case and its std::list counterpart
+struct gate_case
+{
+    std::string type;
+    std::string operation;
+    const benchmark_case* linked;
+    const benchmark_case* reference;
+
+    std::string key() const { return type + "/" + operation; }
+};
+
+struct measurement
+{
+    double median;
+    double low;     // the 95% confidence interval of the median
+    double high;
+    double linked_ns;
+    double reference_ns;
+};
+
+/*******************************************************************************
+STATISTICS
+*******************************************************************************/
+
+double median(std::vector<double> samples)
+{
+    std::sort(samples.begin(), samples.end());
+    size_t middle = samples.size() / 2;
+    return (samples.size() % 2 != 0) ? samples[middle] : (samples[middle - 1] + samples[middle]) / 2;
+}
+
+// The widest k such that the k-th smallest and k-th largest of n samples
+// bound their median with at least 95% confidence. Counts the samples below
+// the median like a fair coin, so it holds whatever their distribution.
+size_t median_rank(size_t n)
+{
+    double tail = std::pow(0.5, double(n));
+    double probability = tail;  // chance that fewer than k samples fall below
+    size_t k = 0;
+    for (size_t below = 0; below < n / 2 && 2 * probability <= 0.05; ++below)
+    {
+        k = below + 1;
+        tail = tail * (n - below) / (below + 1);
+        probability += tail;
+    }
+    return k;
+}
+
+/*******************************************************************************
+MEASUREMENT
+*******************************************************************************/
+
+// Nanoseconds per op of the fastest batch of a case, batches are run until
+// min_time seconds were timed or there were batches of them. The cap bounds
+// cases whose setup takes far longer than the part that is timed.
+double nanoseconds(const benchmark_case& test, const options& opts)
+{
+    double seconds = 0;
+    double fastest = 0;
+    for (size_t batch = 0; batch < opts.batches && seconds < opts.min_time; ++batch)
+    {
+        sample run;
+        size_t ops = test.run(opts.size, opts.budget, run);
+        seconds += run.seconds;
+
+        double ns = run.seconds * 1e9 / ops;
+        if (fastest == 0 || ns < fastest) { fastest = ns; }
+    }
+    return fastest;
+}
+
+measurement measure(const gate_case& test, const options& opts)
+{
+    std::vector<double> ratios;
+    std::vector<double> linked;
+    std::vector<double> reference;
+
+    // Interleaved so drift in the machine's speed affects both alike
+    for (size_t i = 0; i < opts.repetitions; ++i)
+    {
+        linked.push_back(nanoseconds(*test.linked, opts));
+        reference.push_back(nanoseconds(*test.reference, opts));
+        ratios.push_back(linked.back() / reference.back());
+    }
+
+    // Too few repetitions for a 95% interval leave it the whole range
+    std::sort(ratios.begin(), ratios.end());
+    size_t k = std::max<size_t>(1, median_rank(ratios.size()));
+    return { median(ratios), ratios[k - 1], ratios[ratios.size() - k], median(linked), median(reference) };
+}
+
+const benchmark_case* find_case(const suite& cases, const std::string& operation)
+{
+    for (const benchmark_case& test : cases.cases)
+    {
+        if (test.operation == operation) { return &test; }
+    }
+    return nullptr;
+}
+
+void collect(const std::vector<suite>& suites, const options& opts, std::vector<gate_case>& cases)
+{
+    const suite* linked = nullptr;
+    for (const suite& current : suites)
+    {
+        if (current.container == linked_list_adapter<int>::name()) { linked = &current; }
+        if (current.container != list_adapter<int>::name() || linked == nullptr) { continue; }
+
+        // suites of one element type are added LinkedList first
+        for (const benchmark_case& test : linked->cases)
+        {
+            gate_case entry = { current.type, test.operation, &test, find_case(current, test.operation) };
+
+            if (entry.reference == nullptr || opts.size > linked->limit(test.operation)) { continue; }
+            if (entry.key().find(opts.filter) == std::string::npos) { continue; }
+            cases.push_back(entry);
+        }
+    }
+}
+
+/*******************************************************************************
+BASELINE
+*******************************************************************************/
+
+struct baseline_entry
+{
+    size_t size;
+    double ratio;
+};
+
+typedef std::map<std::string, baseline_entry> baseline_map;
+
+// Reads the objects written by write_baseline, each a flat set of string and
+// number fields. Returns false when the file cannot be opened.
+bool read_baseline(const std::string& path, baseline_map& baseline)
+{
+    std::ifstream file(path.c_str());
+    if (!file) { return false; }
+
+    std::stringstream text;
+    text << file.rdbuf();
+    std::string json = text.str();
+
+    for (size_t open = json.find('{', 1); open != std::string::npos; open = json.find('{', open + 1))
+    {
+        std::string object = json.substr(open + 1, json.find('}', open) - open - 1);
+        std::map<std::string, std::string> fields;
+
+        std::stringstream pairs(object);
+        std::string pair;
+        while (std::getline(pairs, pair, ','))
+        {
+            size_t colon = pair.find(':');
+            if (colon == std::string::npos) { continue; }
+
+            std::string key = pair.substr(0, colon);
+            std::string value = pair.substr(colon + 1);
+            key = key.substr(key.find('"') + 1, key.rfind('"') - key.find('"') - 1);
+            value.erase(0, value.find_first_not_of(" \t\n\""));
+            value.erase(value.find_last_not_of(" \t\n\"") + 1);
+            fields[key] = value;
+        }
+
+        baseline_entry entry = { std::strtoul(fields["size"].c_str(), nullptr, 10),
+                                 std::strtod(fields["ratio"].c_str(), nullptr) };
+        baseline[fields["type"] + "/" + fields["operation"]] = entry;
+    }
+    return true;
+}
+
+bool write_baseline(const std::string& path, const std::vector<gate_case>& cases,
+                    const std::vector<measurement>& results, const options& opts)
+{
+    std::ofstream file(path.c_str());
+    if (!file) { return false; }
+
+    file << "{\n  \"reference\": \"" << list_adapter<int>::name() << "\",\n  \"cases\": [\n";
+    for (size_t i = 0; i < cases.size(); ++i)
+    {
+        file << "    {\"type\": \"" << cases[i].type
+             << "\", \"operation\": \"" << cases[i].operation
+             << "\", \"size\": " << opts.size
+             << ", \"ratio\": " << results[i].median
+             << ((i + 1 < cases.size()) ? "},\n" : "}\n");
+    }
+    file << "  ]\n}\n";
+    return true;
+}
+
+/*******************************************************************************
+DRIVER
+*******************************************************************************/
+
+bool parse(int argc, char* argv[], options& opts)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        std::string value = arg.substr(arg.find('=') + 1);
+
+        if (arg == "--update")                     { opts.update = true; }
+        else if (arg.find("--baseline=") == 0)     { opts.baseline = value; }
+        else if (arg.find("--size=") == 0)         { opts.size = std::strtoul(value.c_str(), nullptr, 10); }
+        else if (arg.find("--repetitions=") == 0)  { opts.repetitions = std::strtoul(value.c_str(), nullptr, 10); }
+        else if (arg.find("--threshold=") == 0)    { opts.threshold = std::strtod(value.c_str(), nullptr); }
+        else if (arg.find("--min-time=") == 0)     { opts.min_time = std::strtod(value.c_str(), nullptr); }
+        else if (arg.find("--batches=") == 0)      { opts.batches = std::strtoul(value.c_str(), nullptr, 10); }
+        else if (arg.find("--filter=") == 0)       { opts.filter = value; }
+        else if (arg == "--help")                  { return false; }
+        else
+        {
+            std::cerr << "unknown argument " << arg << '\n';
+            return false;
+        }
+    }
+    return opts.size > 1 && opts.repetitions > 0 && opts.batches > 0;
+}
+
+int main(int argc, char* argv[])
+{
+    options opts;
+    if (!parse(argc, argv, opts))
+    {
+        std::cerr << "usage: perfGate [--baseline=PATH] [--update] [--size=N] [--repetitions=N]"
+                     " [--threshold=FRACTION] [--min-time=SECONDS] [--batches=N] [--filter=TEXT]\n";
+        return 2;
+    }
+
+    baseline_map baseline;
+    if (!opts.update && !read_baseline(opts.baseline, baseline))
+    {
+        std::cerr << "perfGate: cannot read the baseline " << opts.baseline << '\n';
+        return 2;
+    }
+
+    std::vector<suite> suites;
+    add_suites<int>(suites);
+    add_suites<std::string>(suites);
+
+    std::vector<gate_case> cases;
+    collect(suites, opts, cases);
+
+    std::cout << "perfGate: LinkedList against " << list_adapter<int>::name() << ", "
+              << cases.size() << " cases of " << opts.size << " elements, "
+              << opts.repetitions << " repetitions, threshold " << opts.threshold * 100 << "%\n\n"
+              << std::left << std::setw(36) << "case" << std::right
+              << std::setw(12) << "LinkedList" << std::setw(12) << "reference"
+              << std::setw(10) << "baseline" << std::setw(30) << "ratio (95% CI)"
+              << std::setw(10) << "change" << "\n";
+
+    std::vector<measurement> results;
+    std::vector<std::string> regressions;
+    std::cout << std::fixed;
+    for (const gate_case& test : cases)
+    {
+        measurement result = measure(test, opts);
+        results.push_back(result);
+
+        std::ostringstream ratio;
+        ratio << std::fixed << std::setprecision(2) << result.median
+              << " [" << result.low << ", " << result.high << "]";
+
+        std::cout << std::left << std::setw(36) << test.key() << std::right << std::setprecision(1)
+                  << std::setw(10) << result.linked_ns << "ns" << std::setw(10) << result.reference_ns << "ns";
+
+        baseline_map::const_iterator expected = baseline.find(test.key());
+        if (opts.update || expected == baseline.end() || expected->second.size != opts.size)
+        {
+            std::cout << std::setw(10) << "-" << std::setw(30) << ratio.str()
+                      << std::setw(10) << "-" << (opts.update ? "\n" : "  new\n");
+            continue;
+        }
+
+        double change = result.median / expected->second.ratio - 1;
+        bool regressed = result.low > expected->second.ratio * (1 + opts.threshold);
+
+        std::cout << std::setprecision(2) << std::setw(10) << expected->second.ratio
+                  << std::setw(30) << ratio.str() << std::showpos << std::setprecision(1)
+                  << std::setw(9) << change * 100 << "%" << std::noshowpos
+                  << (regressed ? "  REGRESSION\n" : "\n");
+
+        if (regressed)
+        {
+            std::ostringstream line;
+            line << std::fixed << std::setprecision(2) << test.key() << " is " << result.median
+                 << " times as slow as the reference, the baseline is " << expected->second.ratio;
+            regressions.push_back(line.str());
+        }
+    }
+
+    if (opts.update)
+    {
+        if (!write_baseline(opts.baseline, cases, results, opts))
+        {
+            std::cerr << "perfGate: cannot write the baseline " << opts.baseline << '\n';
+            return 2;
+        }
+        std::cout << "\nbaseline written to " << opts.baseline << '\n';
+        return 0;
+    }
+
+    if (regressions.empty())
+    {
+        std::cout << "\nno case regressed past the threshold\n";
+        return 0;
+    }
+
+    std::cout << '\n' << regressions.size() << " case(s) regressed past the threshold:\n";
+    for (const std::string& regression : regressions)
+    {
+        std::cout << "  " << regression << '\n';
+    }
+    return 1;
+}
@@ -0,0 +1,210 @@
+/*
+
+File: positionBenchmark.cpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+Positional access to a LinkedList<int> of 1000, 100000 and 1000000
+elements, through at(), insert_at() and erase_at() and, as the baseline,
+through begin() advanced with operator+= from the head on every access:
+
+    read/sequential      read the elements from the middle of the list on
+    read/random          read elements at random positions
+    insert_erase/random  insert an element at a random position and erase it
+                         again
+
+The container column is LinkedList::at for the positional API and
+LinkedList+= for the baseline. Every repetition starts from a fresh list,
+so its first positional access walks from the head like the baseline does.
+ops is the number of accesses and ns_per_op the time per access.
+
+Usage: positionBenchmark [--format=csv|json] [--repetitions=N]
+                         [--accesses=N] [--filter=TEXT]
+
+--accesses is the number of accesses per operation and repetition, 1000 by
+default.
+
+*/
+
+#include <cstdlib>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+#include "benchmark.hpp"
+#include "linkedList.hpp"
+
+// Counts the allocations of every measured region
+#define ALLOCATION_COUNTER_HOOKS
+#include "allocationCounter.hpp"
+
+struct options
+{
+    bool json;
+    size_t repetitions;
+    size_t accesses;
+    std::string filter;
+};
+
+typedef LinkedList<int>::const_iterator const_iterator;
+
+/*****
+ACCESSES
+*****/
+
+// Each access returns a value so the walks cannot be optimized away
+
+struct positional
+{
+    static const char* name() { return "LinkedList::at"; }
+
+    static int read(LinkedList<int>& list, size_t i) { return list.at(i); }
+
+    static int insert_erase(LinkedList<int>& list, size_t i)
+    {
+        int value = *list.insert_at(i, -1);
+        list.erase_at(i);
+        return value;
+    }
+};
+
+struct advanced
+{
+    static const char* name() { return "LinkedList+="; }
+
+    static int read(LinkedList<int>& list, size_t i)
+    {
+        const_iterator it = list.cbegin();
+        it += i;
+        return *it;
+    }
+
+    // insert() adds after its position, so the node before i is found
+    static int insert_erase(LinkedList<int>& list, size_t i)
+    {
+        if (i == 0)
+        {
+            list.push_front(-1);
+            list.pop_front();
+            return -1;
+        }
+
+        const_iterator position = list.cbegin();
+        position += i - 1;
+        list.insert(position, -1);
+
+        LinkedList<int>::iterator inserted = list.begin();
+        std::advance(inserted, i);
+        int value = *inserted;
+        list.erase(inserted);
+        return value;
+    }
+};
+
+/*****
+DRIVER
+*****/
+
+std::vector<size_t> positions(const std::string& pattern, size_t size, size_t accesses)
+{
+    std::vector<size_t> result;
+    std::mt19937 random(7);
+    for (size_t i = 0; i < accesses; ++i)
+    {
+        result.push_back((pattern == "sequential") ? (size / 2 + i) % size : random() % size);
+    }
+    return result;
+}
+
+template <typename Access>
+void run(const std::string& operation, int (*access)(LinkedList<int>&, size_t), size_t size,
+         const options& opts, std::vector<benchmark_result>& results)
+{
+    std::string name = std::string(Access::name()) + "/int/" + operation;
+    if (name.find(opts.filter) == std::string::npos) { return; }
+
+    const std::vector<size_t> at = positions(operation.substr(operation.find('/') + 1),
+                                             size, opts.accesses);
+
+    for (size_t repetition = 0; repetition < opts.repetitions; ++repetition)
+    {
+        LinkedList<int> list;
+        for (size_t i = 0; i < size; ++i)
+        {
+            list.push_back(static_cast<int>(i));
+        }
+
+        sample measured;
+        SampleTimer timer(measured);
+        long long sum = 0;
+        for (size_t i : at)
+        {
+            sum += access(list, i);
+        }
+        do_not_optimize(sum);
+        timer.stop();
+
+        benchmark_result result = { Access::name(), "int", operation, size, repetition,
+                                    at.size(), measured.seconds, measured.events,
+                                    measured.allocations };
+        results.push_back(result);
+    }
+}
+
+template <typename Access>
+void run_all(size_t size, const options& opts, std::vector<benchmark_result>& results)
+{
+    run<Access>("read/sequential", Access::read, size, opts, results);
+    run<Access>("read/random", Access::read, size, opts, results);
+    run<Access>("insert_erase/random", Access::insert_erase, size, opts, results);
+}
+
+int main(int argc, char* argv[])
+{
+    options opts = { false, 3, 1000, "" };
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        std::string value = arg.substr(arg.find('=') + 1);
+
+        if (arg == "--format=json")                { opts.json = true; }
+        else if (arg == "--format=csv")            { opts.json = false; }
+        else if (arg.find("--repetitions=") == 0)  { opts.repetitions = std::strtoul(value.c_str(), nullptr, 10); }
+        else if (arg.find("--accesses=") == 0)     { opts.accesses = std::strtoul(value.c_str(), nullptr, 10); }
+        else if (arg.find("--filter=") == 0)       { opts.filter = value; }
+        else
+        {
+            std::cerr << "usage: positionBenchmark [--format=csv|json] [--repetitions=N]"
+                         " [--accesses=N] [--filter=TEXT]\n";
+            return (arg == "--help") ? 0 : 2;
+        }
+    }
+
+    std::vector<benchmark_result> results;
+    for (size_t size : { 1000, 100000, 1000000 })
+    {
+        run_all<positional>(size, opts, results);
+        run_all<advanced>(size, opts, results);
+    }
+
+    report_columns columns = { false, true };
+    if (opts.json)
+    {
+        write_json(std::cout, results, columns);
+        return 0;
+    }
+
+    write_csv_header(std::cout, columns);
+    for (const benchmark_result& result : results)
+    {
+        write_csv(std::cout, result, columns);
+    }
+    return 0;
+}
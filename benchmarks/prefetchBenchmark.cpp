@@ -0,0 +1,246 @@
+/*
+
+File: prefetchBenchmark.cpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+The walks of LinkedList<int> with the prefetch hints of prefetch.hpp, on
+lists of 1000, 100000 and 1000000 elements whose nodes are scattered over
+the heap by sorting them on a scrambled key:
+
+    find_if   find_if the last element
+    equal     compare the list with an equal copy, scattered the same way
+    size      count the elements
+    copy      copy construct the list and destroy the copy
+    clear     clear a scattered list
+
+This file turns the hints on. Built with -DPREFETCH_BASELINE, as
+prefetchBenchmarkBaseline, it runs the same walks without them, and the
+container column tells the two apart. ops is the number of elements an
+operation processed and ns_per_op the time per element.
+
+Usage: prefetchBenchmark [--format=csv|json] [--repetitions=N]
+                         [--budget=N] [--filter=TEXT]
+
+--budget bounds the elements walked per operation and repetition.
+
+*/
+
+#if !defined(PREFETCH_BASELINE)
+#define LINKED_LIST_PREFETCH
+#endif
+
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include "benchmark.hpp"
+#include "linkedList.hpp"
+
+// Counts the allocations of every measured region
+#define ALLOCATION_COUNTER_HOOKS
+#include "allocationCounter.hpp"
+
+#if defined(LINKED_LIST_PREFETCH)
+const char* const container = "LinkedList+prefetch";
+#else
+const char* const container = "LinkedList";
+#endif
+
+struct options
+{
+    bool json;
+    size_t repetitions;
+    size_t budget;
+    std::string filter;
+};
+
+// A list of the values 0 to size - 1 in a scrambled order, the nodes were
+// allocated in value order so every link jumps across the heap
+LinkedList<int> scattered(size_t size)
+{
+    LinkedList<int> list;
+    for (size_t i = 0; i < size; ++i)
+    {
+        list.push_back(static_cast<int>(i));
+    }
+
+    const long long scale = 7919;
+    const long long modulus = static_cast<long long>(size);
+    list.sort([scale, modulus](int lhs, int rhs)
+    {
+        return (lhs * scale) % modulus < (rhs * scale) % modulus;
+    });
+    return list;
+}
+
+/*****
+OPERATIONS
+*****/
+
+// Each walks the list calls times and returns the elements processed
+
+size_t find_last(LinkedList<int>& list, size_t size, size_t calls)
+{
+    int last = 0;
+    for (int value : list) { last = value; }
+
+    for (size_t i = 0; i < calls; ++i)
+    {
+        LinkedList<int>::iterator found = list.find_if([last](int value) { return value == last; });
+        do_not_optimize(found);
+    }
+    return calls * size;
+}
+
+size_t equal(LinkedList<int>& list, size_t size, size_t calls)
+{
+    LinkedList<int> same = scattered(size);
+
+    bool equal = true;
+    for (size_t i = 0; i < calls; ++i)
+    {
+        equal = equal && (list == same);
+        do_not_optimize(equal);
+    }
+    return calls * size;
+}
+
+size_t count(LinkedList<int>& list, size_t size, size_t calls)
+{
+    for (size_t i = 0; i < calls; ++i)
+    {
+        size_t counted = list.size();
+        do_not_optimize(counted);
+    }
+    return calls * size;
+}
+
+size_t copy(LinkedList<int>& list, size_t size, size_t calls)
+{
+    for (size_t i = 0; i < calls; ++i)
+    {
+        LinkedList<int> copied(list);
+        do_not_optimize(*copied.begin());
+    }
+    return calls * size;
+}
+
+/*****
+DRIVER
+*****/
+
+bool selected(const std::string& operation, const options& opts)
+{
+    return (std::string(container) + "/int/" + operation).find(opts.filter) != std::string::npos;
+}
+
+void record(const char* operation, size_t size, size_t repetition, size_t ops,
+            const sample& measured, std::vector<benchmark_result>& results)
+{
+    benchmark_result result = { container, "int", operation, size, repetition,
+                                ops, measured.seconds, measured.events, measured.allocations };
+    results.push_back(result);
+}
+
+void run(const char* operation, size_t (*walk)(LinkedList<int>&, size_t, size_t), size_t size,
+         const options& opts, std::vector<benchmark_result>& results)
+{
+    if (!selected(operation, opts)) { return; }
+
+    const size_t calls = std::max<size_t>(1, opts.budget / size);
+
+    for (size_t repetition = 0; repetition < opts.repetitions; ++repetition)
+    {
+        LinkedList<int> list = scattered(size);
+
+        sample measured;
+        SampleTimer timer(measured);
+        size_t ops = walk(list, size, calls);
+        timer.stop();
+
+        record(operation, size, repetition, ops, measured, results);
+    }
+}
+
+// clear destroys its list, so every call needs a scattered list of its own
+void run_clear(size_t size, const options& opts, std::vector<benchmark_result>& results)
+{
+    if (!selected("clear", opts)) { return; }
+
+    const size_t calls = std::max<size_t>(1, opts.budget / size);
+
+    for (size_t repetition = 0; repetition < opts.repetitions; ++repetition)
+    {
+        sample total = sample();
+        for (size_t i = 0; i < calls; ++i)
+        {
+            LinkedList<int> list = scattered(size);
+
+            sample measured;
+            SampleTimer timer(measured);
+            list.clear();
+            timer.stop();
+
+            total.seconds += measured.seconds;
+            total.allocations.allocations += measured.allocations.allocations;
+            total.allocations.frees += measured.allocations.frees;
+            total.allocations.bytes += measured.allocations.bytes;
+        }
+
+        record("clear", size, repetition, calls * size, total, results);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    options opts = { false, 3, 4000000, "" };
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        std::string value = arg.substr(arg.find('=') + 1);
+
+        if (arg == "--format=json")                { opts.json = true; }
+        else if (arg == "--format=csv")            { opts.json = false; }
+        else if (arg.find("--repetitions=") == 0)  { opts.repetitions = std::strtoul(value.c_str(), nullptr, 10); }
+        else if (arg.find("--budget=") == 0)       { opts.budget = std::strtoul(value.c_str(), nullptr, 10); }
+        else if (arg.find("--filter=") == 0)       { opts.filter = value; }
+        else
+        {
+            std::cerr << "usage: prefetchBenchmark [--format=csv|json] [--repetitions=N]"
+                         " [--budget=N] [--filter=TEXT]\n";
+            return (arg == "--help") ? 0 : 2;
+        }
+    }
+
+    std::vector<benchmark_result> results;
+    for (size_t size : { 1000, 100000, 1000000 })
+    {
+        run("find_if", find_last, size, opts, results);
+        run("equal", equal, size, opts, results);
+        run("size", count, size, opts, results);
+        run("copy", copy, size, opts, results);
+        run_clear(size, opts, results);
+    }
+
+    report_columns columns = { false, true };
+    if (opts.json)
+    {
+        write_json(std::cout, results, columns);
+        return 0;
+    }
+
+    write_csv_header(std::cout, columns);
+    for (const benchmark_result& result : results)
+    {
+        write_csv(std::cout, result, columns);
+    }
+    return 0;
+}
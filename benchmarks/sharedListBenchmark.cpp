@@ -0,0 +1,248 @@
+/*
+
+File: sharedListBenchmark.cpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+Snapshots of a list of 1000, 100000 and 1000000 ints, taken by copying a
+LinkedList and a SharedLinkedList:
+
+    snapshot        copy the list and destroy the copy
+    read            sum the elements of the list
+    read/snapshot   sum the elements of a copy of the list
+    snapshot/front  copy the list, push_front and pop_front on the original,
+                    then destroy the copy
+    snapshot/middle copy the list, replace the middle element of the
+                    original, then destroy the copy
+    snapshot/back   copy the list, push_back and pop_back on the original,
+                    then destroy the copy
+
+The snapshot/ operations are the cost of handing a copy to a reader while
+the list keeps changing: a SharedLinkedList copies the nodes before the
+first change, a LinkedList all of them up front. Both lists are built with
+push_back. A copy of a LinkedList has its nodes in one block, so it reads
+faster than the list it came from; a copy of a SharedLinkedList is the same
+nodes. ops is the number of snapshots, or of elements summed for read, and
+ns_per_op the time per op.
+
+Usage: sharedListBenchmark [--format=csv|json] [--repetitions=N]
+                           [--budget=N] [--filter=TEXT]
+
+--budget bounds the elements copied or read per operation and repetition.
+
+*/
+
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include "benchmark.hpp"
+#include "linkedList.hpp"
+#include "sharedLinkedList.hpp"
+
+// Counts the allocations of every measured region
+#define ALLOCATION_COUNTER_HOOKS
+#include "allocationCounter.hpp"
+
+struct options
+{
+    bool json;
+    size_t repetitions;
+    size_t budget;
+    std::string filter;
+};
+
+template <class List> const char* name();
+template <> const char* name<LinkedList<int> >() { return "LinkedList"; }
+template <> const char* name<SharedLinkedList<int> >() { return "SharedLinkedList"; }
+
+// The changes a list takes after a snapshot, the two lists name them apart
+
+void change_middle(LinkedList<int>& list, size_t size)
+{
+    LinkedList<int>::iterator middle = list.begin();
+    middle += size / 2;
+    *middle = -1;
+}
+
+void change_middle(SharedLinkedList<int>& list, size_t size)
+{
+    SharedLinkedList<int>::const_iterator middle = list.begin();
+    for (size_t i = 0; i < size / 2; ++i) { ++middle; }
+    list.replace(middle, -1);
+}
+
+/*****
+OPERATIONS
+*****/
+
+// Each returns the ops it did
+
+template <class List>
+size_t snapshot(List& list, size_t, size_t calls)
+{
+    for (size_t i = 0; i < calls; ++i)
+    {
+        List copy(list);
+        do_not_optimize(*copy.begin());
+    }
+    return calls;
+}
+
+template <class List>
+size_t read(const List& list, size_t size, size_t calls)
+{
+    for (size_t i = 0; i < calls; ++i)
+    {
+        long long sum = 0;
+        for (int value : list) { sum += value; }
+        do_not_optimize(sum);
+    }
+    return calls * size;
+}
+
+template <class List>
+size_t read_list(List& list, size_t size, size_t calls)
+{
+    return read(list, size, calls);
+}
+
+template <class List>
+size_t read_snapshot(List& list, size_t size, size_t calls)
+{
+    const List copy(list);
+    return read(copy, size, calls);
+}
+
+template <class List>
+size_t front(List& list, size_t, size_t calls)
+{
+    for (size_t i = 0; i < calls; ++i)
+    {
+        List copy(list);
+        list.push_front(-1);
+        list.pop_front();
+        do_not_optimize(*copy.begin());
+    }
+    return calls;
+}
+
+template <class List>
+size_t middle(List& list, size_t size, size_t calls)
+{
+    for (size_t i = 0; i < calls; ++i)
+    {
+        List copy(list);
+        change_middle(list, size);
+        do_not_optimize(*copy.begin());
+    }
+    return calls;
+}
+
+template <class List>
+size_t back(List& list, size_t, size_t calls)
+{
+    for (size_t i = 0; i < calls; ++i)
+    {
+        List copy(list);
+        list.push_back(-1);
+        list.pop_back();
+        do_not_optimize(*copy.begin());
+    }
+    return calls;
+}
+
+/*****
+DRIVER
+*****/
+
+template <class List>
+void run(const char* operation, size_t (*function)(List&, size_t, size_t), size_t size,
+         const options& opts, std::vector<benchmark_result>& results)
+{
+    if ((std::string(name<List>()) + "/int/" + operation).find(opts.filter) == std::string::npos)
+    {
+        return;
+    }
+
+    const size_t calls = std::max<size_t>(1, opts.budget / size);
+
+    for (size_t repetition = 0; repetition < opts.repetitions; ++repetition)
+    {
+        List list;
+        for (size_t i = 0; i < size; ++i)
+        {
+            list.push_back(static_cast<int>(i));
+        }
+
+        sample measured;
+        SampleTimer timer(measured);
+        size_t ops = function(list, size, calls);
+        timer.stop();
+
+        benchmark_result result = { name<List>(), "int", operation, size, repetition,
+                                    ops, measured.seconds, measured.events, measured.allocations };
+        results.push_back(result);
+    }
+}
+
+template <class List>
+void run_all(size_t size, const options& opts, std::vector<benchmark_result>& results)
+{
+    run<List>("snapshot", snapshot<List>, size, opts, results);
+    run<List>("read", read_list<List>, size, opts, results);
+    run<List>("read/snapshot", read_snapshot<List>, size, opts, results);
+    run<List>("snapshot/front", front<List>, size, opts, results);
+    run<List>("snapshot/middle", middle<List>, size, opts, results);
+    run<List>("snapshot/back", back<List>, size, opts, results);
+}
+
+int main(int argc, char* argv[])
+{
+    options opts = { false, 3, 10000000, "" };
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        std::string value = arg.substr(arg.find('=') + 1);
+
+        if (arg == "--format=json")                { opts.json = true; }
+        else if (arg == "--format=csv")            { opts.json = false; }
+        else if (arg.find("--repetitions=") == 0)  { opts.repetitions = std::strtoul(value.c_str(), nullptr, 10); }
+        else if (arg.find("--budget=") == 0)       { opts.budget = std::strtoul(value.c_str(), nullptr, 10); }
+        else if (arg.find("--filter=") == 0)       { opts.filter = value; }
+        else
+        {
+            std::cerr << "usage: sharedListBenchmark [--format=csv|json] [--repetitions=N]"
+                         " [--budget=N] [--filter=TEXT]\n";
+            return (arg == "--help") ? 0 : 2;
+        }
+    }
+
+    std::vector<benchmark_result> results;
+    for (size_t size : { 1000, 100000, 1000000 })
+    {
+        run_all<LinkedList<int> >(size, opts, results);
+        run_all<SharedLinkedList<int> >(size, opts, results);
+    }
+
+    report_columns columns = { false, true };
+    if (opts.json)
+    {
+        write_json(std::cout, results, columns);
+        return 0;
+    }
+
+    write_csv_header(std::cout, columns);
+    for (const benchmark_result& result : results)
+    {
+        write_csv(std::cout, result, columns);
+    }
+    return 0;
+}
@@ -0,0 +1,284 @@
+/*
+
+File: smallListBenchmark.cpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+Create, iterate and destroy throughput of many small lists of int, for
+SmallLinkedList<int, 4> against LinkedList, CompactLinkedList, std::list and
+std::vector. --lists lists are held in a std::vector and each phase is
+timed over all of them:
+
+    create    push_back every element into the empty lists
+    iterate   sum the elements of every list
+    destroy   destroy every list
+
+Each phase is run --rounds times and the fastest round is reported, in
+nanoseconds per list for create and destroy and per element for iterate,
+with the heap allocations create made per list.
+
+The sizes of the lists follow one of three distributions:
+
+    adjacency   half empty, a quarter with one element, a fifth with 2 to 4
+                and one in twenty with 5 to 16, as in memoryBenchmark
+    tiny        0 to 4 elements, evenly
+    spill       5 to 16 elements, all past SmallLinkedList's inline slots
+
+Usage: smallListBenchmark [--format=csv|json] [--lists=N] [--rounds=N]
+                          [--filter=TEXT]
+
+*/
+
+#include <algorithm>
+#include <cstdlib>
+#include <list>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+#include "benchmark.hpp"
+#include "compactLinkedList.hpp"
+#include "linkedList.hpp"
+#include "smallLinkedList.hpp"
+
+// Counts the allocations create makes
+#define ALLOCATION_COUNTER_HOOKS
+#include "allocationCounter.hpp"
+
+struct small_result
+{
+    std::string container;
+    std::string distribution;
+    size_t lists;
+    size_t elements;
+    double create_ns;
+    double iterate_ns;
+    double destroy_ns;
+    double allocations;
+};
+
+/*****
+CONTAINERS
+*****/
+
+template <typename Container>
+struct container_name;
+
+template <> struct container_name<SmallLinkedList<int, 4> >
+{
+    static const char* get() { return "SmallLinkedList<4>"; }
+};
+template <> struct container_name<LinkedList<int> >
+{
+    static const char* get() { return "LinkedList"; }
+};
+template <> struct container_name<CompactLinkedList<int> >
+{
+    static const char* get() { return "CompactLinkedList"; }
+};
+template <> struct container_name<std::list<int> >
+{
+    static const char* get() { return "std::list"; }
+};
+template <> struct container_name<std::vector<int> >
+{
+    static const char* get() { return "std::vector"; }
+};
+
+/*****
+DISTRIBUTIONS
+*****/
+
+std::vector<size_t> list_sizes(const std::string& distribution, size_t lists)
+{
+    std::mt19937 random(11);
+    std::uniform_int_distribution<int> percent(0, 99);
+    std::vector<size_t> sizes(lists);
+
+    for (size_t& size : sizes)
+    {
+        if (distribution == "tiny")
+        {
+            size = std::uniform_int_distribution<size_t>(0, 4)(random);
+        }
+        else if (distribution == "spill")
+        {
+            size = std::uniform_int_distribution<size_t>(5, 16)(random);
+        }
+        else
+        {
+            int pick = percent(random);
+            if (pick < 50)      { size = 0; }
+            else if (pick < 75) { size = 1; }
+            else if (pick < 95) { size = std::uniform_int_distribution<size_t>(2, 4)(random); }
+            else                { size = std::uniform_int_distribution<size_t>(5, 16)(random); }
+        }
+    }
+    return sizes;
+}
+
+/*****
+MEASURE
+*****/
+
+template <typename Container>
+small_result measure(const std::string& distribution, const std::vector<size_t>& sizes,
+                     size_t rounds)
+{
+    small_result result = { container_name<Container>::get(), distribution, sizes.size(), 0,
+                            0.0, 0.0, 0.0, 0.0 };
+
+    for (size_t size : sizes) { result.elements += size; }
+
+    double create = 0.0;
+    double iterate = 0.0;
+    double destroy = 0.0;
+
+    for (size_t round = 0; round < rounds; ++round)
+    {
+        // Held through a pointer so destroying the lists is timed on its own,
+        // without freeing the vector's buffer
+        std::vector<Container>* lists = new std::vector<Container>(sizes.size());
+
+        allocation::Counter counter;
+        Stopwatch watch;
+        for (size_t i = 0; i < sizes.size(); ++i)
+        {
+            Container& list = (*lists)[i];
+            for (size_t j = 0; j < sizes[i]; ++j)
+            {
+                list.push_back(static_cast<int>(j));
+            }
+        }
+        double created = watch.elapsed();
+        result.allocations = double(counter.delta().allocations) / double(sizes.size());
+
+        watch.restart();
+        long long sum = 0;
+        for (const Container& list : *lists)
+        {
+            for (int value : list) { sum += value; }
+        }
+        do_not_optimize(sum);
+        double iterated = watch.elapsed();
+
+        watch.restart();
+        for (Container& list : *lists)
+        {
+            list.~Container();
+            new (&list) Container();
+        }
+        double destroyed = watch.elapsed();
+        delete lists;
+
+        create = (round == 0) ? created : std::min(create, created);
+        iterate = (round == 0) ? iterated : std::min(iterate, iterated);
+        destroy = (round == 0) ? destroyed : std::min(destroy, destroyed);
+    }
+
+    result.create_ns = create * 1e9 / double(sizes.size());
+    result.iterate_ns = iterate * 1e9 / double(std::max<size_t>(result.elements, 1));
+    result.destroy_ns = destroy * 1e9 / double(sizes.size());
+    return result;
+}
+
+// Measures Container unless the filter leaves it out
+template <typename Container>
+void run(const std::string& distribution, const std::vector<size_t>& sizes, size_t rounds,
+         const std::string& filter, std::vector<small_result>& results)
+{
+    std::string name = std::string(container_name<Container>::get()) + "/" + distribution;
+    if (name.find(filter) == std::string::npos) { return; }
+
+    results.push_back(measure<Container>(distribution, sizes, rounds));
+}
+
+/*****
+DRIVER
+*****/
+
+void write_results(std::ostream& out, const std::vector<small_result>& results, bool json)
+{
+    if (!json)
+    {
+        csv_row(out, "container", "distribution", "lists", "elements", "create_ns_per_list",
+                "iterate_ns_per_element", "destroy_ns_per_list", "allocations_per_list");
+    }
+    else
+    {
+        out << "[\n";
+    }
+
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const small_result& result = results[i];
+        if (!json)
+        {
+            csv_row(out, result.container, result.distribution, result.lists, result.elements,
+                    result.create_ns, result.iterate_ns, result.destroy_ns, result.allocations);
+            continue;
+        }
+        out << "  {\"container\": \"" << result.container
+            << "\", \"distribution\": \"" << result.distribution
+            << "\", \"lists\": " << result.lists
+            << ", \"elements\": " << result.elements
+            << ", \"create_ns_per_list\": " << result.create_ns
+            << ", \"iterate_ns_per_element\": " << result.iterate_ns
+            << ", \"destroy_ns_per_list\": " << result.destroy_ns
+            << ", \"allocations_per_list\": " << result.allocations
+            << ((i + 1 < results.size()) ? "},\n" : "}\n");
+    }
+
+    if (json) { out << "]\n"; }
+}
+
+int main(int argc, char* argv[])
+{
+    bool json = false;
+    size_t lists = 1000000;
+    size_t rounds = 3;
+    std::string filter;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        std::string value = arg.substr(arg.find('=') + 1);
+
+        if (arg == "--format=json")             { json = true; }
+        else if (arg == "--format=csv")         { json = false; }
+        else if (arg.find("--lists=") == 0)     { lists = std::strtoul(value.c_str(), nullptr, 10); }
+        else if (arg.find("--rounds=") == 0)    { rounds = std::strtoul(value.c_str(), nullptr, 10); }
+        else if (arg.find("--filter=") == 0)    { filter = value; }
+        else
+        {
+            std::cerr << "usage: smallListBenchmark [--format=csv|json] [--lists=N] [--rounds=N]"
+                         " [--filter=TEXT]\n";
+            return (arg == "--help") ? 0 : 2;
+        }
+    }
+    if (lists == 0 || rounds == 0)
+    {
+        std::cerr << "smallListBenchmark: --lists and --rounds must be positive\n";
+        return 2;
+    }
+
+    std::vector<small_result> results;
+    for (const char* distribution : { "adjacency", "tiny", "spill" })
+    {
+        std::vector<size_t> sizes = list_sizes(distribution, lists);
+        run<SmallLinkedList<int, 4> >(distribution, sizes, rounds, filter, results);
+        run<LinkedList<int> >(distribution, sizes, rounds, filter, results);
+        run<CompactLinkedList<int> >(distribution, sizes, rounds, filter, results);
+        run<std::list<int> >(distribution, sizes, rounds, filter, results);
+        run<std::vector<int> >(distribution, sizes, rounds, filter, results);
+    }
+
+    write_results(std::cout, results, json);
+    return 0;
+}
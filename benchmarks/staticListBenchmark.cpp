@@ -0,0 +1,243 @@
+/*
+
+File: staticListBenchmark.cpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+StaticLinkedList<int, 1024> against LinkedList<int> on the default
+allocator, at sizes of 16, 128 and 1000 elements. Each operation keeps the
+list at its size:
+
+    push_pop      push_back a value and pop_front another, a queue
+    fill_clear    fill an empty list to the size and clear it
+    insert_erase  insert after the first element and erase it again
+    iterate       sum the elements
+    find          find the last element
+    sort          sort ascending, then descending
+
+ops is the number of elements an operation processed and ns_per_op the time
+per element. Every row ends in the heap allocations, frees and bytes per op,
+always zero for StaticLinkedList.
+
+Usage: staticListBenchmark [--format=csv|json] [--repetitions=N]
+                           [--budget=N] [--filter=TEXT]
+
+--budget bounds the elements processed per operation and repetition.
+
+*/
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <string>
+#include <vector>
+#include "benchmark.hpp"
+#include "linkedList.hpp"
+#include "staticLinkedList.hpp"
+
+// Counts the allocations of every measured region
+#define ALLOCATION_COUNTER_HOOKS
+#include "allocationCounter.hpp"
+
+typedef StaticLinkedList<int, 1024> static_list;
+
+template <typename List> struct list_name;
+
+template <> struct list_name<static_list>
+{
+    static const char* get() { return "StaticLinkedList"; }
+};
+template <> struct list_name<LinkedList<int> >
+{
+    static const char* get() { return "LinkedList"; }
+};
+
+struct options
+{
+    bool json;
+    size_t repetitions;
+    size_t budget;
+    std::string filter;
+};
+
+/*****
+OPERATIONS
+*****/
+
+// Each runs an operation calls times on a list of size elements and returns
+// the elements processed
+
+template <typename List>
+size_t push_pop(List& list, size_t, size_t calls)
+{
+    for (size_t i = 0; i < calls; ++i)
+    {
+        list.push_back(static_cast<int>(i));
+        list.pop_front();
+    }
+    return calls;
+}
+
+template <typename List>
+size_t fill_clear(List& list, size_t size, size_t calls)
+{
+    list.clear();
+    for (size_t i = 0; i < calls; ++i)
+    {
+        for (size_t j = 0; j < size; ++j)
+        {
+            list.push_back(static_cast<int>(j));
+        }
+        do_not_optimize(*list.begin());
+        list.clear();
+    }
+    return calls * size;
+}
+
+template <typename List>
+size_t insert_erase(List& list, size_t, size_t calls)
+{
+    for (size_t i = 0; i < calls; ++i)
+    {
+        typename List::const_iterator position = list.cbegin();
+        list.insert(position, static_cast<int>(i));
+
+        typename List::iterator second = list.begin();
+        ++second;
+        list.erase(second);
+    }
+    return calls;
+}
+
+template <typename List>
+size_t iterate(List& list, size_t size, size_t calls)
+{
+    long long sum = 0;
+    for (size_t i = 0; i < calls; ++i)
+    {
+        for (int value : list) { sum += value; }
+        do_not_optimize(sum);
+    }
+    return calls * size;
+}
+
+template <typename List>
+size_t find(List& list, size_t size, size_t calls)
+{
+    // LinkedList has no back(), the last value is found by walking once
+    int last = 0;
+    for (int value : list) { last = value; }
+
+    for (size_t i = 0; i < calls; ++i)
+    {
+        typename List::iterator found = list.find(last);
+        do_not_optimize(found);
+    }
+    return calls * size;
+}
+
+template <typename List>
+size_t sort(List& list, size_t size, size_t calls)
+{
+    for (size_t i = 0; i < calls; ++i)
+    {
+        if (i % 2 == 0) { list.sort(); }
+        else { list.sort(std::greater<int>()); }
+    }
+    return calls * size;
+}
+
+/*****
+DRIVER
+*****/
+
+template <typename List>
+void run(const char* operation, size_t (*function)(List&, size_t, size_t), size_t size,
+         const options& opts, std::vector<benchmark_result>& results)
+{
+    std::string name = std::string(list_name<List>::get()) + "/int/" + operation;
+    if (name.find(opts.filter) == std::string::npos) { return; }
+
+    const std::string operation_name(operation);
+    const bool per_element = operation_name != "push_pop" && operation_name != "insert_erase";
+    const size_t calls = std::max<size_t>(1, per_element ? opts.budget / size : opts.budget);
+
+    for (size_t repetition = 0; repetition < opts.repetitions; ++repetition)
+    {
+        List list;
+        for (size_t i = 0; i < size; ++i)
+        {
+            list.push_back(static_cast<int>((i * 7919) % size));
+        }
+
+        sample measured;
+        SampleTimer timer(measured);
+        size_t ops = function(list, size, calls);
+        timer.stop();
+
+        benchmark_result result = { list_name<List>::get(), "int", operation, size, repetition,
+                                    ops, measured.seconds, measured.events, measured.allocations };
+        results.push_back(result);
+    }
+}
+
+template <typename List>
+void run_all(size_t size, const options& opts, std::vector<benchmark_result>& results)
+{
+    run<List>("push_pop", push_pop<List>, size, opts, results);
+    run<List>("fill_clear", fill_clear<List>, size, opts, results);
+    run<List>("insert_erase", insert_erase<List>, size, opts, results);
+    run<List>("iterate", iterate<List>, size, opts, results);
+    run<List>("find", find<List>, size, opts, results);
+    run<List>("sort", sort<List>, size, opts, results);
+}
+
+int main(int argc, char* argv[])
+{
+    options opts = { false, 3, 1000000, "" };
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        std::string value = arg.substr(arg.find('=') + 1);
+
+        if (arg == "--format=json")                { opts.json = true; }
+        else if (arg == "--format=csv")            { opts.json = false; }
+        else if (arg.find("--repetitions=") == 0)  { opts.repetitions = std::strtoul(value.c_str(), nullptr, 10); }
+        else if (arg.find("--budget=") == 0)       { opts.budget = std::strtoul(value.c_str(), nullptr, 10); }
+        else if (arg.find("--filter=") == 0)       { opts.filter = value; }
+        else
+        {
+            std::cerr << "usage: staticListBenchmark [--format=csv|json] [--repetitions=N]"
+                         " [--budget=N] [--filter=TEXT]\n";
+            return (arg == "--help") ? 0 : 2;
+        }
+    }
+
+    std::vector<benchmark_result> results;
+    for (size_t size : { 16, 128, 1000 })
+    {
+        run_all<static_list>(size, opts, results);
+        run_all<LinkedList<int> >(size, opts, results);
+    }
+
+    report_columns columns = { false, true };
+    if (opts.json)
+    {
+        write_json(std::cout, results, columns);
+        return 0;
+    }
+
+    write_csv_header(std::cout, columns);
+    for (const benchmark_result& result : results)
+    {
+        write_csv(std::cout, result, columns);
+    }
+    return 0;
+}
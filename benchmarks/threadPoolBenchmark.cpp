@@ -0,0 +1,113 @@
+/*
+
+File: threadPoolBenchmark.cpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+Scheduler microbenchmarks for ThreadPool on 1, 2, 4, ... up to max_threads
+workers. Along with the time every row reports the worker statistics summed
+over all workers: tasks run, steals and idle time.
+
+    submit       empty tasks submitted from outside the pool
+    fork_join    repeated parallel_for over one small task per worker
+    recursive    binary tree of nested parallel_for calls, work is stolen
+    imbalanced   tasks whose cost varies by a factor of 1000
+
+Usage: threadPoolBenchmark [max_threads]
+
+*/
+
+#include <atomic>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include "benchmark.hpp"
+#include "threadPool.hpp"
+
+// A little arithmetic the optimizer cannot drop
+void spin(size_t iterations)
+{
+    unsigned long value = iterations;
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        value = value * 6364136223846793005UL + 1442695040888963407UL;
+    }
+    do_not_optimize(value);
+}
+
+void recurse(ThreadPool& pool, int depth)
+{
+    if (depth == 0)
+    {
+        spin(100);
+        return;
+    }
+    pool.parallel_for(2, [&pool, depth](size_t) { recurse(pool, depth - 1); });
+}
+
+void report(const std::string& scenario, ThreadPool& pool, size_t tasks, double seconds)
+{
+    size_t run = 0;
+    size_t steals = 0;
+    double idle = 0;
+    for (const ThreadPool::worker_stats& stats : pool.stats())
+    {
+        run += stats.tasks_run;
+        steals += stats.steals;
+        idle += std::chrono::duration<double>(stats.idle).count();
+    }
+    csv_row(std::cout, scenario, pool.size(), tasks, seconds, tasks / seconds, run, steals, idle);
+    pool.reset_stats();
+}
+
+int main(int argc, char* argv[])
+{
+    size_t max_threads = argc > 1 ? std::strtoul(argv[1], nullptr, 10)
+                                  : std::thread::hardware_concurrency();
+
+    csv_row(std::cout, "scenario", "threads", "tasks", "seconds", "tasks_per_second",
+            "tasks_run", "steals", "idle_seconds");
+
+    for (size_t threads = 1; threads <= max_threads; threads *= 2)
+    {
+        ThreadPool pool(threads);
+
+        const size_t submitted = 200000;
+        std::atomic<size_t> done(0);
+        Stopwatch timer;
+        for (size_t i = 0; i < submitted; ++i)
+        {
+            pool.submit([&done]() { done.fetch_add(1, std::memory_order_relaxed); });
+        }
+        while (done.load() != submitted)
+        {
+            std::this_thread::yield();
+        }
+        report("submit", pool, submitted, timer.elapsed());
+
+        const size_t rounds = 20000;
+        timer.restart();
+        for (size_t i = 0; i < rounds; ++i)
+        {
+            pool.parallel_for(threads, [](size_t) { spin(10); });
+        }
+        report("fork_join", pool, rounds * threads, timer.elapsed());
+
+        const int depth = 14;
+        timer.restart();
+        recurse(pool, depth);
+        report("recursive", pool, size_t(2) << depth, timer.elapsed());
+
+        const size_t imbalanced = 4096;
+        timer.restart();
+        pool.parallel_for(imbalanced, [](size_t i) { spin((i % 64 == 0) ? 100000 : 100); });
+        report("imbalanced", pool, imbalanced, timer.elapsed());
+    }
+    return 0;
+}
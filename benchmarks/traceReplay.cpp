@@ -0,0 +1,503 @@
+/*
+
+File: traceReplay.cpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+Replays a trace recorded with RecordingList (src/listTrace.hpp) against
+LinkedList, std::list, std::vector and std::deque. For each container it
+reports the time the whole trace took, the operations per second, the peak
+and final heap bytes in use and the number of allocations.
+
+Values are built before the clock starts, std::string values with the
+recorded length and int values for --type=int. Positions past the end of
+the list are clamped to it, and operations on an empty list that need an
+element are skipped, so any trace replays on any container.
+
+Usage: traceReplay TRACE [--type=string|int] [--repetitions=N]
+                         [--format=csv|json] [--filter=TEXT]
+       traceReplay TRACE --generate=N
+
+--generate writes a synthetic trace of N operations to TRACE, recorded
+through RecordingList: a queue under churn with some inserts, erases and
+finds in the middle. It gives the replay something to run before a real
+trace is at hand.
+
+*/
+
+#include <algorithm>
+#include <cstdlib>
+#include <deque>
+#include <fstream>
+#include <iterator>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+#include "benchmark.hpp"
+#include "listTrace.hpp"
+
+// Tracks the heap in use for the peak and final bytes of each replay
+#define HEAP_TRACKER_HOOKS
+#include "heapTracker.hpp"
+
+/*****
+REPLAY ADAPTERS
+*****/
+
+// Each adapter takes positions already clamped to the list. length is kept
+// by the replay, as LinkedList::size() walks the list.
+
+template <typename T>
+struct linked_list_replay
+{
+    typedef LinkedList<T> container;
+
+    static const char* name() { return "LinkedList"; }
+
+    static void push_front(container& list, const T& value) { list.push_front(value); }
+    static void push_back(container& list, const T& value) { list.push_back(value); }
+    static void pop_front(container& list) { list.pop_front(); }
+    static void pop_back(container& list) { list.pop_back(); }
+
+    static void insert(container& list, size_t index, const T& value)
+    {
+        if (index == 0) { return list.push_front(value); }
+
+        typename container::iterator position = list.begin();
+        std::advance(position, index - 1);
+        list.insert(position, value);
+    }
+
+    static void erase(container& list, size_t index)
+    {
+        typename container::iterator position = list.begin();
+        std::advance(position, index);
+        list.erase(position);
+    }
+
+    template <class Predicate>
+    static void find_if(container& list, Predicate pred) { do_not_optimize(list.find_if(pred)); }
+
+    static void sort(container& list) { list.sort(); }
+    static void reverse(container& list) { list.reverse(); }
+    static void unique(container& list) { list.unique(); }
+    static size_t size(const container& list) { return list.size(); }
+};
+
+template <typename T>
+struct list_replay
+{
+    typedef std::list<T> container;
+
+    static const char* name() { return "std::list"; }
+
+    static void push_front(container& list, const T& value) { list.push_front(value); }
+    static void push_back(container& list, const T& value) { list.push_back(value); }
+    static void pop_front(container& list) { list.pop_front(); }
+    static void pop_back(container& list) { list.pop_back(); }
+
+    static void insert(container& list, size_t index, const T& value)
+    {
+        list.insert(std::next(list.begin(), index), value);
+    }
+
+    static void erase(container& list, size_t index) { list.erase(std::next(list.begin(), index)); }
+
+    template <class Predicate>
+    static void find_if(container& list, Predicate pred)
+    {
+        do_not_optimize(std::find_if(list.begin(), list.end(), pred));
+    }
+
+    static void sort(container& list) { list.sort(); }
+    static void reverse(container& list) { list.reverse(); }
+    static void unique(container& list) { list.unique(); }
+    static size_t size(const container& list) { return list.size(); }
+};
+
+// std::vector and std::deque
+template <class Sequence>
+struct sequence_replay
+{
+    typedef Sequence container;
+    typedef typename Sequence::value_type T;
+
+    static void push_front(container& items, const T& value) { items.insert(items.begin(), value); }
+    static void push_back(container& items, const T& value) { items.push_back(value); }
+    static void pop_front(container& items) { items.erase(items.begin()); }
+    static void pop_back(container& items) { items.pop_back(); }
+
+    static void insert(container& items, size_t index, const T& value)
+    {
+        items.insert(items.begin() + index, value);
+    }
+
+    static void erase(container& items, size_t index) { items.erase(items.begin() + index); }
+
+    template <class Predicate>
+    static void find_if(container& items, Predicate pred)
+    {
+        do_not_optimize(std::find_if(items.begin(), items.end(), pred));
+    }
+
+    static void sort(container& items) { std::sort(items.begin(), items.end()); }
+    static void reverse(container& items) { std::reverse(items.begin(), items.end()); }
+
+    static void unique(container& items)
+    {
+        items.erase(std::unique(items.begin(), items.end()), items.end());
+    }
+
+    static size_t size(const container& items) { return items.size(); }
+};
+
+template <typename T>
+struct vector_replay : sequence_replay<std::vector<T> >
+{
+    static const char* name() { return "std::vector"; }
+};
+
+template <typename T>
+struct deque_replay : sequence_replay<std::deque<T> >
+{
+    static const char* name() { return "std::deque"; }
+};
+
+/*****
+REPLAY
+*****/
+
+template <typename T> T make_value(std::uint64_t size, size_t i);
+
+template <>
+int make_value<int>(std::uint64_t, size_t i) { return static_cast<int>(i); }
+
+template <>
+std::string make_value<std::string>(std::uint64_t size, size_t i)
+{
+    std::string value(static_cast<size_t>(size), 'a');
+    for (size_t digit = 0; digit < value.size() && i > 0; ++digit, i /= 26)
+    {
+        value[digit] = static_cast<char>('a' + i % 26);
+    }
+    return value;
+}
+
+struct replay_result
+{
+    std::string container;
+    std::string type;
+    size_t records;
+    size_t repetition;
+    double seconds;
+    size_t peak_bytes;
+    size_t final_bytes;
+    size_t allocations;
+};
+
+template <class Adapter, typename T>
+replay_result replay(const std::vector<list_trace::record>& records, const std::vector<T>& values)
+{
+    using list_trace::operation;
+
+    replay_result result = { Adapter::name(), "", records.size(), 0, 0, 0, 0, 0 };
+
+    const heap::totals before = heap::current();
+    heap::reset_peak();
+
+    typename Adapter::container* list = new typename Adapter::container();
+    size_t length = 0;
+    size_t next_value = 0;
+
+    Stopwatch timer;
+    for (const list_trace::record& entry : records)
+    {
+        switch (entry.op)
+        {
+        case operation::push_front:
+            Adapter::push_front(*list, values[next_value++]);
+            ++length;
+            break;
+        case operation::push_back:
+            Adapter::push_back(*list, values[next_value++]);
+            ++length;
+            break;
+        case operation::pop_front:
+            if (length > 0) { Adapter::pop_front(*list); --length; }
+            break;
+        case operation::pop_back:
+            if (length > 0) { Adapter::pop_back(*list); --length; }
+            break;
+        case operation::insert:
+            Adapter::insert(*list, std::min<size_t>(entry.position, length), values[next_value++]);
+            ++length;
+            break;
+        case operation::erase:
+            if (length > 0) { Adapter::erase(*list, std::min<size_t>(entry.position, length - 1)); --length; }
+            break;
+        case operation::find:
+            if (entry.position > 0)
+            {
+                std::uint64_t left = entry.position;
+                Adapter::find_if(*list, [&left](const T&) { return --left == 0; });
+            }
+            break;
+        case operation::clear:
+            list->clear();
+            length = 0;
+            break;
+        case operation::sort:
+            Adapter::sort(*list);
+            break;
+        case operation::reverse:
+            Adapter::reverse(*list);
+            break;
+        case operation::unique:
+            Adapter::unique(*list);
+            length = Adapter::size(*list);
+            break;
+        case operation::size:
+            do_not_optimize(Adapter::size(*list));
+            break;
+        default:
+            break;
+        }
+    }
+    result.final_bytes = heap::current().live - before.live;
+    delete list;
+    result.seconds = timer.elapsed();
+
+    result.peak_bytes = heap::current().peak - before.live;
+    result.allocations = heap::current().allocations - before.allocations;
+    return result;
+}
+
+/*****
+GENERATE
+*****/
+
+// A queue under churn: mostly push_back and pop_front around a steady
+// length, with inserts, erases and finds at random positions in between
+void generate(list_trace::Writer& trace, size_t operations)
+{
+    RecordingList<std::string> list(trace);
+    std::mt19937 random(7);
+    std::uniform_int_distribution<int> choice(0, 99);
+    std::uniform_int_distribution<size_t> value_size(8, 64);
+
+    const size_t steady = 1000;
+    size_t length = 0;
+
+    for (size_t i = 0; i < operations; ++i)
+    {
+        int pick = choice(random);
+        std::string value = make_value<std::string>(value_size(random), i);
+
+        if (length < steady || pick < 40)
+        {
+            list.push_back(value);
+            ++length;
+        }
+        else if (pick < 80)
+        {
+            list.pop_front();
+            --length;
+        }
+        else if (pick < 88)
+        {
+            RecordingList<std::string>::const_iterator position = list.begin();
+            std::advance(position, std::uniform_int_distribution<size_t>(0, length - 1)(random));
+            list.insert(position, value);
+            ++length;
+        }
+        else if (pick < 94)
+        {
+            RecordingList<std::string>::iterator position = list.begin();
+            std::advance(position, std::uniform_int_distribution<size_t>(0, length - 1)(random));
+            list.erase(position);
+            --length;
+        }
+        else
+        {
+            list.find(make_value<std::string>(0, i));
+        }
+    }
+}
+
+/*****
+DRIVER
+*****/
+
+struct options
+{
+    options() : json(false), strings(true), repetitions(3), generate(0) {}
+
+    std::string trace;
+    bool json;
+    bool strings;
+    size_t repetitions;
+    size_t generate;
+    std::string filter;
+};
+
+bool parse(int argc, char* argv[], options& opts)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        std::string value = arg.substr(arg.find('=') + 1);
+
+        if (arg == "--format=json")                { opts.json = true; }
+        else if (arg == "--format=csv")            { opts.json = false; }
+        else if (arg == "--type=string")           { opts.strings = true; }
+        else if (arg == "--type=int")              { opts.strings = false; }
+        else if (arg.find("--repetitions=") == 0)  { opts.repetitions = std::strtoul(value.c_str(), nullptr, 10); }
+        else if (arg.find("--generate=") == 0)     { opts.generate = std::strtoul(value.c_str(), nullptr, 10); }
+        else if (arg.find("--filter=") == 0)       { opts.filter = value; }
+        else if (arg == "--help")                  { return false; }
+        else if (arg.find("--") != 0 && opts.trace.empty()) { opts.trace = arg; }
+        else
+        {
+            std::cerr << "unknown argument " << arg << '\n';
+            return false;
+        }
+    }
+    return !opts.trace.empty();
+}
+
+template <typename T>
+void replay_all(const options& opts, const std::vector<list_trace::record>& records,
+                const char* type, std::vector<replay_result>& results)
+{
+    std::vector<T> values;
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+        list_trace::operation op = records[i].op;
+        if (op == list_trace::operation::push_front || op == list_trace::operation::push_back
+            || op == list_trace::operation::insert)
+        {
+            values.push_back(make_value<T>(records[i].value_size, i));
+        }
+    }
+
+    for (size_t repetition = 0; repetition < opts.repetitions; ++repetition)
+    {
+        std::vector<replay_result> round;
+        if (std::string("LinkedList").find(opts.filter) != std::string::npos)
+        {
+            round.push_back(replay<linked_list_replay<T>, T>(records, values));
+        }
+        if (std::string("std::list").find(opts.filter) != std::string::npos)
+        {
+            round.push_back(replay<list_replay<T>, T>(records, values));
+        }
+        if (std::string("std::vector").find(opts.filter) != std::string::npos)
+        {
+            round.push_back(replay<vector_replay<T>, T>(records, values));
+        }
+        if (std::string("std::deque").find(opts.filter) != std::string::npos)
+        {
+            round.push_back(replay<deque_replay<T>, T>(records, values));
+        }
+
+        for (replay_result& result : round)
+        {
+            result.type = type;
+            result.repetition = repetition;
+            results.push_back(result);
+        }
+    }
+}
+
+void write_results(std::ostream& out, const std::vector<replay_result>& results, bool json)
+{
+    if (!json)
+    {
+        csv_row(out, "container", "type", "records", "repetition", "seconds", "ops_per_second",
+                "peak_bytes", "final_bytes", "allocations");
+    }
+    else
+    {
+        out << "[\n";
+    }
+
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const replay_result& result = results[i];
+        double rate = (result.seconds > 0) ? result.records / result.seconds : 0;
+        if (!json)
+        {
+            csv_row(out, result.container, result.type, result.records, result.repetition,
+                    result.seconds, rate, result.peak_bytes, result.final_bytes, result.allocations);
+            continue;
+        }
+        out << "  {\"container\": \"" << result.container
+            << "\", \"type\": \"" << result.type
+            << "\", \"records\": " << result.records
+            << ", \"repetition\": " << result.repetition
+            << ", \"seconds\": " << result.seconds
+            << ", \"ops_per_second\": " << rate
+            << ", \"peak_bytes\": " << result.peak_bytes
+            << ", \"final_bytes\": " << result.final_bytes
+            << ", \"allocations\": " << result.allocations
+            << ((i + 1 < results.size()) ? "},\n" : "}\n");
+    }
+
+    if (json) { out << "]\n"; }
+}
+
+int main(int argc, char* argv[])
+{
+    options opts;
+    if (!parse(argc, argv, opts))
+    {
+        std::cerr << "usage: traceReplay TRACE [--type=string|int] [--repetitions=N]"
+                     " [--format=csv|json] [--filter=TEXT]\n"
+                     "       traceReplay TRACE --generate=N\n";
+        return 2;
+    }
+
+    if (opts.generate > 0)
+    {
+        std::ofstream file(opts.trace.c_str(), std::ios::binary);
+        list_trace::Writer trace(file);
+        generate(trace, opts.generate);
+        std::cerr << "wrote " << trace.records() << " records to " << opts.trace << '\n';
+        return file ? 0 : 1;
+    }
+
+    std::ifstream file(opts.trace.c_str(), std::ios::binary);
+    list_trace::Reader reader(file);
+    if (!reader.valid())
+    {
+        std::cerr << opts.trace << " is not a list trace\n";
+        return 1;
+    }
+
+    std::vector<list_trace::record> records;
+    list_trace::record entry;
+    while (reader.next(entry))
+    {
+        records.push_back(entry);
+    }
+
+    std::vector<replay_result> results;
+    if (opts.strings)
+    {
+        replay_all<std::string>(opts, records, "string", results);
+    }
+    else
+    {
+        replay_all<int>(opts, records, "int", results);
+    }
+
+    write_results(std::cout, results, opts.json);
+    return 0;
+}
@@ -0,0 +1,202 @@
+/*
+
+File: uniqueBenchmark.cpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+The ways to drop duplicates from a list of random ints, 10 million by
+default, with a high and a low ratio of duplicates. high draws the values
+from size / 100 distinct ones, so 99% of the elements go, low from 16 * size,
+so about 3% go.
+
+    unique                 LinkedList::unique(), hashing the nodes
+    unordered_set          remove_if with a std::unordered_set of copies, the
+                           way unique() used to find duplicates
+    unique_adjacent        LinkedList::unique_adjacent() on the sorted list
+    unique_sorted          LinkedList::unique_sorted() on the sorted list
+    std::list::unique      std::list::unique() on the sorted list
+
+Operations are named like unique/high. The sorted lists are built from the
+values sorted beforehand, so their nodes are allocated in list order. ops is
+the number of elements and ns_per_op the time per element.
+
+Usage: uniqueBenchmark [--format=csv|json] [--repetitions=N] [--size=N]
+                       [--filter=TEXT]
+
+*/
+
+#include <algorithm>
+#include <cstdlib>
+#include <list>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include "benchmark.hpp"
+#include "linkedList.hpp"
+
+// Counts the allocations of every measured region
+#define ALLOCATION_COUNTER_HOOKS
+#include "allocationCounter.hpp"
+
+struct options
+{
+    bool json;
+    size_t repetitions;
+    size_t size;
+    std::string filter;
+};
+
+std::vector<int> values(size_t size, size_t distinct)
+{
+    std::mt19937 random(13);
+    std::vector<int> result;
+    result.reserve(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        result.push_back(static_cast<int>(random() % distinct));
+    }
+    return result;
+}
+
+/*****
+OPERATIONS
+*****/
+
+void hashed(LinkedList<int>& list)
+{
+    list.unique();
+}
+
+void unordered_set(LinkedList<int>& list)
+{
+    std::unordered_set<int> seen;
+    list.remove_if([&seen](int value) { return !seen.insert(value).second; });
+}
+
+void adjacent(LinkedList<int>& list)
+{
+    list.unique_adjacent();
+}
+
+void sorted(LinkedList<int>& list)
+{
+    list.unique_sorted();
+}
+
+/*****
+DRIVER
+*****/
+
+void record(const char* container, const std::string& operation, size_t size, size_t repetition,
+            const sample& measured, std::vector<benchmark_result>& results)
+{
+    benchmark_result result = { container, "int", operation, size, repetition,
+                                size, measured.seconds, measured.events, measured.allocations };
+    results.push_back(result);
+}
+
+void run(const char* operation, void (*function)(LinkedList<int>&),
+         const std::vector<int>& input, const std::string& ratio, const options& opts,
+         std::vector<benchmark_result>& results)
+{
+    const std::string name = std::string(operation) + "/" + ratio;
+    if (("LinkedList/int/" + name).find(opts.filter) == std::string::npos) { return; }
+
+    for (size_t repetition = 0; repetition < opts.repetitions; ++repetition)
+    {
+        LinkedList<int> list(input.begin(), input.end());
+
+        sample measured;
+        SampleTimer timer(measured);
+        function(list);
+        timer.stop();
+
+        do_not_optimize(*list.begin());
+        record("LinkedList", name, input.size(), repetition, measured, results);
+    }
+}
+
+void run_std_list(const std::vector<int>& input, const std::string& ratio, const options& opts,
+                  std::vector<benchmark_result>& results)
+{
+    const std::string name = "std::list::unique/" + ratio;
+    if (("std::list/int/" + name).find(opts.filter) == std::string::npos) { return; }
+
+    for (size_t repetition = 0; repetition < opts.repetitions; ++repetition)
+    {
+        std::list<int> list(input.begin(), input.end());
+
+        sample measured;
+        SampleTimer timer(measured);
+        list.unique();
+        timer.stop();
+
+        do_not_optimize(list.front());
+        record("std::list", name, input.size(), repetition, measured, results);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    options opts = { false, 3, 10000000, "" };
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        std::string value = arg.substr(arg.find('=') + 1);
+
+        if (arg == "--format=json")                { opts.json = true; }
+        else if (arg == "--format=csv")            { opts.json = false; }
+        else if (arg.find("--repetitions=") == 0)  { opts.repetitions = std::strtoul(value.c_str(), nullptr, 10); }
+        else if (arg.find("--size=") == 0)         { opts.size = std::strtoul(value.c_str(), nullptr, 10); }
+        else if (arg.find("--filter=") == 0)       { opts.filter = value; }
+        else
+        {
+            std::cerr << "usage: uniqueBenchmark [--format=csv|json] [--repetitions=N]"
+                         " [--size=N] [--filter=TEXT]\n";
+            return (arg == "--help") ? 0 : 2;
+        }
+    }
+
+    std::vector<benchmark_result> results;
+    const size_t size = opts.size;
+    const std::pair<std::string, size_t> ratios[] = {
+        std::make_pair(std::string("high"), size / 100 + 1),
+        std::make_pair(std::string("low"), 16 * size)
+    };
+
+    for (const std::pair<std::string, size_t>& ratio : ratios)
+    {
+        std::vector<int> input = values(size, ratio.second);
+
+        run("unique", hashed, input, ratio.first, opts, results);
+        run("unordered_set", unordered_set, input, ratio.first, opts, results);
+
+        std::sort(input.begin(), input.end());
+        run("unique_adjacent", adjacent, input, ratio.first, opts, results);
+        run("unique_sorted", sorted, input, ratio.first, opts, results);
+        run_std_list(input, ratio.first, opts, results);
+    }
+
+    report_columns columns = { false, true };
+    if (opts.json)
+    {
+        write_json(std::cout, results, columns);
+        return 0;
+    }
+
+    write_csv_header(std::cout, columns);
+    for (const benchmark_result& result : results)
+    {
+        write_csv(std::cout, result, columns);
+    }
+    return 0;
+}
@@ -15,10 +15,18 @@ https://github.com/AlexanderJDupree/LinkedListsCPP
 #ifndef LINKED_LIST_H
 #define LINKED_LIST_H
 
+#include <functional>
 #include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <stdexcept>
 #include <type_traits>
 #include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <unordered_set>
+#include <vector>
 
 /*
 
@@ -47,14 +55,15 @@ public:
     // Default
     Node();
 
-    // Copy
-    Node(const Node& origin);
+    // Copy, trivial for a trivially copyable T so the node is too
+    Node(const Node& origin) = default;
 
     // Value
     explicit Node(const T& value);
+    explicit Node(T&& value);
 
     // Destructor
-    ~Node();
+    ~Node() = default;
 
     /* Inspectors */
     T* data() const;
@@ -67,10 +76,13 @@ public:
 
 private:
 
-    T* _data;
+    // Held inline so a node is a single allocation, mutable because data()
+    // hands out a modifiable pointer from a const node
+    mutable T _data;
     Node* _next;
 };
 
+
 /*
 
 File: node.cpp
@@ -90,27 +102,21 @@ https://github.com/AlexanderJDupree/LinkedListsCPP
 #ifndef NODE_TPP
 #define NODE_TPP
 
+#include <utility>
 template <typename T>
-Node<T>::Node() : _data(new T()), _next(nullptr) {}
-
-template <typename T>
-Node<T>::Node(const Node& origin)
-    : _data(new T(*origin._data)), _next(origin._next) {}
+Node<T>::Node() : _data(), _next(nullptr) {}
 
 template <typename T>
-Node<T>::Node(const T& value) : _data(new T(value)), _next (nullptr) {}
+Node<T>::Node(const T& value) : _data(value), _next (nullptr) {}
 
 template <typename T>
-Node<T>::~Node()
-{
-    delete _data;
-}
+Node<T>::Node(T&& value) : _data(std::move(value)), _next (nullptr) {}
 
 // Inspectors
 template <typename T>
 T* Node<T>::data() const
 {
-    return _data;
+    return &_data;
 }
 
 template <typename T>
@@ -123,8 +129,7 @@ Node<T>* Node<T>::next() const
 template <typename T>
 Node<T>* Node<T>::data(const T& value)
 {
-    delete _data;
-    this->_data = new T(value);
+    _data = value;
     return this;
 }
 
@@ -140,6 +145,267 @@ Node<T>* Node<T>::next(Node* node)
 
 /*
 
+File: nodeChain.hpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+/*
+Algorithms on a chain of nodes, a run of Node<T> linked through next() and
+ended by a null pointer. The lists that keep their nodes in their own way,
+CompactLinkedList in a ring and SmallLinkedList partly inside the list
+object, open their nodes into a chain and share these. None of them
+recurses or allocates. If a comparison or predicate throws, the chain is
+left whole: a sort keeps every node, a filter the ones it had not decided on.
+*/
+
+#ifndef NODE_CHAIN_H
+#define NODE_CHAIN_H
+
+#include <cstddef>
+namespace node_chain
+{
+
+// What a sort did, for lists that keep operation counters
+struct sort_counts
+{
+    size_t length;  // nodes in the chain
+    size_t merged;  // nodes the merges took one at a time
+};
+
+// Links chain, ended by a null pointer, after last and moves last to its end
+template <typename T>
+void append(Node<T>*& first, Node<T>*& last, Node<T>* chain) noexcept
+{
+    if (chain == nullptr) { return; }
+
+    if (last == nullptr) { first = chain; }
+    else { last->next(chain); }
+
+    for (last = chain; last->next() != nullptr; last = last->next()) {}
+    return;
+}
+
+// Merges two sorted chains into first up to last, ties take the left node
+// first so sorting stays stable. merged grows by the nodes taken before
+// either chain ran out. If compare throws, first up to last holds the nodes
+// merged so far followed by the rest of left and right.
+template <typename T, class Comparator>
+void merge_into(Node<T>*& first, Node<T>*& last, Node<T>* left, Node<T>* right,
+                Comparator& compare, size_t& merged)
+{
+    first = nullptr;
+    last = nullptr;
+
+    try
+    {
+        while (left != nullptr && right != nullptr)
+        {
+            Node<T>* next = nullptr;
+            if (compare(*right->data(), *left->data()))
+            {
+                next = right;
+                right = right->next();
+            }
+            else
+            {
+                next = left;
+                left = left->next();
+            }
+
+            if (last == nullptr) { first = next; }
+            else { last->next(next); }
+            last = next;
+            ++merged;
+        }
+    }
+    catch (...)
+    {
+        if (last != nullptr) { last->next(nullptr); }
+        append(first, last, left);
+        append(first, last, right);
+        throw;
+    }
+
+    append(first, last, (left != nullptr) ? left : right);
+    return;
+}
+
+// Merges two sorted chains and returns the first node, tail is set to the
+// last
+template <typename T, class Comparator>
+Node<T>* merge(Node<T>* left, Node<T>* right, Comparator& compare, Node<T>*& tail, size_t& merged)
+{
+    Node<T>* head = nullptr;
+    merge_into(head, tail, left, right, compare, merged);
+    return head;
+}
+
+template <typename T, class Comparator>
+Node<T>* merge(Node<T>* left, Node<T>* right, Comparator& compare, Node<T>*& tail)
+{
+    size_t merged = 0;
+    return merge(left, right, compare, tail, merged);
+}
+
+// Cuts the chain after its first count nodes and returns the rest
+template <typename T>
+Node<T>* split(Node<T>* head, size_t count)
+{
+    for (size_t i = 1; i < count && head != nullptr; ++i)
+    {
+        head = head->next();
+    }
+    if (head == nullptr) { return nullptr; }
+
+    Node<T>* rest = head->next();
+    head->next(nullptr);
+    return rest;
+}
+
+// Bottom up merge sort: runs of width 1, 2, 4, ... are merged in pairs until
+// one run is left. head is set to the new first node and tail to the last,
+// counts adds what the sort did. If compare throws, head up to tail still
+// holds every node, in no particular order.
+template <typename T, class Comparator>
+void sort(Node<T>*& head, Comparator compare, Node<T>*& tail, sort_counts& counts)
+{
+    tail = head;
+    if (head == nullptr || head->next() == nullptr)
+    {
+        counts.length += (head != nullptr) ? 1 : 0;
+        return;
+    }
+
+    for (size_t width = 1; ; width *= 2)
+    {
+        Node<T>* rest = head;
+        size_t runs = 0;
+        head = nullptr;
+        tail = nullptr;
+
+        while (rest != nullptr)
+        {
+            Node<T>* left = rest;
+            Node<T>* right = split(left, width);
+            rest = split(right, width);
+
+            Node<T>* run = nullptr;
+            Node<T>* run_tail = nullptr;
+            try
+            {
+                merge_into(run, run_tail, left, right, compare, counts.merged);
+            }
+            catch (...)
+            {
+                append(head, tail, run);
+                append(head, tail, rest);
+                throw;
+            }
+
+            if (tail == nullptr) { head = run; }
+            else { tail->next(run); }
+            tail = run_tail;
+            ++runs;
+
+            // The first pass pairs up single nodes, which counts the chain
+            if (width == 1) { counts.length += (right != nullptr) ? 2 : 1; }
+        }
+
+        if (runs == 1) { return; }
+    }
+}
+
+template <typename T, class Comparator>
+void sort(Node<T>*& head, Comparator compare, Node<T>*& tail)
+{
+    sort_counts counts = { 0, 0 };
+    sort(head, compare, tail, counts);
+}
+
+// Reverses the chain in place and returns its new first node, the old first
+// node is now the last
+template <typename T>
+Node<T>* reverse(Node<T>* head) noexcept
+{
+    Node<T>* previous = nullptr;
+    while (head != nullptr)
+    {
+        Node<T>* next = head->next();
+        head->next(previous);
+        previous = head;
+        head = next;
+    }
+    return previous;
+}
+
+// Unlinks every node whose value satisfies discard and hands it to dispose,
+// which frees it, once the walk is over. head is set to the first node kept
+// and tail to the last. If discard throws, the node it threw on and the ones
+// after it are kept.
+template <typename T, class Predicate, class Dispose>
+void filter(Node<T>*& head, Predicate& discard, Dispose dispose, Node<T>*& tail)
+{
+    Node<T>* current = head;
+    Node<T>* discarded = nullptr;
+    head = nullptr;
+    tail = nullptr;
+
+    try
+    {
+        while (current != nullptr)
+        {
+            Node<T>* next = current->next();
+            if (discard(*current->data()))
+            {
+                current->next(discarded);
+                discarded = current;
+            }
+            else
+            {
+                if (tail == nullptr) { head = current; }
+                else { tail->next(current); }
+                tail = current;
+            }
+            current = next;
+        }
+    }
+    catch (...)
+    {
+        if (tail != nullptr) { tail->next(nullptr); }
+        append(head, tail, current);
+
+        for (Node<T>* next = nullptr; discarded != nullptr; discarded = next)
+        {
+            next = discarded->next();
+            dispose(discarded);
+        }
+        throw;
+    }
+
+    if (tail != nullptr) { tail->next(nullptr); }
+
+    for (Node<T>* next = nullptr; discarded != nullptr; discarded = next)
+    {
+        next = discarded->next();
+        dispose(discarded);
+    }
+    return;
+}
+
+} // namespace node_chain
+
+#endif // NODE_CHAIN_H
+
+/*
+
 File: iterator.hpp
 
 Copyright (c) 2018 Alexander DuPree
@@ -155,10 +421,11 @@ https://github.com/AlexanderJDupree/LinkedListsCPP
 #ifndef ITERATORS_H
 #define ITERATORS_H
 
+#include <cstddef>
 #include <iterator>
-
-// Forward Declaration
+// Forward Declarations
 template <typename T> class LinkedList;
+template <typename T, size_t N> class SmallLinkedList;
 
 template <typename T>
 class iterator_base
@@ -185,6 +452,7 @@ public:
     bool operator!=(const self_type& rhs) const;
 
     friend class LinkedList<T>;
+    template <typename U, size_t N> friend class SmallLinkedList;
 
 protected:
 
@@ -227,6 +495,8 @@ public:
 
 };
 
+
+
 /*
 
 File: iterator.cpp
@@ -305,124 +575,122 @@ const_forward_iterator<T>::operator+=(size_t n)
 #endif // ITERATOR_TPP
 #endif // ITERATORS_H
 
-template<typename T>
-class LinkedList : public forward_iterator<T>
-{
-public:
+/*
 
-    /* Type Defs */
-    typedef size_t size_type;
-    typedef T value_type;
-    typedef T& reference;
-    typedef const T& const_reference;
-    typedef T* pointer;
-    typedef const T* const_pointer;
-    typedef forward_iterator<T> iterator;
-    typedef const_forward_iterator<T> const_iterator;
-    typedef Node<T>* node_pointer;
+File: execution.hpp
 
-    /* Constructors */
+Copyright (c) 2018 Alexander DuPree
 
-    // Default
-    LinkedList();
+This software is released as open source through the MIT License
 
-    // Fill
-    LinkedList(size_type count, const_reference data);
+Authors: Alexander DuPree, Jacob Bickle
 
-    // Range
-    template <typename InputIterator, typename ::std::enable_if< ::std::is_constructible
-             < T, decltype(*::std::declval<InputIterator>()) >::value >::type* = nullptr >
-    LinkedList(InputIterator begin, InputIterator end);
+https://github.com/AlexanderJDupree/LinkedListsCPP
 
-    // Copy
-    LinkedList(const LinkedList<value_type>& origin);
+*/
 
-    // Initializer List
-    explicit LinkedList(std::initializer_list<value_type> init);
+/*
+Execution policies select the parallel overloads of the list operations, in the
+spirit of std::execution from C++17:
 
-    // Destructor
-    ~LinkedList();
+    list.for_each(execution::par, function);
+    list.reduce(execution::par.on(pool).grain(4096), 0, std::plus<int>());
 
-    /* Iterators */
-    const_iterator cbegin() const noexcept;
-    const_iterator begin() const;
-    iterator begin();
+Without on() the work runs on the default executor, ThreadPool::shared()
+unless another one was installed with set_default_executor().
+*/
 
-    const_iterator cend() const noexcept;
-    const_iterator end() const;
-    iterator end();
+#ifndef EXECUTION_H
+#define EXECUTION_H
 
-    /* Modifiers */
-    void push_front(const_reference data);
-    void push_back(const_reference data);
-    
-    void pop_front();
-    reference pop_front(reference out_data);
-    void pop_back();
-    reference pop_back(reference out_data);
-    
-    void insert(const_iterator& position, const_reference data);
-    void insert(const_iterator position, size_type n, const_reference data);
-    template <typename InputIterator>
-    void insert(const_iterator position, InputIterator begin, InputIterator end);
+#include <atomic>
+#include <cstddef>
 
-    iterator erase(iterator& position);
-    iterator erase(iterator& first, iterator& last);
-    
-    void clear();
+/*
 
-    /* Capacity */
-    bool empty() const;
-    size_type size() const;
+File: executor.hpp
 
-    /* Operations */
-    void reverse() noexcept;
+Copyright (c) 2018 Alexander DuPree
 
-    void remove(const_reference target);
-    template <class Predicate>
-    void remove_if(Predicate pred);
+This software is released as open source through the MIT License
 
-    iterator find(const_reference target);
-    template <class Predicate>
-    iterator find_if(Predicate pred);
-    
-    void unique();
+Authors: Alexander DuPree, Jacob Bickle
 
-    template <class Comparator>
-    void sort(Comparator compare);
-    void sort();
+https://github.com/AlexanderJDupree/LinkedListsCPP
 
-    /* Operator Overloads */
-    inline bool operator==(const LinkedList<value_type>& rhs) const;
-    inline bool operator!=(const LinkedList<value_type>& rhs) const;
-    LinkedList<value_type>& operator=(LinkedList<value_type> list);
+*/
 
-    /* Swap */
-    void swap(LinkedList<value_type>& newList, LinkedList<value_type>& oldList) noexcept;
+/*
+Executor is the interface the parallel list algorithms schedule their work on.
+ThreadPool implements it. Any other scheduler can be injected by implementing
+it and passing it to execution::par.on(executor), or process wide through
+execution::set_default_executor(&executor).
+*/
 
+#ifndef EXECUTOR_H
+#define EXECUTOR_H
 
+#include <cstddef>
+#include <functional>
 
-private:
+class Executor
+{
+public:
 
-    node_pointer head;
-    node_pointer tail;
+    typedef std::function<void(size_t)> index_task;
 
-    /* Helper functions */
-    void reverse_links(node_pointer current, node_pointer previous) noexcept;
+    virtual ~Executor() {}
 
-    template <class Comparator>
-    void merge_sort(node_pointer& begin, Comparator compare);
+    // Number of threads that run tasks, used to decide how finely to split work
+    virtual size_t size() const = 0;
 
-    void split(node_pointer& left, node_pointer& right);
+    // Calls task(i) for every i in [0, count) and returns once all of them are
+    // done. An exception thrown by a task is rethrown to the caller.
+    virtual void parallel_for(size_t count, const index_task& task) = 0;
+};
 
-    template <class Comparator> 
-    node_pointer merge(node_pointer left, node_pointer right, Comparator compare);
+#endif // EXECUTOR_H
 
-};
+/*
+
+File: threadPool.hpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
 
 /*
+ThreadPool is the work-stealing executor shared by the parallel list
+algorithms. Every worker owns a lock-free Chase-Lev deque: it pushes and pops
+its own tasks at the bottom while idle workers steal from the top. Tasks
+submitted from threads outside the pool go through a locked inbox that every
+worker checks before it tries to steal.
+*/
 
-File: LinkedList.cpp
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+
+File: workStealingDeque.hpp
 
 Copyright (c) 2018 Alexander DuPree
 
@@ -434,575 +702,3524 @@ https://github.com/AlexanderJDupree/LinkedListsCPP
 
 */
 
-#ifndef LINKED_LIST_TPP
-#define LINKED_LIST_TPP
+/*
+WorkStealingDeque is the lock-free deque of Chase and Lev ("Dynamic Circular
+Work-Stealing Deque", SPAA 2005). A single owner thread pushes and pops at the
+bottom, any number of thieves steal from the top. T is meant to be a pointer or
+another small trivially copyable type.
 
-#include "linkedList.hpp"
+The buffer grows when full. Retired buffers are kept until the deque is
+destroyed because a thief may still be reading from one.
+*/
 
-/*******************************************************************************
-CONSTRUCTORS
-*******************************************************************************/
+#ifndef WORK_STEALING_DEQUE_H
+#define WORK_STEALING_DEQUE_H
 
-// Default
-template <typename T>
-LinkedList<T>::LinkedList() : head(nullptr), tail(nullptr) {}
-// Fill
-template <typename T>
-LinkedList<T>::LinkedList(size_type count, const_reference data) : LinkedList()
-{
-    while (count > 0)
-    {
-        push_front(data);
-        --count;
-    }
-}
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
 
-// Range
 template <typename T>
-template <typename InputIterator, typename ::std::enable_if< ::std::is_constructible
-         < T, decltype(*::std::declval<InputIterator>()) >::value >::type* >
-LinkedList<T>::LinkedList(InputIterator begin, InputIterator end) : LinkedList()
+class WorkStealingDeque
 {
-    for (;begin != end; ++begin)
-    {
-        push_back(*begin);
-    }
-}
+public:
 
+    /* Constructors */
+    explicit WorkStealingDeque(size_t capacity = 64);
 
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
 
-// Copy
-template <typename T>
-LinkedList<T>::LinkedList(const LinkedList<value_type>& origin) : LinkedList()
-{
-    LinkedList<T>::const_iterator it;
-    for (it = origin.cbegin(); it != origin.cend(); ++it)
+    /* Owner operations */
+    void push(T item);
+    bool pop(T& item);
+
+    /* Thief operations */
+    bool steal(T& item);
+
+    /* Capacity */
+    bool empty() const;
+    size_t size() const;
+
+private:
+
+    class buffer
+    {
+    public:
+
+        explicit buffer(size_t capacity);
+
+        size_t capacity() const;
+
+        T get(int64_t index) const;
+        void put(int64_t index, T item);
+
+        // Copies [top, bottom) into a buffer twice the size
+        buffer* grow(int64_t top, int64_t bottom) const;
+
+    private:
+
+        size_t mask;
+        std::unique_ptr<std::atomic<T>[]> items;
+    };
+
+    std::atomic<int64_t> top;
+    std::atomic<int64_t> bottom;
+    std::atomic<buffer*> array;
+
+    std::vector<std::unique_ptr<buffer> > buffers;
+};
+
+
+/*
+
+File: workStealingDeque.cpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+// Implementation for WorkStealingDeque
+
+#ifndef WORK_STEALING_DEQUE_TPP
+#define WORK_STEALING_DEQUE_TPP
+
+/*******************************************************************************
+BUFFER
+*******************************************************************************/
+
+template <typename T>
+WorkStealingDeque<T>::buffer::buffer(size_t capacity)
+    : mask(capacity - 1), items(new std::atomic<T>[capacity]) {}
+
+template <typename T>
+size_t WorkStealingDeque<T>::buffer::capacity() const
+{
+    return mask + 1;
+}
+
+template <typename T>
+T WorkStealingDeque<T>::buffer::get(int64_t index) const
+{
+    return items[static_cast<size_t>(index) & mask].load(std::memory_order_relaxed);
+}
+
+template <typename T>
+void WorkStealingDeque<T>::buffer::put(int64_t index, T item)
+{
+    items[static_cast<size_t>(index) & mask].store(item, std::memory_order_relaxed);
+}
+
+template <typename T>
+typename WorkStealingDeque<T>::buffer*
+WorkStealingDeque<T>::buffer::grow(int64_t top, int64_t bottom) const
+{
+    buffer* larger = new buffer(capacity() * 2);
+    for (int64_t i = top; i < bottom; ++i)
+    {
+        larger->put(i, get(i));
+    }
+    return larger;
+}
+
+/*******************************************************************************
+CONSTRUCTORS
+*******************************************************************************/
+
+template <typename T>
+WorkStealingDeque<T>::WorkStealingDeque(size_t capacity) : top(0), bottom(0)
+{
+    // Indices wrap with a mask, the capacity has to be a power of two
+    size_t rounded = 1;
+    while (rounded < capacity)
+    {
+        rounded *= 2;
+    }
+
+    buffers.emplace_back(new buffer(rounded));
+    array.store(buffers.back().get());
+}
+
+/*******************************************************************************
+OWNER OPERATIONS
+*******************************************************************************/
+
+template <typename T>
+void WorkStealingDeque<T>::push(T item)
+{
+    int64_t b = bottom.load(std::memory_order_relaxed);
+    int64_t t = top.load(std::memory_order_acquire);
+    buffer* a = array.load(std::memory_order_relaxed);
+
+    if (b - t > static_cast<int64_t>(a->capacity()) - 1)
+    {
+        a = a->grow(t, b);
+        buffers.emplace_back(a);
+        array.store(a, std::memory_order_release);
+    }
+
+    a->put(b, item);
+
+    // Publishes the item to thieves
+    bottom.store(b + 1, std::memory_order_seq_cst);
+    return;
+}
+
+template <typename T>
+bool WorkStealingDeque<T>::pop(T& item)
+{
+    int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+    buffer* a = array.load(std::memory_order_relaxed);
+
+    // Claim the bottom slot before looking at top, both sequentially consistent
+    bottom.store(b, std::memory_order_seq_cst);
+    int64_t t = top.load(std::memory_order_seq_cst);
+
+    if (t > b)
+    {
+        bottom.store(b + 1, std::memory_order_relaxed);
+        return false;
+    }
+
+    item = a->get(b);
+    if (t < b) { return true; }
+
+    // Last item, race the thieves for it
+    bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                           std::memory_order_relaxed);
+    bottom.store(b + 1, std::memory_order_relaxed);
+    return won;
+}
+
+/*******************************************************************************
+THIEF OPERATIONS
+*******************************************************************************/
+
+template <typename T>
+bool WorkStealingDeque<T>::steal(T& item)
+{
+    int64_t t = top.load(std::memory_order_seq_cst);
+    int64_t b = bottom.load(std::memory_order_seq_cst);
+
+    if (t >= b) { return false; }
+
+    buffer* a = array.load(std::memory_order_acquire);
+    T stolen = a->get(t);
+
+    if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                     std::memory_order_relaxed))
+    {
+        // Lost to the owner or another thief
+        return false;
+    }
+
+    item = stolen;
+    return true;
+}
+
+/*******************************************************************************
+CAPACITY
+*******************************************************************************/
+
+template <typename T>
+bool WorkStealingDeque<T>::empty() const
+{
+    return size() == 0;
+}
+
+template <typename T>
+size_t WorkStealingDeque<T>::size() const
+{
+    int64_t b = bottom.load(std::memory_order_relaxed);
+    int64_t t = top.load(std::memory_order_relaxed);
+    return (b > t) ? static_cast<size_t>(b - t) : 0;
+}
+
+#endif // WORK_STEALING_DEQUE_TPP
+#endif // WORK_STEALING_DEQUE_H
+class ThreadPool : public Executor
+{
+public:
+
+    typedef std::function<void()> task_type;
+
+    struct worker_stats
+    {
+        size_t tasks_run;
+        size_t steals;
+        std::chrono::nanoseconds idle;
+    };
+
+    /* Constructors */
+
+    // Starts the given number of workers, at least one
+    explicit ThreadPool(size_t workers = default_workers());
+
+    // Runs every task already submitted, then joins the workers
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /* Inspectors */
+    size_t size() const override;
+
+    // One entry per worker, counted since construction or the last reset
+    std::vector<worker_stats> stats() const;
+    void reset_stats();
+
+    /* Scheduling */
+
+    // Tasks given to submit must not throw
+    void submit(task_type task);
+
+    // The calling thread runs tasks while it waits, so parallel_for may be
+    // nested inside another task
+    void parallel_for(size_t count, const index_task& task) override;
+
+    // Pool used by the parallel algorithms when no other executor is given
+    static ThreadPool& shared();
+
+    static size_t default_workers();
+
+private:
+
+    struct worker
+    {
+        worker() : tasks_run(0), steals(0), idle_nanoseconds(0) {}
+
+        WorkStealingDeque<task_type*> tasks;
+
+        std::atomic<size_t> tasks_run;
+        std::atomic<size_t> steals;
+        std::atomic<int64_t> idle_nanoseconds;
+
+        std::thread thread;
+    };
+
+    std::vector<std::unique_ptr<worker> > workers;
+
+    std::mutex inbox_lock;
+    std::deque<task_type*> inbox;
+
+    std::atomic<size_t> pending;
+
+    std::mutex idle_lock;
+    std::condition_variable idle;
+    bool stopping;
+
+    /* Helper functions */
+    void work(size_t index);
+
+    bool try_run_one();
+    bool find_task(worker* self, size_t index, task_type*& task);
+    bool take_inbox(task_type*& task);
+    bool steal(size_t thief, task_type*& task);
+    void run(worker* self, task_type* task);
+
+    // The worker of this pool that the calling thread is, nullptr otherwise
+    worker* local_worker(size_t& index) const;
+
+    static ThreadPool*& local_pool();
+    static size_t& local_index();
+};
+
+
+/*
+
+File: threadPool.cpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+// Implementation for ThreadPool, functions are inline to keep it header only
+
+#ifndef THREAD_POOL_TPP
+#define THREAD_POOL_TPP
+
+/*******************************************************************************
+CONSTRUCTORS
+*******************************************************************************/
+
+inline ThreadPool::ThreadPool(size_t workers) : pending(0), stopping(false)
+{
+    workers = (workers == 0) ? 1 : workers;
+
+    // Every deque exists before any worker can try to steal from it
+    for (size_t i = 0; i < workers; ++i)
+    {
+        this->workers.emplace_back(new worker);
+    }
+    for (size_t i = 0; i < workers; ++i)
+    {
+        this->workers[i]->thread = std::thread(&ThreadPool::work, this, i);
+    }
+}
+
+inline ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> guard(idle_lock);
+        stopping = true;
+    }
+    idle.notify_all();
+
+    for (std::unique_ptr<worker>& self : workers)
+    {
+        self->thread.join();
+    }
+}
+
+/*******************************************************************************
+INSPECTORS
+*******************************************************************************/
+
+inline size_t ThreadPool::size() const
+{
+    return workers.size();
+}
+
+inline std::vector<ThreadPool::worker_stats> ThreadPool::stats() const
+{
+    std::vector<worker_stats> result;
+    for (const std::unique_ptr<worker>& self : workers)
+    {
+        worker_stats entry = {
+            self->tasks_run.load(std::memory_order_relaxed),
+            self->steals.load(std::memory_order_relaxed),
+            std::chrono::nanoseconds(self->idle_nanoseconds.load(std::memory_order_relaxed))
+        };
+        result.push_back(entry);
+    }
+    return result;
+}
+
+inline void ThreadPool::reset_stats()
+{
+    for (std::unique_ptr<worker>& self : workers)
+    {
+        self->tasks_run.store(0, std::memory_order_relaxed);
+        self->steals.store(0, std::memory_order_relaxed);
+        self->idle_nanoseconds.store(0, std::memory_order_relaxed);
+    }
+    return;
+}
+
+/*******************************************************************************
+SCHEDULING
+*******************************************************************************/
+
+inline void ThreadPool::submit(task_type task)
+{
+    task_type* item = new task_type(std::move(task));
+
+    // Counted before it is visible, a worker may briefly find nothing to run
+    pending.fetch_add(1);
+
+    size_t index = 0;
+    worker* self = local_worker(index);
+    if (self != nullptr)
+    {
+        self->tasks.push(item);
+    }
+    else
+    {
+        std::lock_guard<std::mutex> guard(inbox_lock);
+        inbox.push_back(item);
+    }
+
+    // Taking the lock orders this wake up after a worker's check of pending
+    {
+        std::lock_guard<std::mutex> guard(idle_lock);
+    }
+    idle.notify_one();
+
+    return;
+}
+
+inline void ThreadPool::parallel_for(size_t count, const index_task& task)
+{
+    if (count == 0) { return; }
+
+    std::atomic<size_t> remaining(count);
+    std::mutex error_lock;
+    std::exception_ptr error;
+
+    auto run_index = [&task, &remaining, &error_lock, &error](size_t i)
+    {
+        try
+        {
+            task(i);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> guard(error_lock);
+            if (!error) { error = std::current_exception(); }
+        }
+        // Must be the last access, the caller's frame may be gone afterwards
+        remaining.fetch_sub(1, std::memory_order_release);
+    };
+
+    for (size_t i = 1; i < count; ++i)
+    {
+        submit([&run_index, i]() { run_index(i); });
+    }
+    run_index(0);
+
+    while (remaining.load(std::memory_order_acquire) != 0)
+    {
+        if (!try_run_one())
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    if (error) { std::rethrow_exception(error); }
+
+    return;
+}
+
+inline ThreadPool& ThreadPool::shared()
+{
+    static ThreadPool pool;
+    return pool;
+}
+
+inline size_t ThreadPool::default_workers()
+{
+    size_t cores = std::thread::hardware_concurrency();
+    return (cores == 0) ? 1 : cores;
+}
+
+/*******************************************************************************
+HELPER FUNCTIONS
+*******************************************************************************/
+
+inline void ThreadPool::work(size_t index)
+{
+    local_pool() = this;
+    local_index() = index;
+
+    worker* self = workers[index].get();
+
+    task_type* task = nullptr;
+    while (true)
+    {
+        if (find_task(self, index, task))
+        {
+            run(self, task);
+            continue;
+        }
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        {
+            std::unique_lock<std::mutex> guard(idle_lock);
+            idle.wait(guard, [this]() { return stopping || pending.load() != 0; });
+
+            if (stopping && pending.load() == 0) { return; }
+        }
+        self->idle_nanoseconds.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count(), std::memory_order_relaxed);
+    }
+}
+
+inline bool ThreadPool::try_run_one()
+{
+    size_t index = 0;
+    worker* self = local_worker(index);
+
+    task_type* task = nullptr;
+    if (find_task(self, index, task))
+    {
+        run(self, task);
+        return true;
+    }
+    return false;
+}
+
+inline bool ThreadPool::find_task(worker* self, size_t index, task_type*& task)
+{
+    // Own work first, newest first while its data is still in this core's cache
+    if (self != nullptr && self->tasks.pop(task))
+    {
+        pending.fetch_sub(1);
+        return true;
+    }
+    if (take_inbox(task))
+    {
+        return true;
+    }
+    if (steal(index, task))
+    {
+        if (self != nullptr)
+        {
+            self->steals.fetch_add(1, std::memory_order_relaxed);
+        }
+        return true;
+    }
+    return false;
+}
+
+inline bool ThreadPool::take_inbox(task_type*& task)
+{
+    std::lock_guard<std::mutex> guard(inbox_lock);
+
+    if (inbox.empty()) { return false; }
+
+    task = inbox.front();
+    inbox.pop_front();
+    pending.fetch_sub(1);
+
+    return true;
+}
+
+inline bool ThreadPool::steal(size_t thief, task_type*& task)
+{
+    for (size_t i = 1; i <= workers.size(); ++i)
+    {
+        worker& victim = *workers[(thief + i) % workers.size()];
+
+        // Oldest first, these tend to be the largest pieces of work
+        if (victim.tasks.steal(task))
+        {
+            pending.fetch_sub(1);
+            return true;
+        }
+    }
+    return false;
+}
+
+inline void ThreadPool::run(worker* self, task_type* task)
+{
+    (*task)();
+    delete task;
+
+    if (self != nullptr)
+    {
+        self->tasks_run.fetch_add(1, std::memory_order_relaxed);
+    }
+    return;
+}
+
+inline ThreadPool::worker* ThreadPool::local_worker(size_t& index) const
+{
+    if (local_pool() != this) { return nullptr; }
+
+    index = local_index();
+    return workers[index].get();
+}
+
+inline ThreadPool*& ThreadPool::local_pool()
+{
+    static thread_local ThreadPool* pool = nullptr;
+    return pool;
+}
+
+inline size_t& ThreadPool::local_index()
+{
+    static thread_local size_t index = 0;
+    return index;
+}
+
+#endif // THREAD_POOL_TPP
+#endif // THREAD_POOL_H
+namespace execution
+{
+
+inline std::atomic<Executor*>& injected_executor()
+{
+    static std::atomic<Executor*> executor(nullptr);
+    return executor;
+}
+
+// Replaces the shared pool for every policy without an executor of its own,
+// nullptr restores the shared pool. The executor must outlive its use.
+inline void set_default_executor(Executor* executor)
+{
+    injected_executor().store(executor);
+}
+
+inline Executor& default_executor()
+{
+    Executor* executor = injected_executor().load();
+    return (executor != nullptr) ? *executor : ThreadPool::shared();
+}
+
+class parallel_policy
+{
+public:
+
+    constexpr parallel_policy() : pool(nullptr), min_segment(1024) {}
+
+    // Runs on the given executor instead of the default one
+    parallel_policy on(Executor& executor) const
+    {
+        parallel_policy policy(*this);
+        policy.pool = &executor;
+        return policy;
+    }
+
+    // Lists are never split into segments shorter than this many nodes
+    parallel_policy grain(size_t nodes) const
+    {
+        parallel_policy policy(*this);
+        policy.min_segment = (nodes == 0) ? 1 : nodes;
+        return policy;
+    }
+
+    Executor& executor() const
+    {
+        return (pool != nullptr) ? *pool : default_executor();
+    }
+
+    size_t grain() const
+    {
+        return min_segment;
+    }
+
+private:
+
+    Executor* pool;
+    size_t min_segment;
+};
+
+constexpr parallel_policy par {};
+
+} // namespace execution
+
+#endif // EXECUTION_H
+
+/*
+
+File: listStats.hpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+/*
+Operation counters for LinkedList, compiled in only when LINKED_LIST_STATS is
+defined before the list is included:
+
+    #define LINKED_LIST_STATS
+    #include "linkedList.hpp"
+
+For every operation the counters record how often it was called and how
+many nodes it walked. A walk shared between operations counts under the one
+that does it, so the nodes unique() filters show up under remove. Node
+allocations and frees are counted, and max_length is the longest list a
+whole-list walk has seen.
+
+The counters are shared by every list in the process and are updated with
+relaxed atomics. Without LINKED_LIST_STATS the hooks expand to nothing and
+read() returns zeros. Define the macro the same way in every translation
+unit, or the list templates differ between them.
+
+    list_stats::write_json(std::cout);
+    list_stats::report([](const char* name, size_t value) { metrics.gauge(name, value); });
+*/
+
+#ifndef LIST_STATS_H
+#define LIST_STATS_H
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <string>
+
+namespace list_stats
+{
+
+enum class operation
+{
+    construct, copy, destroy, assign, push_front, push_back, pop_front, pop_back,
+    insert, erase, clear, size, equal, find, remove, unique, reverse, sort, parallel,
+    compact, at, rotate, resize, count
+};
+
+const size_t operation_count = static_cast<size_t>(operation::count);
+
+inline const char* name(operation op)
+{
+    static const char* names[operation_count] = {
+        "construct", "copy", "destroy", "assign", "push_front", "push_back", "pop_front",
+        "pop_back", "insert", "erase", "clear", "size", "equal", "find", "remove", "unique",
+        "reverse", "sort", "parallel", "compact", "at", "rotate", "resize"
+    };
+    return names[static_cast<size_t>(op)];
+}
+
+constexpr bool enabled()
+{
+#if defined(LINKED_LIST_STATS)
+    return true;
+#else
+    return false;
+#endif
+}
+
+struct snapshot
+{
+    size_t calls[operation_count];
+    size_t nodes[operation_count];
+    size_t allocations;
+    size_t frees;
+    size_t max_length;
+};
+
+// Static storage, so every counter starts at zero
+struct counters
+{
+    std::atomic<size_t> calls[operation_count];
+    std::atomic<size_t> nodes[operation_count];
+    std::atomic<size_t> allocations;
+    std::atomic<size_t> frees;
+    std::atomic<size_t> max_length;
+};
+
+inline counters& global()
+{
+    static counters totals;
+    return totals;
+}
+
+inline void record_call(operation op)
+{
+    global().calls[static_cast<size_t>(op)].fetch_add(1, std::memory_order_relaxed);
+}
+
+inline void record_nodes(operation op, size_t nodes)
+{
+    global().nodes[static_cast<size_t>(op)].fetch_add(nodes, std::memory_order_relaxed);
+}
+
+inline void record_allocations(size_t count)
+{
+    global().allocations.fetch_add(count, std::memory_order_relaxed);
+}
+
+inline void record_frees(size_t count)
+{
+    global().frees.fetch_add(count, std::memory_order_relaxed);
+}
+
+inline void record_length(size_t length)
+{
+    std::atomic<size_t>& longest = global().max_length;
+    size_t seen = longest.load(std::memory_order_relaxed);
+    while (length > seen && !longest.compare_exchange_weak(seen, length, std::memory_order_relaxed)) {}
+}
+
+// Counters at this moment. Taken without a lock, so a snapshot made while
+// lists are in use may mix counts from slightly different moments.
+inline snapshot read()
+{
+    counters& totals = global();
+    snapshot current;
+    for (size_t i = 0; i < operation_count; ++i)
+    {
+        current.calls[i] = totals.calls[i].load(std::memory_order_relaxed);
+        current.nodes[i] = totals.nodes[i].load(std::memory_order_relaxed);
+    }
+    current.allocations = totals.allocations.load(std::memory_order_relaxed);
+    current.frees = totals.frees.load(std::memory_order_relaxed);
+    current.max_length = totals.max_length.load(std::memory_order_relaxed);
+    return current;
+}
+
+inline void reset()
+{
+    counters& totals = global();
+    for (size_t i = 0; i < operation_count; ++i)
+    {
+        totals.calls[i].store(0, std::memory_order_relaxed);
+        totals.nodes[i].store(0, std::memory_order_relaxed);
+    }
+    totals.allocations.store(0, std::memory_order_relaxed);
+    totals.frees.store(0, std::memory_order_relaxed);
+    totals.max_length.store(0, std::memory_order_relaxed);
+}
+
+// Hands every counter to the callback by name, "<operation>.calls",
+// "<operation>.nodes", "allocations", "frees" and "max_length"
+inline void report(const std::function<void(const char* name, size_t value)>& callback)
+{
+    snapshot current = read();
+    for (size_t i = 0; i < operation_count; ++i)
+    {
+        std::string prefix = name(static_cast<operation>(i));
+        callback((prefix + ".calls").c_str(), current.calls[i]);
+        callback((prefix + ".nodes").c_str(), current.nodes[i]);
+    }
+    callback("allocations", current.allocations);
+    callback("frees", current.frees);
+    callback("max_length", current.max_length);
+}
+
+inline void write_json(std::ostream& out)
+{
+    snapshot current = read();
+    out << "{\"enabled\": " << (enabled() ? "true" : "false") << ", \"operations\": {";
+    for (size_t i = 0; i < operation_count; ++i)
+    {
+        out << (i == 0 ? "" : ", ") << '"' << name(static_cast<operation>(i))
+            << "\": {\"calls\": " << current.calls[i] << ", \"nodes\": " << current.nodes[i] << '}';
+    }
+    out << "}, \"allocations\": " << current.allocations << ", \"frees\": " << current.frees
+        << ", \"max_length\": " << current.max_length << "}\n";
+}
+
+} // namespace list_stats
+
+// Hooks used inside LinkedList. LIST_STATS_COUNTER declares a local counter
+// for walks that do not count their nodes already.
+#if defined(LINKED_LIST_STATS)
+#define LIST_STATS_CALL(op) ::list_stats::record_call(::list_stats::operation::op)
+#define LIST_STATS_NODES(op, n) ::list_stats::record_nodes(::list_stats::operation::op, (n))
+#define LIST_STATS_ALLOCATIONS(n) ::list_stats::record_allocations(n)
+#define LIST_STATS_FREES(n) ::list_stats::record_frees(n)
+#define LIST_STATS_LENGTH(n) ::list_stats::record_length(n)
+#define LIST_STATS_COUNTER(counter) size_t counter = 0
+#define LIST_STATS_STEP(counter) ++(counter)
+#else
+#define LIST_STATS_CALL(op) ((void)0)
+#define LIST_STATS_NODES(op, n) ((void)0)
+#define LIST_STATS_ALLOCATIONS(n) ((void)0)
+#define LIST_STATS_FREES(n) ((void)0)
+#define LIST_STATS_LENGTH(n) ((void)0)
+#define LIST_STATS_COUNTER(counter) ((void)0)
+#define LIST_STATS_STEP(counter) ((void)0)
+#endif
+
+#endif // LIST_STATS_H
+
+/*
+
+File: memoryFootprint.hpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+/*
+Helpers behind the memory_usage() of the lists.
+
+allocated_size() is what the allocator takes for a request, including its
+header and rounding. It follows glibc malloc on 64 bit systems, which
+prefixes each block with a size word and rounds blocks to 16 bytes with a
+minimum of 32. Other allocators differ by a few bytes per block, so treat
+the result as an estimate there.
+
+owned_bytes() is the heap memory a value owns beyond its own object, the
+buffer of a long std::string for example. It is zero for any other type.
+Types that own memory can report it with an overload found by argument
+dependent lookup:
+
+    namespace service
+    {
+        size_t owned_bytes(const Record& record) { return footprint::allocated_size(record.size); }
+    }
+*/
+
+#ifndef MEMORY_FOOTPRINT_H
+#define MEMORY_FOOTPRINT_H
+
+#include <cstddef>
+#include <functional>
+#include <string>
+
+namespace footprint
+{
+
+inline size_t allocated_size(size_t requested)
+{
+    const size_t word = sizeof(size_t);
+    const size_t alignment = 2 * word;
+    const size_t minimum = 4 * word;
+
+    size_t block = (requested + word + alignment - 1) / alignment * alignment;
+    return (block < minimum) ? minimum : block;
+}
+
+template <typename T>
+size_t owned_bytes(const T&) { return 0; }
+
+// Short strings are stored inside the string object and own nothing
+template <typename Char, typename Traits, typename Allocator>
+size_t owned_bytes(const std::basic_string<Char, Traits, Allocator>& value)
+{
+    const char* object = reinterpret_cast<const char*>(&value);
+    const char* data = reinterpret_cast<const char*>(value.data());
+    std::less<const char*> before;
+
+    if (!before(data, object) && before(data, object + sizeof(value))) { return 0; }
+    return allocated_size((value.capacity() + 1) * sizeof(Char));
+}
+
+// The owned bytes of a value, with the user's overloads taken into account
+template <typename T>
+size_t value_bytes(const T& value)
+{
+    return owned_bytes(value);
+}
+
+} // namespace footprint
+
+#endif // MEMORY_FOOTPRINT_H
+
+/*
+
+File: prefetch.hpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+/*
+Prefetch hints for the walks of LinkedList, compiled in only when
+LINKED_LIST_PREFETCH is defined before the list is included:
+
+    #define LINKED_LIST_PREFETCH
+    #include "linkedList.hpp"
+
+A walk asks for the next node as soon as it has read the link to it, so the
+miss on that node overlaps the work done on the current one: the predicate
+of find_if, the allocation and copy of the copy constructor, the free of
+clear. The load of each node still depends on the one before it, so the
+gain is largest when that work is heavy and the list is out of cache, and
+nothing at all for a compact list that is walked in order anyway.
+prefetchBenchmark shows the difference on large scattered lists.
+
+Without the macro, or on compilers other than GCC and Clang, the hints
+expand to nothing. Define the macro the same way in every translation unit,
+or the list templates differ between them.
+*/
+
+#ifndef LIST_PREFETCH_H
+#define LIST_PREFETCH_H
+
+// Hints that the memory at address is about to be read
+#if defined(LINKED_LIST_PREFETCH) && (defined(__GNUC__) || defined(__clang__))
+#define LIST_PREFETCH(address) __builtin_prefetch(address)
+#else
+#define LIST_PREFETCH(address) ((void)0)
+#endif
+
+#endif // LIST_PREFETCH_H
+template<typename T>
+class LinkedList
+{
+public:
+
+    /* Type Defs */
+    typedef size_t size_type;
+    typedef T value_type;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef forward_iterator<T> iterator;
+    typedef const_forward_iterator<T> const_iterator;
+    typedef Node<T>* node_pointer;
+
+    /* Constructors */
+
+    // The fill, copy and initializer list constructors, and the range
+    // constructor over forward iterators, know the length up front and build
+    // the nodes in one block, like compact() does. Lists of fewer than
+    // batch_minimum elements allocate their nodes one by one.
+
+    // Default
+    LinkedList();
+
+    // Fill
+    LinkedList(size_type count, const_reference data);
+
+    // Range
+    template <typename InputIterator, typename ::std::enable_if< ::std::is_constructible
+             < T, decltype(*::std::declval<InputIterator>()) >::value >::type* = nullptr >
+    LinkedList(InputIterator begin, InputIterator end);
+
+    // Copy
+    LinkedList(const LinkedList<value_type>& origin);
+
+    // Initializer List
+    explicit LinkedList(std::initializer_list<value_type> init);
+
+    // Destructor
+    ~LinkedList();
+
+    /* Iterators */
+    const_iterator cbegin() const noexcept;
+    const_iterator begin() const;
+    iterator begin();
+
+    const_iterator cend() const noexcept;
+    const_iterator end() const;
+    iterator end();
+
+    /* Element Access */
+
+    // The element at position i, throws std::out_of_range past the end. The
+    // walk starts from the closest of the head, the position accessed last
+    // and a node recorded every skip_stride positions, so sequential or
+    // nearby accesses cost the distance moved. The const overload uses what
+    // earlier accesses recorded but records nothing itself.
+    reference at(size_type i);
+    const_reference at(size_type i) const;
+
+    /* Modifiers */
+    void push_front(const_reference data);
+    void push_back(const_reference data);
+    
+    void pop_front();
+    reference pop_front(reference out_data);
+    void pop_back();
+    reference pop_back(reference out_data);
+    
+    void insert(const_iterator& position, const_reference data);
+    void insert(const_iterator position, size_type n, const_reference data);
+    template <typename InputIterator, typename ::std::enable_if< ::std::is_constructible
+             < T, decltype(*::std::declval<InputIterator>()) >::value >::type* = nullptr >
+    void insert(const_iterator position, InputIterator begin, InputIterator end);
+
+    iterator erase(iterator& position);
+    iterator erase(iterator& first, iterator& last);
+
+    // Inserts data at position i, 0 <= i <= size(), and returns an iterator
+    // to it. Throws std::out_of_range past the end.
+    iterator insert_at(size_type i, const_reference data);
+
+    // Erases the element at position i and returns an iterator to the one
+    // that followed it. Throws std::out_of_range past the end.
+    iterator erase_at(size_type i);
+    
+    void clear();
+
+    // Replaces the contents, built in one block like the constructors. The
+    // list is unchanged if building the new contents throws.
+    template <typename InputIterator, typename ::std::enable_if< ::std::is_constructible
+             < T, decltype(*::std::declval<InputIterator>()) >::value >::type* = nullptr >
+    void assign(InputIterator first, InputIterator last);
+    void assign(size_type n, const_reference value);
+
+    // Erases the elements past the first n, or appends copies of value until
+    // there are n, the appended nodes in one block
+    void resize(size_type n);
+    void resize(size_type n, const_reference value);
+
+    /* Capacity */
+    bool empty() const;
+    size_type size() const;
+
+    // Bytes held by the list: the list object, a heap block per node with the
+    // allocator's overhead or the compaction blocks holding them, and the
+    // memory the values own. Walks the list.
+    size_type memory_usage() const;
+
+    /* Compaction */
+
+    // Moves every node, with its value, into one block in list order, so a
+    // walk reads memory sequentially again after churn has scattered the
+    // nodes. Iterators, pointers and references to the elements are
+    // invalidated. Nodes inserted later are allocated one by one as before,
+    // and the slot of an erased node is given back with its block once the
+    // block's last node is erased or moved out.
+    void compact();
+
+    // The same in bounded steps: moves at most steps nodes, continuing where
+    // the previous call stopped, and returns true once the whole list has
+    // been moved. Inserting between steps is fine, erasing the node moved
+    // last, sorting or reversing the list starts the next step over from the
+    // front.
+    bool compact(size_type steps);
+
+    /* Operations */
+    void reverse() noexcept;
+
+    // Reverses the elements from first up to, not including, last. Walks to
+    // first, iterators keep pointing to the same elements.
+    void reverse(const_iterator first, const_iterator last) noexcept;
+
+    // Makes middle the first element and the elements before it the last,
+    // returns an iterator to the element that was first. Walks to middle.
+    iterator rotate(const_iterator middle) noexcept;
+
+    void remove(const_reference target);
+    template <class Predicate>
+    void remove_if(Predicate pred);
+
+    iterator find(const_reference target);
+    template <class Predicate>
+    iterator find_if(Predicate pred);
+    
+    // Keeps the first occurrence of every value, T must be hashable. The
+    // overload with hash and equal works for any T they can handle.
+    void unique();
+    template <class Hash, class Equal>
+    void unique(Hash hash, Equal equal);
+
+    // Erases every element for which pred(kept, element) holds, kept being
+    // the last element not erased, like std::unique
+    void unique_adjacent();
+    template <class BinaryPredicate>
+    void unique_adjacent(BinaryPredicate pred);
+
+    // The list must be sorted ascending, only operator< is used
+    void unique_sorted();
+
+    template <class Comparator>
+    void sort(Comparator compare);
+    void sort();
+
+    /* Parallel Operations */
+    template <class Function>
+    void for_each(const execution::parallel_policy& policy, Function f);
+
+    // In place, every element is replaced by op(element)
+    template <class UnaryOperation>
+    void transform(const execution::parallel_policy& policy, UnaryOperation op);
+
+    // op must be associative, partial results are combined in list order
+    template <typename U, class BinaryOperation>
+    U reduce(const execution::parallel_policy& policy, U init, BinaryOperation op) const;
+    template <typename U, class BinaryOperation, class UnaryOperation>
+    U transform_reduce(const execution::parallel_policy& policy, U init,
+                       BinaryOperation combine, UnaryOperation convert) const;
+
+    template <class Predicate>
+    size_type count_if(const execution::parallel_policy& policy, Predicate pred) const;
+    template <class Predicate>
+    bool any_of(const execution::parallel_policy& policy, Predicate pred) const;
+    template <class Predicate>
+    bool all_of(const execution::parallel_policy& policy, Predicate pred) const;
+
+    // Always returns the first match by position, later segments are cancelled
+    iterator find(const execution::parallel_policy& policy, const_reference target);
+    template <class Predicate>
+    iterator find_if(const execution::parallel_policy& policy, Predicate pred);
+
+    void remove(const execution::parallel_policy& policy, const_reference target);
+    template <class Predicate>
+    void remove_if(const execution::parallel_policy& policy, Predicate pred);
+
+    // Keeps the first occurrence of every value, T must be hashable
+    void unique(const execution::parallel_policy& policy);
+
+    template <class Comparator>
+    void sort(const execution::parallel_policy& policy, Comparator compare);
+    void sort(const execution::parallel_policy& policy);
+
+    /* Operator Overloads */
+    inline bool operator==(const LinkedList<value_type>& rhs) const;
+    inline bool operator!=(const LinkedList<value_type>& rhs) const;
+    LinkedList<value_type>& operator=(LinkedList<value_type> list);
+
+    /* Swap */
+    void swap(LinkedList<value_type>& newList, LinkedList<value_type>& oldList) noexcept;
+
+
+
+private:
+
+    typedef typename std::aligned_storage<sizeof(Node<T>), alignof(Node<T>)>::type slot;
+
+    // Slots that compact() and the bulk constructors build nodes in, used in
+    // order. live counts the nodes built and not destroyed yet, the block is
+    // freed when it drops to zero. It is atomic because the workers of the
+    // parallel remove_if and unique destroy nodes of the same block.
+    struct node_block
+    {
+        node_block(slot* slots, size_type capacity) noexcept
+            : slots(slots), capacity(capacity), used(0), live(0) {}
+
+        node_block(const node_block& origin) noexcept
+            : slots(origin.slots), capacity(origin.capacity), used(origin.used),
+              live(origin.live.load(std::memory_order_relaxed)) {}
+
+        node_block& operator=(const node_block& origin) noexcept
+        {
+            slots = origin.slots;
+            capacity = origin.capacity;
+            used = origin.used;
+            live.store(origin.live.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            return *this;
+        }
+
+        slot* slots;
+        size_type capacity;
+        size_type used;
+        std::atomic<size_type> live;
+    };
+
+    // The blocks of compact() and the bulk constructors
+    struct compaction
+    {
+        // Oldest first, the blocks from pass_begin on belong to the running pass
+        std::vector<node_block> blocks;
+        size_type pass_begin;
+
+        // The node the running pass moved last, null before its first step
+        node_pointer cursor;
+        bool running;
+    };
+
+    struct skip
+    {
+        size_type position;
+        node_pointer node;
+    };
+
+    // Recorded by at(), insert_at() and erase_at(). Inserting or erasing
+    // renumbers the skips after the change, modifiers that relink or move
+    // nodes drop everything.
+    struct position_index
+    {
+        // The position accessed last and its node, null when unknown
+        size_type finger_position;
+        node_pointer finger;
+
+        // In position order, recorded by positional walks whenever they get
+        // skip_stride nodes past the last skip. The head needs none.
+        std::vector<skip> skips;
+    };
+
+    static const size_type skip_stride = 32;
+
+    // Created by the first compact(), block of nodes built in bulk or
+    // positional access of a non empty list, other lists only pay the
+    // pointer to it
+    struct side_state
+    {
+        compaction compacted;
+        position_index indexed;
+    };
+
+    node_pointer head;
+    node_pointer tail;
+    side_state* extras;
+
+    /* Helper functions */
+
+    // Creates the side state on first use
+    side_state& side();
+
+    // Reverses the nodes from first up to last, first then links to last.
+    // Returns the node that starts the reversed run.
+    node_pointer reverse_links(node_pointer first, node_pointer last) noexcept;
+
+    std::vector<node_pointer> segments(const execution::parallel_policy& policy) const;
+
+    // Links the nodes from first up to last that discard rejects, frees the
+    // others, concurrently like release()
+    template <class Predicate>
+    void filter(node_pointer first, node_pointer last, Predicate discard,
+                node_pointer& kept_first, node_pointer& kept_last, bool concurrently = false);
+
+    void stitch(const std::vector<node_pointer>& firsts, const std::vector<node_pointer>& lasts);
+
+    // Destroys a node and frees it. A node in a compaction block is destroyed
+    // in place and the block freed with its last node. Threads releasing
+    // nodes concurrently leave the emptied blocks to reclaim_blocks().
+    void release(node_pointer node, bool concurrently = false) noexcept;
+
+    // The index of the block holding node, the number of blocks if none does
+    size_type block_of(const Node<T>* node) const noexcept;
+    bool in_block(const Node<T>* node) const noexcept;
+
+    // Stops a running compaction pass, the next step starts a new one
+    void interrupt_compaction() noexcept;
+
+    // Frees the first n compaction blocks, their nodes have all been moved
+    // out or destroyed
+    void free_blocks(size_type n) noexcept;
+
+    // Frees block i, or every block without live nodes
+    void free_block(size_type i) noexcept;
+    void reclaim_blocks() noexcept;
+
+    // A block, its bookkeeping and the vector holding it cost about as much
+    // as the allocator's overhead on ten nodes, so shorter lists would take
+    // more memory from a block. Past block_limit blocks, which release()
+    // searches, nodes are allocated one by one again.
+    static const size_type batch_minimum = 12;
+    static const size_type block_limit = 16;
+
+    // Yields the same value forever, a source for append()
+    struct repeat
+    {
+        const T* value;
+
+        const T& operator*() const { return *value; }
+        repeat& operator++() { return *this; }
+    };
+
+    // Adds an empty block of n slots
+    node_block& open_block(size_type n);
+
+    // Appends n nodes built from the values source yields
+    template <class Source>
+    void append(Source source, size_type n);
+
+    // Copies the n nodes of origin into one block. A trivially copyable Node
+    // is its bytes and is copied in runs, other nodes one value at a time.
+    void copy_runs(const LinkedList<T>& origin, size_type n, std::true_type);
+    void copy_runs(const LinkedList<T>& origin, size_type n, std::false_type);
+
+    // The nodes from node on that follow each other in one block as they do
+    // in the list, at least 1 and at most limit. A node outside the blocks is
+    // a run of its own.
+    size_type run_length(const Node<T>* node, size_type limit) const noexcept;
+
+    // The longest run operator== compares before loading the next link
+    static const size_type run_chunk = 64;
+
+    template <typename InputIterator>
+    void append_range(InputIterator first, InputIterator last, std::input_iterator_tag);
+    template <typename ForwardIterator>
+    void append_range(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag);
+
+    // The node at position i or nullptr past the end. With record set the
+    // walk adds skips and moves the finger, extras must exist.
+    node_pointer seek(size_type i, bool record) const;
+
+    // An element was inserted at or erased from position
+    void shift_positions(size_type position, bool inserted) noexcept;
+
+    // The tail is about to be erased
+    void forget_tail() noexcept;
+
+    void forget_positions() noexcept;
+
+};
+
+
+/*
+
+File: LinkedList.cpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#ifndef LINKED_LIST_TPP
+#define LINKED_LIST_TPP
+
+#include "linkedList.hpp"
+
+/*******************************************************************************
+CONSTRUCTORS
+*******************************************************************************/
+
+// Default
+template <typename T>
+LinkedList<T>::LinkedList() 
+    : head(nullptr), tail(nullptr), extras(nullptr) {}
+// Fill
+template <typename T>
+LinkedList<T>::LinkedList(size_type count, const_reference data) : LinkedList()
+{
+    LIST_STATS_CALL(construct);
+
+    repeat source = { &data };
+    append(source, count);
+}
+
+// Range
+template <typename T>
+template <typename InputIterator, typename ::std::enable_if< ::std::is_constructible
+         < T, decltype(*::std::declval<InputIterator>()) >::value >::type* >
+LinkedList<T>::LinkedList(InputIterator begin, InputIterator end) : LinkedList()
+{
+    LIST_STATS_CALL(construct);
+    append_range(begin, end, typename std::iterator_traits<InputIterator>::iterator_category());
+}
+
+// Copy
+template <typename T>
+LinkedList<T>::LinkedList(const LinkedList<value_type>& origin) : LinkedList()
+{
+    LIST_STATS_CALL(copy);
+
+    // Counting first lets the copies go into one block. Runs of nodes laid
+    // out in order are counted without waiting on each link.
+    size_type count = 0;
+    for (const Node<T>* current = origin.head; current != nullptr; )
+    {
+        LIST_PREFETCH(current->next());
+        size_type run = origin.run_length(current, std::numeric_limits<size_type>::max());
+        count += run;
+        current = current[run - 1].next();
+    }
+    LIST_STATS_NODES(copy, count);
+    LIST_STATS_LENGTH(count);
+
+    if (count >= batch_minimum)
+    {
+        copy_runs(origin, count, std::is_trivially_copyable<Node<T> >());
+        return;
+    }
+    append(origin.cbegin(), count);
+}
+
+// Initializer List
+template <typename T>
+LinkedList<T>::LinkedList(std::initializer_list<value_type> init) : LinkedList()
+{
+    LIST_STATS_CALL(construct);
+    append(init.begin(), init.size());
+}
+
+// Destructor
+template <typename T>
+LinkedList<T>::~LinkedList() 
+{
+    LIST_STATS_CALL(destroy);
+    clear();
+}
+
+/*******************************************************************************
+ITERATORS
+*******************************************************************************/
+
+template <typename T>
+typename LinkedList<T>::const_iterator LinkedList<T>::cbegin() const noexcept
+{
+    return const_iterator(head);
+}
+
+template <typename T>
+typename LinkedList<T>::const_iterator LinkedList<T>::begin() const
+{
+    return const_iterator(head);
+} 
+
+template <typename T>
+typename LinkedList<T>::iterator LinkedList<T>::begin()
+{
+    return iterator(head);
+} 
+
+template <typename T>
+typename LinkedList<T>::const_iterator LinkedList<T>::cend() const noexcept
+{
+    return const_iterator(nullptr);
+}
+
+template <typename T>
+typename LinkedList<T>::const_iterator LinkedList<T>::end() const
+{
+    return const_iterator(nullptr);
+} 
+
+template <typename T>
+typename LinkedList<T>::iterator LinkedList<T>::end()
+{
+    return iterator(nullptr);
+} 
+
+/*******************************************************************************
+ELEMENT ACCESS
+*******************************************************************************/
+
+template <typename T>
+typename LinkedList<T>::reference LinkedList<T>::at(size_type i)
+{
+    LIST_STATS_CALL(at);
+
+    if (!empty()) { side(); }
+
+    node_pointer node = seek(i, extras != nullptr);
+    if (node == nullptr) { throw std::out_of_range("LinkedList::at: position past the end"); }
+
+    return *node->data();
+}
+
+template <typename T>
+typename LinkedList<T>::const_reference LinkedList<T>::at(size_type i) const
+{
+    LIST_STATS_CALL(at);
+
+    node_pointer node = seek(i, false);
+    if (node == nullptr) { throw std::out_of_range("LinkedList::at: position past the end"); }
+
+    return *node->data();
+}
+
+/*******************************************************************************
+MODIFIERS
+*******************************************************************************/
+
+template <typename T>
+void LinkedList<T>::push_front(const_reference data)
+{
+    LIST_STATS_CALL(push_front);
+
+    node_pointer temp = new Node<T>(data);
+    LIST_STATS_ALLOCATIONS(1);
+
+    temp->next(head);
+    head = temp;
+
+    if (tail == nullptr)
+    {
+        tail = head;
+    }
+    shift_positions(0, true);
+
+    return;
+}
+
+template <typename T>
+void LinkedList<T>::push_back(const_reference data)
+{
+    LIST_STATS_CALL(push_back);
+
+    if (empty())
+    {
+        push_front(data);
+        return;
+    }
+
+    node_pointer temp = new Node<T>(data);
+    LIST_STATS_ALLOCATIONS(1);
+
+    tail->next(temp);
+    tail = temp;
+
+    return;
+}
+
+template<typename T>
+void LinkedList<T>::pop_front()
+{
+    LIST_STATS_CALL(pop_front);
+
+    if (empty()) { return; }
+
+    node_pointer next = head->next();
+
+    release(head);
+    LIST_STATS_FREES(1);
+    head = next;
+    shift_positions(0, false);
+
+    if (head == nullptr)
+    {
+        tail = nullptr;
+    }
+
+    return;
+}
+
+template<typename T>
+T& LinkedList<T>::pop_front(reference out_data)
+{
+    LIST_STATS_CALL(pop_front);
+
+    if (empty()) { return out_data; }
+
+    node_pointer next = head->next();
+    out_data = *head->data();
+
+    release(head);
+    LIST_STATS_FREES(1);
+    head = next;
+    shift_positions(0, false);
+
+    if (head == nullptr)
+    {
+        tail = nullptr;
+    }
+
+    return out_data;
+}
+
+template<typename T>
+void LinkedList<T>::pop_back()
+{
+    LIST_STATS_CALL(pop_back);
+
+    if (head == tail)
+    {
+        pop_front();
+        return;
+    }
+
+    node_pointer previous = head; 
+    LIST_STATS_COUNTER(walked);
+
+    while (previous->next() != tail)
+    {
+        previous = previous->next();
+        LIST_STATS_STEP(walked);
+    }
+    LIST_STATS_NODES(pop_back, walked);
+    forget_tail();
+    release(tail);
+    LIST_STATS_FREES(1);
+
+    previous->next(nullptr);
+    tail = previous;
+
+    return; 
+
+}
+
+template<typename T>
+T& LinkedList<T>::pop_back(reference out_data)
+{
+    LIST_STATS_CALL(pop_back);
+
+    if (head == tail)
+    {
+        return pop_front(out_data);
+    }
+
+    node_pointer previous = head; 
+    LIST_STATS_COUNTER(walked);
+
+    while (previous->next() != tail)
+    {
+        previous = previous->next();
+        LIST_STATS_STEP(walked);
+    }
+    LIST_STATS_NODES(pop_back, walked);
+    out_data = *tail->data();
+    forget_tail();
+    release(tail);
+    LIST_STATS_FREES(1);
+
+    previous->next(nullptr);
+    tail = previous;
+
+    return out_data; 
+}
+
+template<typename T>
+void LinkedList<T>::insert(const_iterator& position, const_reference data)
+{
+    LIST_STATS_CALL(insert);
+
+    if(empty())
+    {
+        push_front(data);
+        position = iterator(head); 
+        return;
+    }
+
+    // Appending shifts no position, anything else shifts an unknown one
+    if (position.node != tail)
+    {
+        forget_positions();
+    }
+
+    node_pointer newNode = new Node<T>(data);
+    LIST_STATS_ALLOCATIONS(1);
+    newNode->next(position.node->next());
+
+    position.node->next(newNode);
+
+    if(tail->next() == newNode)
+    {
+        tail = newNode;
+    }
+ 
+    return;
+}
+
+template <typename T>
+void LinkedList<T>::insert(const_iterator position, size_type n, const_reference data)
+{
+    if (n == 0) { return; }
+
+    if (empty())
+    {
+        push_front(data);
+        position = iterator(head);
+        --n;
+    }
+
+    for (; n > 0; --n)
+    {
+        insert(position, data);
+        ++position;
+    }
+    return;
+}
+
+template <typename T>
+template <typename InputIterator, typename ::std::enable_if< ::std::is_constructible
+         < T, decltype(*::std::declval<InputIterator>()) >::value >::type* >
+void LinkedList<T>::insert(const_iterator position, InputIterator begin, InputIterator end)
+{
+    if (begin == end) { return; }
+
+    if (empty())
+    {
+        push_front(*begin++);
+        position = iterator(head);
+    }
+
+    for(;begin != end; ++begin)
+    {
+        insert(position, *begin);
+        ++position;
+    }
+    return;
+}
+
+template<typename T>
+typename LinkedList<T>::iterator 
+LinkedList<T>::erase(iterator& position)
+{
+    LIST_STATS_CALL(erase);
+
+    if (empty()) { return position; }
+
+    node_pointer previous = head;
+    size_type index = 0;
+    LIST_STATS_COUNTER(walked);
+
+    if (previous != position.node)
+    {
+        index = 1;
+        while (previous->next() != position.node)
+        {
+            previous = previous->next();
+            ++index;
+            LIST_STATS_STEP(walked);
+        }
+    }
+    LIST_STATS_NODES(erase, walked);
+    shift_positions(index, false);
+
+    previous->next(position.node->next());
+
+    node_pointer temp = position.node;
+
+    if (temp == tail)
+    {
+        tail = (temp == head) ? nullptr : previous;
+    }
+
+    if (temp == head)
+    {
+        head = head->next();
+    }
+
+    position = iterator(previous->next());
+
+    release(temp);
+    LIST_STATS_FREES(1);
+
+    return position;
+}
+
+template<typename T>
+typename LinkedList<T>::iterator 
+LinkedList<T>::erase(iterator& first, iterator& last)
+{
+    while (first != last)
+    {
+        first = erase(first);
+    }
+
+    return first;
+}
+
+template <typename T>
+typename LinkedList<T>::iterator LinkedList<T>::insert_at(size_type i, const_reference data)
+{
+    if (i == 0)
+    {
+        push_front(data);
+        return begin();
+    }
+
+    LIST_STATS_CALL(insert);
+
+    if (!empty()) { side(); }
+
+    node_pointer previous = seek(i - 1, extras != nullptr);
+    if (previous == nullptr) { throw std::out_of_range("LinkedList::insert_at: position past the end"); }
+
+    node_pointer node = new Node<T>(data);
+    LIST_STATS_ALLOCATIONS(1);
+    node->next(previous->next());
+    previous->next(node);
+
+    if (previous == tail)
+    {
+        tail = node;
+    }
+
+    shift_positions(i, true);
+    extras->indexed.finger = node;
+    extras->indexed.finger_position = i;
+
+    return iterator(node);
+}
+
+template <typename T>
+typename LinkedList<T>::iterator LinkedList<T>::erase_at(size_type i)
+{
+    if (i == 0)
+    {
+        if (empty()) { throw std::out_of_range("LinkedList::erase_at: position past the end"); }
+
+        pop_front();
+        return begin();
+    }
+
+    LIST_STATS_CALL(erase);
+
+    if (!empty()) { side(); }
+
+    // The finger stays on the node before, which is still at i - 1
+    node_pointer previous = seek(i - 1, extras != nullptr);
+    if (previous == nullptr || previous->next() == nullptr)
+    {
+        throw std::out_of_range("LinkedList::erase_at: position past the end");
+    }
+
+    node_pointer node = previous->next();
+    previous->next(node->next());
+
+    if (node == tail)
+    {
+        tail = previous;
+    }
+
+    shift_positions(i, false);
+    release(node);
+    LIST_STATS_FREES(1);
+
+    return iterator(previous->next());
+}
+
+
+template <typename T>
+void LinkedList<T>::clear()
+{
+    LIST_STATS_CALL(clear);
+
+    interrupt_compaction();
+
+    node_pointer previous = head;
+    LIST_STATS_COUNTER(walked);
+
+    // Nodes in a block are only destroyed, without counting down the block's
+    // live nodes, since every block is freed below
+    while (head != nullptr)
+    {
+        previous = head;
+        head = head->next();
+        LIST_PREFETCH(head);
+        if (in_block(previous)) { previous->~Node<T>(); }
+        else { delete previous; }
+        LIST_STATS_STEP(walked);
+    }
+    tail = nullptr;
+
+    LIST_STATS_NODES(clear, walked);
+    LIST_STATS_FREES(walked);
+    LIST_STATS_LENGTH(walked);
+
+    if (extras != nullptr)
+    {
+        free_blocks(extras->compacted.blocks.size());
+        delete extras;
+        extras = nullptr;
+    }
+    return;
+}
+
+template <typename T>
+template <typename InputIterator, typename ::std::enable_if< ::std::is_constructible
+         < T, decltype(*::std::declval<InputIterator>()) >::value >::type* >
+void LinkedList<T>::assign(InputIterator first, InputIterator last)
+{
+    LIST_STATS_CALL(assign);
+
+    LinkedList<T> replacement(first, last);
+    swap(*this, replacement);
+    return;
+}
+
+template <typename T>
+void LinkedList<T>::assign(size_type n, const_reference value)
+{
+    LIST_STATS_CALL(assign);
+
+    LinkedList<T> replacement(n, value);
+    swap(*this, replacement);
+    return;
+}
+
+template <typename T>
+void LinkedList<T>::resize(size_type n)
+{
+    resize(n, T());
+    return;
+}
+
+template <typename T>
+void LinkedList<T>::resize(size_type n, const_reference value)
+{
+    LIST_STATS_CALL(resize);
+
+    if (n == 0)
+    {
+        clear();
+        return;
+    }
+
+    // Walks to the last node that stays, or counts a list too short
+    size_type count = 1;
+    node_pointer last = head;
+    while (last != nullptr && count < n && last->next() != nullptr)
+    {
+        last = last->next();
+        ++count;
+    }
+    LIST_STATS_NODES(resize, (last != nullptr) ? count : 0);
+
+    if (last == nullptr || count < n)
+    {
+        repeat source = { &value };
+        append(source, n - ((last == nullptr) ? 0 : count));
+        return;
+    }
+
+    // Already n elements, nothing to erase
+    if (last->next() == nullptr)
+    {
+        return;
+    }
+
+    forget_positions();
+
+    node_pointer rest = last->next();
+    last->next(nullptr);
+    tail = last;
+
+    while (rest != nullptr)
+    {
+        node_pointer next = rest->next();
+        release(rest);
+        LIST_STATS_FREES(1);
+        rest = next;
+    }
+    return;
+}
+
+/*******************************************************************************
+CAPACITY
+*******************************************************************************/ 
+
+template <typename T>
+bool LinkedList<T>::empty() const
+{
+    return !(head);
+}
+
+template <typename T>
+size_t LinkedList<T>::size() const
+{
+    LIST_STATS_CALL(size);
+
+    size_type SIZE = 0;
+
+    for(const_iterator it = cbegin(); it != cend(); ++it)
+    {
+        LIST_PREFETCH(it.node->next());
+        ++SIZE;
+    }
+    LIST_STATS_NODES(size, SIZE);
+    LIST_STATS_LENGTH(SIZE);
+
+    return SIZE;
+}
+
+template <typename T>
+size_t LinkedList<T>::memory_usage() const
+{
+    size_type bytes = sizeof(*this);
+
+    if (extras != nullptr)
+    {
+        const std::vector<node_block>& blocks = extras->compacted.blocks;
+        const std::vector<skip>& skips = extras->indexed.skips;
+
+        bytes += footprint::allocated_size(sizeof(side_state));
+        if (blocks.capacity() > 0)
+        {
+            bytes += footprint::allocated_size(blocks.capacity() * sizeof(node_block));
+        }
+        for (const node_block& block : blocks)
+        {
+            bytes += footprint::allocated_size(block.capacity * sizeof(slot));
+        }
+        if (skips.capacity() > 0)
+        {
+            bytes += footprint::allocated_size(skips.capacity() * sizeof(skip));
+        }
+    }
+
+    for (node_pointer current = head; current != nullptr; current = current->next())
+    {
+        LIST_PREFETCH(current->next());
+        if (!in_block(current))
+        {
+            bytes += footprint::allocated_size(sizeof(Node<T>));
+        }
+        bytes += footprint::value_bytes(*current->data());
+    }
+
+    return bytes;
+}
+
+/*******************************************************************************
+COMPACTION
+*******************************************************************************/
+
+template <typename T>
+void LinkedList<T>::compact()
+{
+    interrupt_compaction();
+
+    size_type count = 0;
+    for (node_pointer current = head; current != nullptr; current = current->next())
+    {
+        ++count;
+    }
+
+    // One block that fits the whole list, the pass never opens another
+    if (count > 0)
+    {
+        compaction& state = side().compacted;
+        state.running = true;
+        state.pass_begin = state.blocks.size();
+
+        node_block block(new slot[count], count);
+        state.blocks.push_back(block);
+    }
+
+    compact(count);
+    return;
+}
+
+template <typename T>
+bool LinkedList<T>::compact(size_type steps)
+{
+    LIST_STATS_CALL(compact);
+
+    // Moved nodes get new addresses
+    forget_positions();
+
+    compaction& state = side().compacted;
+    if (!state.running)
+    {
+        state.running = true;
+        state.cursor = nullptr;
+        state.pass_begin = state.blocks.size();
+    }
+
+    node_pointer previous = state.cursor;
+    node_pointer current = (previous != nullptr) ? previous->next() : head;
+    LIST_STATS_COUNTER(moved);
+
+    for (; current != nullptr && steps > 0; --steps)
+    {
+        LIST_PREFETCH(current->next());
+
+        // A pass fills its blocks in order and opens one twice as large when
+        // the last is full, so a long list ends up in a few large blocks
+        const bool first_block = state.blocks.size() == state.pass_begin;
+        if (first_block || state.blocks.back().used == state.blocks.back().capacity)
+        {
+            size_type capacity = first_block ? 16 : 2 * state.blocks.back().capacity;
+            node_block block(new slot[capacity], capacity);
+            state.blocks.push_back(block);
+        }
+
+        node_block& block = state.blocks.back();
+        void* address = static_cast<void*>(block.slots + block.used++);
+        node_pointer moved = ::new (address) Node<T>(std::move(*current->data()));
+        block.live.store(block.live.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+        moved->next(current->next());
+        if (previous != nullptr) { previous->next(moved); }
+        else { head = moved; }
+
+        if (current == tail) { tail = moved; }
+
+        release(current);
+        previous = moved;
+        current = moved->next();
+        LIST_STATS_STEP(moved);
+    }
+    LIST_STATS_NODES(compact, moved);
+
+    state.cursor = previous;
+    if (current != nullptr) { return false; }
+
+    // Every node now sits in a block of this pass or was allocated on its
+    // own since. The older blocks went with their last node, except one a
+    // throwing constructor left empty.
+    free_blocks(state.pass_begin);
+    state.running = false;
+    state.cursor = nullptr;
+
+    // Only an empty list has no block left, and nothing to index
+    if (state.blocks.empty())
+    {
+        delete extras;
+        extras = nullptr;
+    }
+    return true;
+}
+
+/*******************************************************************************
+Operations
+*******************************************************************************/ 
+
+template <typename T>
+void LinkedList<T>::reverse() noexcept
+{
+    LIST_STATS_CALL(reverse);
+
+    interrupt_compaction();
+    forget_positions();
+    if (empty()) { return; }
+
+    tail = head;
+    head = reverse_links(head, nullptr);
+
+    return;
+}
+
+template <typename T>
+void LinkedList<T>::reverse(const_iterator first, const_iterator last) noexcept
+{
+    LIST_STATS_CALL(reverse);
+
+    if (first == last) { return; }
+
+    interrupt_compaction();
+    forget_positions();
+
+    node_pointer begin = first.node;
+    if (begin == head)
+    {
+        head = reverse_links(begin, last.node);
+    }
+    else
+    {
+        node_pointer previous = head;
+        while (previous->next() != begin)
+        {
+            previous = previous->next();
+        }
+        previous->next(reverse_links(begin, last.node));
+    }
+
+    if (last.node == nullptr)
+    {
+        tail = begin;
+    }
+    return;
+}
+
+template <typename T>
+typename LinkedList<T>::iterator LinkedList<T>::rotate(const_iterator middle) noexcept
+{
+    LIST_STATS_CALL(rotate);
+
+    if (middle.node == head) { return end(); }
+    if (middle.node == nullptr) { return begin(); }
+
+    interrupt_compaction();
+    forget_positions();
+
+    node_pointer previous = head;
+    LIST_STATS_COUNTER(walked);
+    while (previous->next() != middle.node)
+    {
+        previous = previous->next();
+        LIST_STATS_STEP(walked);
+    }
+    LIST_STATS_NODES(rotate, walked);
+
+    // The front run moves behind the old tail, the node before middle ends
+    // the list now
+    node_pointer first = head;
+    tail->next(first);
+    head = middle.node;
+    tail = previous;
+    tail->next(nullptr);
+
+    return iterator(first);
+}
+
+template <typename T>
+void LinkedList<T>::remove(const_reference target)
+{
+    remove_if([&target] (const_reference value) { return value == target; });
+    return;
+}
+
+template <typename T>
+template <class Predicate>
+void LinkedList<T>::remove_if(Predicate pred)
+{
+    LIST_STATS_CALL(remove);
+    forget_positions();
+
+    // Relinks the survivors in one pass instead of erasing one at a time
+    filter(head, nullptr, [&pred](node_pointer node) { return pred(*node->data()); },
+           head, tail);
+
+    if (tail != nullptr)
+    {
+        tail->next(nullptr);
+    }
+    return;
+}
+
+template <typename T>
+typename LinkedList<T>::iterator LinkedList<T>::find(const_reference target)
+{
+    return find_if([&target](const_reference value){return value == target;});
+}
+
+template <typename T>
+template <class Predicate>
+typename LinkedList<T>::iterator LinkedList<T>::find_if(Predicate pred)
+{
+    LIST_STATS_CALL(find);
+    LIST_STATS_COUNTER(walked);
+
+    iterator it = begin();
+    while(it != end())
+    {
+        LIST_STATS_STEP(walked);
+        LIST_PREFETCH(it.node->next());
+        if(pred(*it))
+        {
+            break;
+        }
+        ++it;
+    }
+    LIST_STATS_NODES(find, walked);
+    return it;
+}
+
+template <typename T>
+void LinkedList<T>::unique()
+{
+    unique(std::hash<T>(), std::equal_to<T>());
+    return;
+}
+
+template <typename T>
+template <class Hash, class Equal>
+void LinkedList<T>::unique(Hash hash, Equal equal)
+{
+    LIST_STATS_CALL(unique);
+
+    if (head == tail) { return; }
+
+    // Kept nodes go into an open addressing table with their hashes, values
+    // are never copied and a lookup only compares values of equal hash
+    struct entry
     {
-        push_back(*it);
-    }
+        size_t hash;
+        node_pointer node;
+    };
+
+    // Fibonacci hashing takes the top bits of the product, which spreads
+    // hashes that differ only in their high bits
+    struct table
+    {
+        std::vector<entry> entries;
+        size_type bits;
+        size_type kept;
+
+        size_type home(size_t code) const
+        {
+            const size_t product = code * static_cast<size_t>(0x9E3779B97F4A7C15ull);
+            return product >> (std::numeric_limits<size_t>::digits - bits);
+        }
+
+        // Doubles the table, the stored hashes are placed again without
+        // touching the values
+        void grow()
+        {
+            std::vector<entry> old(size_type(1) << ++bits, entry { 0, nullptr });
+            old.swap(entries);
+
+            const size_type mask = entries.size() - 1;
+            for (const entry& item : old)
+            {
+                if (item.node == nullptr) { continue; }
+
+                size_type index = home(item.hash);
+                while (entries[index].node != nullptr) { index = (index + 1) & mask; }
+                entries[index] = item;
+            }
+        }
+    };
+
+    // Grows as values are kept instead of being sized for the whole list, a
+    // list of few distinct values keeps a small table that stays in cache
+    table seen = { std::vector<entry>(16, entry { 0, nullptr }), 4, 0 };
+
+    forget_positions();
+
+    filter(head, nullptr, [&seen, &hash, &equal](node_pointer node)
+    {
+        const size_t code = hash(*node->data());
+        const size_type mask = seen.entries.size() - 1;
+
+        size_type index = seen.home(code);
+        for (; seen.entries[index].node != nullptr; index = (index + 1) & mask)
+        {
+            const entry& item = seen.entries[index];
+            if (item.hash == code && equal(*item.node->data(), *node->data())) { return true; }
+        }
+
+        entry kept = { code, node };
+        seen.entries[index] = kept;
+
+        // At most half full, so probe sequences stay short
+        if (2 * ++seen.kept > seen.entries.size()) { seen.grow(); }
+        return false;
+    }, head, tail);
+
+    tail->next(nullptr);
+    return;
 }
 
-// Initializer List
 template <typename T>
-LinkedList<T>::LinkedList(std::initializer_list<value_type> init) : LinkedList()
+void LinkedList<T>::unique_adjacent()
+{
+    unique_adjacent([](const_reference kept, const_reference value) { return kept == value; });
+    return;
+}
+
+template <typename T>
+template <class BinaryPredicate>
+void LinkedList<T>::unique_adjacent(BinaryPredicate pred)
 {
-    typename std::initializer_list<T>::iterator it;
-    for(it = init.begin(); it != init.end(); ++it)
+    LIST_STATS_CALL(unique);
+    forget_positions();
+
+    node_pointer kept = nullptr;
+    filter(head, nullptr, [&kept, &pred](node_pointer node)
     {
-        push_back(*it);
+        if (kept != nullptr && pred(*kept->data(), *node->data())) { return true; }
+
+        kept = node;
+        return false;
+    }, head, tail);
+
+    if (tail != nullptr)
+    {
+        tail->next(nullptr);
     }
+    return;
 }
 
-// Destructor
 template <typename T>
-LinkedList<T>::~LinkedList() 
+void LinkedList<T>::unique_sorted()
 {
-    clear();
+    // In an ascending list kept < value unless the two are equal
+    unique_adjacent([](const_reference kept, const_reference value) { return !(kept < value); });
+    return;
+}
+
+template <typename T>
+template <class Comparator>
+void LinkedList<T>::sort(Comparator compare)
+{
+    LIST_STATS_CALL(sort);
+
+    interrupt_compaction();
+    forget_positions();
+
+    node_chain::sort_counts counts = { 0, 0 };
+    node_chain::sort(head, compare, tail, counts);
+    LIST_STATS_NODES(sort, counts.merged);
+    LIST_STATS_LENGTH(counts.length);
+    return;
+}
+
+template <typename T>
+void LinkedList<T>::sort()
+{
+    sort([](const_reference val1, const_reference val2){return val1 < val2;});
 }
 
 /*******************************************************************************
-ITERATORS
+PARALLEL OPERATIONS
 *******************************************************************************/
 
 template <typename T>
-typename LinkedList<T>::const_iterator LinkedList<T>::cbegin() const noexcept
+template <class Function>
+void LinkedList<T>::for_each(const execution::parallel_policy& policy, Function f)
 {
-    return const_iterator(head);
+    std::vector<node_pointer> starts = segments(policy);
+
+    policy.executor().parallel_for(starts.size(), [&starts, &f](size_type i)
+    {
+        node_pointer last = (i + 1 < starts.size()) ? starts[i + 1] : nullptr;
+        for (node_pointer current = starts[i]; current != last; current = current->next())
+        {
+            f(*current->data());
+        }
+    });
+    return;
 }
 
 template <typename T>
-typename LinkedList<T>::const_iterator LinkedList<T>::begin() const
+template <class UnaryOperation>
+void LinkedList<T>::transform(const execution::parallel_policy& policy, UnaryOperation op)
 {
-    return const_iterator(head);
-} 
+    for_each(policy, [&op](reference value) { value = op(value); });
+    return;
+}
 
 template <typename T>
-typename LinkedList<T>::iterator LinkedList<T>::begin()
+template <typename U, class BinaryOperation>
+U LinkedList<T>::reduce(const execution::parallel_policy& policy, U init, BinaryOperation op) const
 {
-    return iterator(head);
-} 
+    return transform_reduce(policy, init, op, [](const_reference value) -> const_reference
+    {
+        return value;
+    });
+}
 
 template <typename T>
-typename LinkedList<T>::const_iterator LinkedList<T>::cend() const noexcept
+template <typename U, class BinaryOperation, class UnaryOperation>
+U LinkedList<T>::transform_reduce(const execution::parallel_policy& policy, U init,
+                                  BinaryOperation combine, UnaryOperation convert) const
 {
-    return const_iterator(nullptr);
+    std::vector<node_pointer> starts = segments(policy);
+
+    // Every segment folds into its own slot, the slots are combined in order.
+    // U is wrapped so a vector of bool is not packed into shared words.
+    struct partial_result { U value; };
+    std::vector<partial_result> partials(starts.size(), partial_result { init });
+
+    policy.executor().parallel_for(starts.size(), 
+    [&starts, &partials, &combine, &convert](size_type i)
+    {
+        node_pointer last = (i + 1 < starts.size()) ? starts[i + 1] : nullptr;
+        node_pointer current = starts[i];
+
+        U partial = convert(*current->data());
+        for (current = current->next(); current != last; current = current->next())
+        {
+            partial = combine(partial, convert(*current->data()));
+        }
+        partials[i].value = partial;
+    });
+
+    for (const partial_result& partial : partials)
+    {
+        init = combine(init, partial.value);
+    }
+    return init;
 }
 
 template <typename T>
-typename LinkedList<T>::const_iterator LinkedList<T>::end() const
+template <class Predicate>
+typename LinkedList<T>::size_type
+LinkedList<T>::count_if(const execution::parallel_policy& policy, Predicate pred) const
 {
-    return const_iterator(nullptr);
-} 
+    return transform_reduce(policy, size_type(0), 
+        [](size_type left, size_type right) { return left + right; },
+        [&pred](const_reference value) -> size_type { return pred(value) ? 1 : 0; });
+}
 
 template <typename T>
-typename LinkedList<T>::iterator LinkedList<T>::end()
+template <class Predicate>
+bool LinkedList<T>::any_of(const execution::parallel_policy& policy, Predicate pred) const
 {
-    return iterator(nullptr);
-} 
+    std::vector<node_pointer> starts = segments(policy);
 
-/*******************************************************************************
-MODIFIERS
-*******************************************************************************/
+    // Segments stop scanning as soon as any of them has found a match
+    std::atomic<bool> found(false);
+
+    policy.executor().parallel_for(starts.size(), [&starts, &found, &pred](size_type i)
+    {
+        node_pointer last = (i + 1 < starts.size()) ? starts[i + 1] : nullptr;
+        for (node_pointer current = starts[i]; current != last; current = current->next())
+        {
+            if (found.load(std::memory_order_relaxed)) { return; }
+
+            if (pred(*current->data()))
+            {
+                found.store(true, std::memory_order_relaxed);
+                return;
+            }
+        }
+    });
+    return found.load();
+}
 
 template <typename T>
-void LinkedList<T>::push_front(const_reference data)
+template <class Predicate>
+bool LinkedList<T>::all_of(const execution::parallel_policy& policy, Predicate pred) const
 {
-    node_pointer temp = new Node<T>(data);
+    return !any_of(policy, [&pred](const_reference value) { return !pred(value); });
+}
 
-    temp->next(head);
-    head = temp;
+template <typename T>
+typename LinkedList<T>::iterator
+LinkedList<T>::find(const execution::parallel_policy& policy, const_reference target)
+{
+    return find_if(policy, [&target](const_reference value){return value == target;});
+}
 
-    if (tail == nullptr)
+template <typename T>
+template <class Predicate>
+typename LinkedList<T>::iterator
+LinkedList<T>::find_if(const execution::parallel_policy& policy, Predicate pred)
+{
+    std::vector<node_pointer> starts = segments(policy);
+    std::vector<node_pointer> matches(starts.size(), nullptr);
+
+    // Index of the earliest segment known to hold a match, segments after it
+    // can stop scanning since their matches can no longer be the first
+    std::atomic<size_type> first(starts.size());
+
+    policy.executor().parallel_for(starts.size(), 
+    [&starts, &matches, &first, &pred](size_type i)
     {
-        tail = head;
-    }
+        node_pointer last = (i + 1 < starts.size()) ? starts[i + 1] : nullptr;
+        for (node_pointer current = starts[i]; current != last; current = current->next())
+        {
+            if (first.load(std::memory_order_relaxed) < i) { return; }
+
+            if (pred(*current->data()))
+            {
+                matches[i] = current;
+
+                size_type known = first.load();
+                while (i < known && !first.compare_exchange_weak(known, i));
+                return;
+            }
+        }
+    });
+
+    size_type index = first.load();
+    return (index < matches.size()) ? iterator(matches[index]) : end();
+}
 
+template <typename T>
+void LinkedList<T>::remove(const execution::parallel_policy& policy, const_reference target)
+{
+    remove_if(policy, [&target] (const_reference value) { return value == target; });
     return;
 }
 
 template <typename T>
-void LinkedList<T>::push_back(const_reference data)
+template <class Predicate>
+void LinkedList<T>::remove_if(const execution::parallel_policy& policy, Predicate pred)
 {
-    if (empty())
+    // Workers only count down the blocks' live nodes while they free nodes,
+    // the blocks they empty are freed once they are done
+    interrupt_compaction();
+    forget_positions();
+
+    std::vector<node_pointer> starts = segments(policy);
+    std::vector<node_pointer> firsts(starts.size(), nullptr);
+    std::vector<node_pointer> lasts(starts.size(), nullptr);
+    std::vector<char> started(starts.size(), 0);
+
+    // Segments are filtered independently, then joined in one cheap pass
+    try
     {
-        push_front(data);
-        return;
+        policy.executor().parallel_for(starts.size(),
+        [this, &starts, &firsts, &lasts, &started, &pred](size_type i)
+        {
+            node_pointer last = (i + 1 < starts.size()) ? starts[i + 1] : nullptr;
+            started[i] = 1;
+            filter(starts[i], last, [&pred](node_pointer node) { return pred(*node->data()); },
+                   firsts[i], lasts[i], true);
+        });
     }
+    catch (...)
+    {
+        // A segment that threw kept the rest of its nodes, one that never
+        // started keeps all of them. Joined, the list is whole again.
+        for (size_type i = 0; i < starts.size(); ++i)
+        {
+            if (started[i]) { continue; }
 
-    node_pointer temp = new Node<T>(data);
-
-    tail->next(temp);
-    tail = temp;
+            node_pointer last = (i + 1 < starts.size()) ? starts[i + 1] : nullptr;
+            firsts[i] = starts[i];
+            for (lasts[i] = starts[i]; lasts[i]->next() != last; lasts[i] = lasts[i]->next()) {}
+        }
+        stitch(firsts, lasts);
+        reclaim_blocks();
+        throw;
+    }
 
+    stitch(firsts, lasts);
+    reclaim_blocks();
     return;
 }
 
-template<typename T>
-void LinkedList<T>::pop_front()
+template <typename T>
+void LinkedList<T>::unique(const execution::parallel_policy& policy)
 {
-    if (empty()) { return; }
+    // Values are compared through their nodes, nothing is copied
+    struct value_hash
+    {
+        size_t operator()(node_pointer node) const { return std::hash<T>()(*node->data()); }
+    };
+    struct value_equal
+    {
+        bool operator()(node_pointer lhs, node_pointer rhs) const 
+        {
+            return *lhs->data() == *rhs->data();
+        }
+    };
+    struct entry
+    {
+        node_pointer node;
+        size_type index;
+    };
 
-    node_pointer next = head->next();
+    // Workers only count down the blocks' live nodes while they free nodes,
+    // the blocks they empty are freed once they are done
+    interrupt_compaction();
+    forget_positions();
 
-    delete head;
-    head = next;
+    std::vector<node_pointer> starts = segments(policy);
+    const size_type count = starts.size();
 
-    return;
-}
+    // Every value belongs to exactly one hash partition, so partitions can
+    // find duplicates independently. buckets[s][p] holds the nodes of segment
+    // s that fall in partition p, in list order.
+    std::vector<std::vector<std::vector<entry> > > buckets(count);
+    std::vector<std::vector<char> > duplicate(count);
 
-template<typename T>
-T& LinkedList<T>::pop_front(reference out_data)
-{
-    if (empty()) { return out_data; }
+    Executor& executor = policy.executor();
 
-    node_pointer next = head->next();
-    out_data = *head->data();
+    executor.parallel_for(count, [&starts, &buckets, &duplicate, count](size_type s)
+    {
+        node_pointer last = (s + 1 < starts.size()) ? starts[s + 1] : nullptr;
 
-    delete head;
-    head = next;
+        buckets[s].resize(count);
+        size_type index = 0;
+        for (node_pointer current = starts[s]; current != last; current = current->next())
+        {
+            entry item = { current, index++ };
+            buckets[s][value_hash()(current) % count].push_back(item);
+        }
+        duplicate[s].assign(index, 0);
+    });
 
-    return out_data;
+    executor.parallel_for(count, [&buckets, &duplicate, count](size_type p)
+    {
+        std::unordered_set<node_pointer, value_hash, value_equal> seen;
+
+        // Walking the segments in order keeps the first occurrence in the list
+        for (size_type s = 0; s < count; ++s)
+        {
+            for (const entry& item : buckets[s][p])
+            {
+                if (!seen.insert(item.node).second)
+                {
+                    duplicate[s][item.index] = 1;
+                }
+            }
+        }
+    });
+
+    std::vector<node_pointer> firsts(count, nullptr);
+    std::vector<node_pointer> lasts(count, nullptr);
+
+    executor.parallel_for(count, [this, &starts, &duplicate, &firsts, &lasts](size_type s)
+    {
+        node_pointer last = (s + 1 < starts.size()) ? starts[s + 1] : nullptr;
+        const std::vector<char>& flags = duplicate[s];
+
+        size_type index = 0;
+        filter(starts[s], last, [&flags, &index](node_pointer) { return flags[index++] != 0; },
+               firsts[s], lasts[s], true);
+    });
+
+    stitch(firsts, lasts);
+    reclaim_blocks();
+    return;
 }
 
-template<typename T>
-void LinkedList<T>::pop_back()
+template <typename T>
+template <class Comparator>
+void LinkedList<T>::sort(const execution::parallel_policy& policy, Comparator compare)
 {
-    if (empty()) { return; }
+    interrupt_compaction();
+    forget_positions();
 
-    node_pointer previous = head; 
+    std::vector<node_pointer> firsts = segments(policy);
+    std::vector<node_pointer> lasts(firsts.size(), nullptr);
 
-    while (previous->next() != tail)
+    Executor& executor = policy.executor();
+
+    // Every segment is cut from its successor and sorted on its own
+    const std::vector<node_pointer> starts(firsts);
+    executor.parallel_for(starts.size(), [&starts, &firsts, &lasts, &compare](size_type i)
     {
-        previous = previous->next();
-    }
-    delete tail;
+        node_pointer end = (i + 1 < starts.size()) ? starts[i + 1] : nullptr;
+        node_pointer last = starts[i];
+        while (last->next() != end)
+        {
+            last = last->next();
+        }
+        last->next(nullptr);
 
-    previous->next(nullptr);
-    tail = previous;
+        node_chain::sort_counts counts = { 0, 0 };
+        node_chain::sort(firsts[i], compare, lasts[i], counts);
+        LIST_STATS_NODES(sort, counts.merged);
+    });
 
-    return; 
+    // Sorted runs are merged pairwise, each round halves the number of runs
+    while (firsts.size() > 1)
+    {
+        const size_type pairs = firsts.size() / 2;
+        std::vector<node_pointer> merged_firsts(firsts.size() - pairs, nullptr);
+        std::vector<node_pointer> merged_lasts(firsts.size() - pairs, nullptr);
+
+        executor.parallel_for(pairs, 
+        [&firsts, &merged_firsts, &merged_lasts, &compare](size_type j)
+        {
+            size_t merged = 0;
+            merged_firsts[j] = node_chain::merge(firsts[2 * j], firsts[2 * j + 1], compare,
+                                                 merged_lasts[j], merged);
+            LIST_STATS_NODES(sort, merged);
+        });
+
+        if (firsts.size() % 2 != 0)
+        {
+            merged_firsts.back() = firsts.back();
+            merged_lasts.back() = lasts.back();
+        }
+        firsts.swap(merged_firsts);
+        lasts.swap(merged_lasts);
+    }
 
+    head = firsts.empty() ? nullptr : firsts.front();
+    tail = lasts.empty() ? nullptr : lasts.front();
+    return;
 }
 
-template<typename T>
-T& LinkedList<T>::pop_back(reference out_data)
+template <typename T>
+void LinkedList<T>::sort(const execution::parallel_policy& policy)
 {
-    if (empty()) { return out_data; }
+    sort(policy, [](const_reference val1, const_reference val2){return val1 < val2;});
+}
 
-    node_pointer previous = head; 
+/*******************************************************************************
+OPERATOR OVERLOADS
+*******************************************************************************/
 
-    while (previous->next() != tail)
+template <typename T>
+bool LinkedList<T>::operator==(const LinkedList<value_type>& rhs) const
+{
+    LIST_STATS_CALL(equal);
+    LIST_STATS_COUNTER(walked);
+
+    // Both lists are walked side by side in a single pass, which also finds
+    // a difference in length, so the misses of the two walks overlap. Where
+    // both lists have a run of nodes laid out in order, the run is compared
+    // like an array, without loading the links one after another.
+    const Node<T>* left = head;
+    const Node<T>* right = rhs.head;
+
+    while (left != nullptr && right != nullptr)
     {
-        previous = previous->next();
+        size_type run = rhs.run_length(right, run_length(left, run_chunk));
+        LIST_PREFETCH(left[run - 1].next());
+        LIST_PREFETCH(right[run - 1].next());
+
+        for (size_type i = 0; i < run; ++i)
+        {
+            LIST_STATS_STEP(walked);
+            if (*left[i].data() != *right[i].data())
+            {
+                LIST_STATS_NODES(equal, walked);
+                return false;
+            }
+        }
+        left = left[run - 1].next();
+        right = right[run - 1].next();
     }
-    out_data = *tail->data();
-    delete tail;
+    LIST_STATS_NODES(equal, walked);
 
-    previous->next(nullptr);
-    tail = previous;
+    return left == nullptr && right == nullptr;
+}
 
-    return out_data; 
+template <typename T>
+bool LinkedList<T>::operator!=(const LinkedList<value_type>& rhs) const
+{
+    return !(*this == rhs);
 }
 
-template<typename T>
-void LinkedList<T>::insert(const_iterator& position, const_reference data)
+template <typename T>
+LinkedList<T>& LinkedList<T>::operator=(LinkedList<value_type> list)
 {
-    if(empty())
-    {
-        push_front(data);
-        position = iterator(head); 
-        return;
-    }
+    LIST_STATS_CALL(assign);
 
-    node_pointer newNode = new Node<T>(data);
-    newNode->next(position.node->next());
+    swap(*this, list);
 
-    position.node->next(newNode);
+    return *this;
+}
 
-    if(tail->next() == newNode)
-    {
-        tail = newNode;
-    }
- 
+/*******************************************************************************
+*******************************************************************************/
+
+template <typename T>
+void LinkedList<T>::swap(LinkedList<T>& newList, LinkedList<T>& oldList) noexcept
+{
+    // Enables ADL
+    using std::swap;
+    
+    // Swap pointers, reassigns ownership
+    swap(newList.head, oldList.head);
+    swap(newList.tail, oldList.tail);
+    swap(newList.extras, oldList.extras);
     return;
 }
 
 template <typename T>
-void LinkedList<T>::insert(const_iterator position, size_type n, const_reference data)
+typename LinkedList<T>::side_state& LinkedList<T>::side()
 {
-    LinkedList<value_type> temp(n, data);
-    insert(position, temp.begin(), temp.end());
-    return;
+    if (extras == nullptr)
+    {
+        extras = new side_state { compaction { std::vector<node_block>(), 0, nullptr, false },
+                                  position_index { 0, nullptr, std::vector<skip>() } };
+    }
+    return *extras;
 }
 
 template <typename T>
-template <typename InputIterator>
-void LinkedList<T>::insert(const_iterator position, InputIterator begin, InputIterator end)
+typename LinkedList<T>::node_pointer
+LinkedList<T>::reverse_links(node_pointer first, node_pointer last) noexcept
 {
-    if (empty())
+    node_pointer previous = last;
+    LIST_STATS_COUNTER(walked);
+
+    // Iterative, reversing a long list takes no stack
+    while (first != last)
     {
-        push_front(*begin++);
-        position = iterator(head);
+        node_pointer next = first->next();
+        first->next(previous);
+        previous = first;
+        first = next;
+        LIST_STATS_STEP(walked);
     }
+    LIST_STATS_NODES(reverse, walked);
 
-    for(;begin != end; ++begin)
+    return previous;
+}
+
+template <typename T>
+std::vector<typename LinkedList<T>::node_pointer>
+LinkedList<T>::segments(const execution::parallel_policy& policy) const
+{
+    // Every parallel algorithm splits the list here first
+    LIST_STATS_CALL(parallel);
+    LIST_STATS_COUNTER(walked);
+
+    // A few segments per thread lets work stealing even out uneven segments
+    const size_type target = (policy.executor().size() + 1) * 4;
+
+    std::vector<node_pointer> starts;
+    starts.reserve(2 * target);
+
+    // Record a start every stride nodes. The length is unknown until the walk
+    // ends, so whenever twice the target is reached every other start is
+    // dropped and the stride doubles, the list is walked only once.
+    size_type stride = policy.grain();
+    size_type gap = 0;
+    for (node_pointer current = head; current != nullptr; current = current->next())
     {
-        insert(position, *begin);
-        ++position;
+        if (gap == 0)
+        {
+            starts.push_back(current);
+            gap = stride;
+
+            if (starts.size() == 2 * target)
+            {
+                for (size_type i = 0; i < target; ++i)
+                {
+                    starts[i] = starts[2 * i];
+                }
+                starts.resize(target);
+                stride *= 2;
+            }
+        }
+        --gap;
+        LIST_STATS_STEP(walked);
     }
-    return;
+    LIST_STATS_NODES(parallel, walked);
+    LIST_STATS_LENGTH(walked);
+    return starts;
 }
 
-template<typename T>
-typename LinkedList<T>::iterator 
-LinkedList<T>::erase(iterator& position)
+template <typename T>
+template <class Predicate>
+void LinkedList<T>::filter(node_pointer first, node_pointer last, Predicate discard,
+                           node_pointer& kept_first, node_pointer& kept_last, bool concurrently)
 {
-    if (empty()) { return position; }
-
-    node_pointer previous = head;
+    kept_first = nullptr;
+    kept_last = nullptr;
 
-    if (previous != position.node)
+    // Discarded nodes are chained together and freed as one batch at the end
+    node_pointer discarded = nullptr;
+    auto free_discarded = [this, &discarded, concurrently]()
     {
-        while (previous->next() != position.node)
+        while (discarded != nullptr)
         {
-            previous = previous->next();
+            node_pointer next = discarded->next();
+            release(discarded, concurrently);
+            LIST_STATS_FREES(1);
+            discarded = next;
         }
-    }
+    };
 
-    previous->next(position.node->next());
-
-    node_pointer temp = position.node;
+    // Counted as remove, also when the parallel unique filters a segment
+    LIST_STATS_COUNTER(walked);
 
-    if (temp == head)
+    node_pointer current = first;
+    try
     {
-        head = head->next();
+        while (current != last)
+        {
+            node_pointer next = current->next();
+            LIST_PREFETCH(next);
+            LIST_STATS_STEP(walked);
+
+            if (discard(current))
+            {
+                current->next(discarded);
+                discarded = current;
+            }
+            else
+            {
+                if (kept_last != nullptr)
+                {
+                    kept_last->next(current);
+                }
+                else
+                {
+                    kept_first = current;
+                }
+                kept_last = current;
+            }
+            current = next;
+        }
     }
-
-    position = iterator(previous->next());
-
-    delete temp;
-
-    return position;
-}
-
-template<typename T>
-typename LinkedList<T>::iterator 
-LinkedList<T>::erase(iterator& first, iterator& last)
-{
-    while (first != last)
+    catch (...)
     {
-        first = erase(first);
+        // The node discard threw on and the ones after it are kept as they
+        // are, so the range is whole again before the exception leaves
+        if (kept_last != nullptr)
+        {
+            kept_last->next(current);
+        }
+        else
+        {
+            kept_first = current;
+        }
+        for (kept_last = current; kept_last->next() != last; kept_last = kept_last->next()) {}
+
+        free_discarded();
+        throw;
     }
+    LIST_STATS_NODES(remove, walked);
 
-    return first;
+    free_discarded();
+    return;
 }
 
-
 template <typename T>
-void LinkedList<T>::clear()
+void LinkedList<T>::stitch(const std::vector<node_pointer>& firsts, 
+                           const std::vector<node_pointer>& lasts)
 {
-    if (empty())
+    head = nullptr;
+    tail = nullptr;
+
+    for (size_type i = 0; i < firsts.size(); ++i)
     {
-        return;
-    }
+        if (firsts[i] == nullptr) { continue; }
 
-    node_pointer previous = head;
+        if (tail != nullptr)
+        {
+            tail->next(firsts[i]);
+        }
+        else
+        {
+            head = firsts[i];
+        }
+        tail = lasts[i];
+    }
 
-    while (head != nullptr)
+    if (tail != nullptr)
     {
-        previous = head;
-        head = head->next();
-        delete previous;
+        tail->next(nullptr);
     }
-
     return;
 }
 
-/*******************************************************************************
-CAPACITY
-*******************************************************************************/ 
-
-template <typename T>
-bool LinkedList<T>::empty() const
-{
-    return !(head);
-}
-
 template <typename T>
-size_t LinkedList<T>::size() const
+void LinkedList<T>::release(node_pointer node, bool concurrently) noexcept
 {
-    size_type SIZE = 0;
-
-    for(const_iterator it = cbegin(); it != cend(); ++it)
+    // The search is written out here rather than through block_of(), every
+    // node a list frees goes through it
+    if (extras != nullptr)
     {
-        ++SIZE;
+        compaction& state = extras->compacted;
+        const slot* address = reinterpret_cast<const slot*>(node);
+        node_block* const first = state.blocks.data();
+        node_block* const last = first + state.blocks.size();
+
+        for (node_block* block = first; block != last; ++block)
+        {
+            if (!(std::less_equal<const slot*>()(block->slots, address)
+                  && std::less<const slot*>()(address, block->slots + block->capacity)))
+            {
+                continue;
+            }
+
+            if (state.running && node == state.cursor)
+            {
+                interrupt_compaction();
+            }
+            node->~Node<T>();
+
+            // Joining the threads orders their decrements before reclaim_blocks()
+            if (concurrently)
+            {
+                block->live.fetch_sub(1, std::memory_order_relaxed);
+                return;
+            }
+
+            // Alone with the count, a plain load and store spare the locked
+            // decrement
+            const size_type left = block->live.load(std::memory_order_relaxed) - 1;
+            block->live.store(left, std::memory_order_relaxed);
+            if (left == 0)
+            {
+                free_block(static_cast<size_type>(block - first));
+            }
+            return;
+        }
     }
 
-    return SIZE;
+    delete node;
+    return;
 }
 
-/*******************************************************************************
-Operations
-*******************************************************************************/ 
-
 template <typename T>
-void LinkedList<T>::reverse() noexcept
+typename LinkedList<T>::size_type LinkedList<T>::block_of(const Node<T>* node) const noexcept
 {
-    if (empty()) { return; }
-
-    reverse_links(head, nullptr);
+    if (extras == nullptr) { return 0; }
 
-    std::swap(head, tail);
+    const std::vector<node_block>& blocks = extras->compacted.blocks;
+    const slot* address = reinterpret_cast<const slot*>(node);
 
-    return;
+    size_type i = 0;
+    while (i < blocks.size() && !(std::less_equal<const slot*>()(blocks[i].slots, address)
+                                  && std::less<const slot*>()(address, blocks[i].slots + blocks[i].capacity)))
+    {
+        ++i;
+    }
+    return i;
 }
 
 template <typename T>
-void LinkedList<T>::remove(const_reference target)
+bool LinkedList<T>::in_block(const Node<T>* node) const noexcept
 {
-    remove_if([&target] (const_reference value) { return value == target; });
-    return;
+    return extras != nullptr && block_of(node) < extras->compacted.blocks.size();
 }
 
 template <typename T>
-template <class Predicate>
-void LinkedList<T>::remove_if(Predicate pred)
+void LinkedList<T>::interrupt_compaction() noexcept
 {
-    iterator it = begin();
-    while(it != end())
-    {
-        pred(*it) ? erase(it) : ++it;
-    }
+    if (extras == nullptr) { return; }
+
+    extras->compacted.running = false;
+    extras->compacted.cursor = nullptr;
     return;
 }
 
 template <typename T>
-typename LinkedList<T>::iterator LinkedList<T>::find(const_reference target)
+typename LinkedList<T>::node_block& LinkedList<T>::open_block(size_type n)
 {
-    return find_if([&target](const_reference value){return value == target;});
+    std::vector<node_block>& blocks = side().compacted.blocks;
+
+    // A paused compaction would treat the new block as one of its own
+    interrupt_compaction();
+
+    // The block is registered before any node is built in it, so clear()
+    // frees it if building a node throws
+    blocks.reserve(blocks.size() + 1);
+    node_block block(new slot[n], n);
+    blocks.push_back(block);
+
+    return blocks.back();
 }
 
 template <typename T>
-template <class Predicate>
-typename LinkedList<T>::iterator LinkedList<T>::find_if(Predicate pred)
+template <class Source>
+void LinkedList<T>::append(Source source, size_type n)
 {
-    iterator it = begin();
-    while(it != end())
+    if (n < batch_minimum || (extras != nullptr && extras->compacted.blocks.size() >= block_limit))
     {
-        if(pred(*it))
+        for (; n > 0; --n, ++source)
         {
-            return it;
+            push_back(*source);
         }
-        ++it;
+        return;
     }
-    return it;
-}
 
-template <typename T>
-void LinkedList<T>::unique()
-{
-    std::unordered_set<T> uniqueElements;
-    iterator it = begin();
-    while(it != end())
+    node_block& target = open_block(n);
+
+    // Every node built is live, the count is set once building stops, also
+    // when a value throws
+    struct count_built
     {
-        if (uniqueElements.find(*it) == uniqueElements.end())
-        {
-            uniqueElements.insert(*it);
-            ++it;
-        }
-        else
-        {
-            it = erase(it);
-        }
+        node_block& block;
+        ~count_built() { block.live.store(block.used, std::memory_order_relaxed); }
+    } counted = { target };
+
+    for (; target.used < n; ++source)
+    {
+        void* address = static_cast<void*>(target.slots + target.used);
+        node_pointer node = ::new (address) Node<T>(*source);
+        ++target.used;
+        LIST_STATS_ALLOCATIONS(1);
+
+        if (tail != nullptr) { tail->next(node); }
+        else { head = node; }
+        tail = node;
     }
     return;
 }
 
 template <typename T>
-template <class Comparator>
-void LinkedList<T>::sort(Comparator compare)
+void LinkedList<T>::copy_runs(const LinkedList<T>& origin, size_type n, std::true_type)
 {
-    merge_sort(head, compare);
+    static_assert(std::is_trivially_copyable<Node<T> >::value, "only a node's bytes are copied");
+    static_assert(sizeof(slot) == sizeof(Node<T>), "a block holds nodes back to back");
+
+    // Copying the bytes begins the lifetime of the nodes in the slots, runs of
+    // the origin's nodes are copied whole and relinked after
+    node_block& target = open_block(n);
+    node_pointer nodes = reinterpret_cast<node_pointer>(target.slots);
+
+    for (const Node<T>* current = origin.head; current != nullptr && target.used < n; )
+    {
+        LIST_PREFETCH(current->next());
+        size_type run = origin.run_length(current, n - target.used);
+        std::memcpy(nodes + target.used, current, run * sizeof(Node<T>));
+        target.used += run;
+        current = current[run - 1].next();
+    }
+    target.live.store(n, std::memory_order_relaxed);
+    LIST_STATS_ALLOCATIONS(n);
+
+    for (size_type i = 1; i < n; ++i)
+    {
+        nodes[i - 1].next(nodes + i);
+    }
+    nodes[n - 1].next(nullptr);
 
+    head = nodes;
+    tail = nodes + (n - 1);
     return;
 }
 
 template <typename T>
-void LinkedList<T>::sort()
+void LinkedList<T>::copy_runs(const LinkedList<T>& origin, size_type n, std::false_type)
 {
-    sort([](const_reference val1, const_reference val2){return val1 < val2;});
+    append(origin.cbegin(), n);
+    return;
 }
 
-/*******************************************************************************
-OPERATOR OVERLOADS
-*******************************************************************************/
-
 template <typename T>
-bool LinkedList<T>::operator==(const LinkedList<value_type>& rhs) const
+typename LinkedList<T>::size_type
+LinkedList<T>::run_length(const Node<T>* node, size_type limit) const noexcept
 {
-    if (size() != rhs.size()) { return false; }
-
-    LinkedList<T>::const_iterator left = cbegin();
-    LinkedList<T>::const_iterator right = rhs.cbegin();
-
-    while(left != cend() && right != rhs.cend())
+    // Only the slots of one block form an array the run may step through.
+    // The block is searched here rather than through block_of(), which then
+    // stays small enough to inline into the loop of clear().
+    const node_block* block = nullptr;
+    if (extras != nullptr)
     {
-        if (*left != *right) { return false; }
-        ++left;
-        ++right;
+        const slot* address = reinterpret_cast<const slot*>(node);
+        for (const node_block& candidate : extras->compacted.blocks)
+        {
+            if (std::less_equal<const slot*>()(candidate.slots, address)
+                && std::less<const slot*>()(address, candidate.slots + candidate.capacity))
+            {
+                block = &candidate;
+                limit = std::min(limit, block->capacity - static_cast<size_type>(address - block->slots));
+                break;
+            }
+        }
     }
+    if (block == nullptr) { return 1; }
 
-    return true;
+    size_type length = 1;
+    while (length < limit && node[length - 1].next() == node + length)
+    {
+        ++length;
+    }
+    return length;
 }
 
 template <typename T>
-bool LinkedList<T>::operator!=(const LinkedList<value_type>& rhs) const
+template <typename InputIterator>
+void LinkedList<T>::append_range(InputIterator first, InputIterator last, std::input_iterator_tag)
 {
-    return !(*this == rhs);
+    // The length is unknown until the input ends
+    for (; first != last; ++first)
+    {
+        push_back(*first);
+    }
+    return;
 }
 
 template <typename T>
-LinkedList<T>& LinkedList<T>::operator=(LinkedList<value_type> list)
+template <typename ForwardIterator>
+void LinkedList<T>::append_range(ForwardIterator first, ForwardIterator last, 
+                                 std::forward_iterator_tag)
 {
-    swap(*this, list);
-
-    return *this;
+    append(first, static_cast<size_type>(std::distance(first, last)));
+    return;
 }
 
-/*******************************************************************************
-*******************************************************************************/
-
 template <typename T>
-void LinkedList<T>::swap(LinkedList<T>& newList, LinkedList<T>& oldList) noexcept
+void LinkedList<T>::free_blocks(size_type n) noexcept
 {
-    // Enables ADL
-    using std::swap;
-    
-    // Swap pointers, reassigns ownership
-    swap(newList.head, oldList.head);
-    swap(newList.tail, oldList.tail);
+    compaction& state = extras->compacted;
+    for (size_type i = 0; i < n; ++i)
+    {
+        delete[] state.blocks[i].slots;
+    }
+
+    state.blocks.erase(state.blocks.begin(), state.blocks.begin() + n);
+    state.pass_begin -= (n < state.pass_begin) ? n : state.pass_begin;
     return;
 }
 
 template <typename T>
-void LinkedList<T>::reverse_links(node_pointer current, node_pointer previous) noexcept
+void LinkedList<T>::free_block(size_type i) noexcept
 {
-    if (current->next() != nullptr)
+    compaction& state = extras->compacted;
+
+    delete[] state.blocks[i].slots;
+    state.blocks.erase(state.blocks.begin() + i);
+    if (i < state.pass_begin)
     {
-        reverse_links(current->next(), current);
+        --state.pass_begin;
     }
 
-    current->next(previous);
-
+    // The vector holding no block gives its buffer back as well
+    if (state.blocks.empty())
+    {
+        std::vector<node_block>().swap(state.blocks);
+    }
     return;
 }
 
 template <typename T>
-template <class Comparator>
-void LinkedList<T>::merge_sort(node_pointer& begin, Comparator compare)
+void LinkedList<T>::reclaim_blocks() noexcept
 {
-    // Base case
-    if(begin == nullptr || begin->next() == nullptr)
+    if (extras == nullptr) { return; }
+
+    for (size_type i = extras->compacted.blocks.size(); i > 0; --i)
     {
-        return;
+        if (extras->compacted.blocks[i - 1].live.load(std::memory_order_relaxed) == 0)
+        {
+            free_block(i - 1);
+        }
     }
+    return;
+}
+
+template <typename T>
+typename LinkedList<T>::node_pointer LinkedList<T>::seek(size_type i, bool record) const
+{
+    node_pointer current = head;
+    size_type position = 0;
 
-    node_pointer left = begin;
-    node_pointer right = begin->next();
+    // Position of the last skip at or before i, new skips go after it
+    size_type anchor = 0;
+    size_type after = 0;
 
-    // Split the list in half, break the links from left -> right
-    split(left, right);
+    if (extras != nullptr)
+    {
+        const position_index& index = extras->indexed;
 
-    left = begin;
+        after = std::upper_bound(index.skips.begin(), index.skips.end(), i,
+                [](size_type value, const skip& entry) { return value < entry.position; })
+              - index.skips.begin();
+        if (after > 0)
+        {
+            current = index.skips[after - 1].node;
+            position = anchor = index.skips[after - 1].position;
+        }
 
-    // Recursively break the links and split the list in half
-    merge_sort(left, compare);
-    merge_sort(right, compare);
+        if (index.finger != nullptr && position < index.finger_position && index.finger_position <= i)
+        {
+            current = index.finger;
+            position = index.finger_position;
+        }
+    }
 
-    // Relink the list together in sorted order
-    begin = merge(left, right, compare);
+    LIST_STATS_COUNTER(walked);
+    while (current != nullptr && position < i)
+    {
+        current = current->next();
+        ++position;
+        LIST_STATS_STEP(walked);
 
-    return;
+        if (record && current != nullptr && position - anchor >= skip_stride)
+        {
+            skip entry = { position, current };
+            extras->indexed.skips.insert(extras->indexed.skips.begin() + after++, entry);
+            anchor = position;
+        }
+    }
+    LIST_STATS_NODES(at, walked);
+
+    if (record && current != nullptr)
+    {
+        extras->indexed.finger = current;
+        extras->indexed.finger_position = i;
+    }
+    return current;
 }
 
 template <typename T>
-void LinkedList<T>::split(node_pointer& left, node_pointer& right)
+void LinkedList<T>::shift_positions(size_type position, bool inserted) noexcept
 {
-    // right travels through the list two links at a time
-    while((right = right->next()) != nullptr)
+    if (extras == nullptr) { return; }
+
+    position_index& index = extras->indexed;
+    std::vector<skip>& skips = index.skips;
+    if (position == 0)
+    {
+        // Every skip would move, the next walks record them again
+        skips.clear();
+    }
+    else
     {
-        if (right->next() != nullptr)
+        typename std::vector<skip>::iterator it = std::lower_bound(skips.begin(), skips.end(), 
+                position, [](const skip& entry, size_type value) { return entry.position < value; });
+
+        if (!inserted && it != skips.end() && it->position == position)
+        {
+            it = skips.erase(it);
+        }
+        for (; it != skips.end(); ++it)
         {
-            // left travels through the list only one link at a time
-            left = left->next();
-            right = right->next();
+            if (inserted) { ++it->position; }
+            else { --it->position; }
         }
     }
-    // Left is at the midpoint of the list
-    right = left->next();
-    left->next(nullptr);
+
+    if (index.finger == nullptr || index.finger_position < position) { return; }
+
+    if (inserted)
+    {
+        ++index.finger_position;
+    }
+    else if (index.finger_position == position)
+    {
+        index.finger = nullptr;
+    }
+    else
+    {
+        --index.finger_position;
+    }
+    return;
 }
 
 template <typename T>
-template <class Comparator>
-Node<T>* LinkedList<T>::merge(node_pointer left, node_pointer right, Comparator compare)
+void LinkedList<T>::forget_tail() noexcept
 {
-    node_pointer begin = nullptr;
-
-    if(left == nullptr) { return right; }
-    else if (right == nullptr) { return left; }
+    if (extras == nullptr) { return; }
 
-    if(compare(*left->data(), *right->data()))
+    position_index& index = extras->indexed;
+    if (index.finger == tail)
     {
-        begin = left;
-        begin->next(merge(left->next(), right, compare));
+        index.finger = nullptr;
     }
-    else
+    if (!index.skips.empty() && index.skips.back().node == tail)
     {
-        begin = right;
-        begin->next(merge(left, right->next(), compare));
+        index.skips.pop_back();
     }
-    return begin;
+    return;
+}
+
+template <typename T>
+void LinkedList<T>::forget_positions() noexcept
+{
+    if (extras == nullptr) { return; }
+
+    position_index& index = extras->indexed;
+    index.finger = nullptr;
+    index.skips.clear();
+    return;
 }
 
 #endif // LINKED_LIST_TPP
@@ -0,0 +1,218 @@
+/*
+
+File: allocationCounter.hpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+/*
+Opt-in counting of heap allocations, used by the tests and benchmarks to pin
+down how many allocations each list operation makes.
+
+Counting works through replacements of the global operator new and delete.
+They are compiled into the program by exactly one translation unit, which
+defines ALLOCATION_COUNTER_HOOKS before including this header:
+
+    #define ALLOCATION_COUNTER_HOOKS
+    #include "allocationCounter.hpp"
+
+Counts are kept per thread, so work that other threads do meanwhile, a
+thread pool for example, does not disturb a measurement:
+
+    allocation::counts made = allocation::count([&]() { list.push_back(1); });
+
+Only bytes requested through new are recorded, the size of a freed block is
+unknown to operator delete before C++14. The nothrow forms, which
+std::get_temporary_buffer uses, and the over-aligned forms of C++17 are
+replaced too, so everything new hands out comes back to the matching delete.
+*/
+
+#ifndef ALLOCATION_COUNTER_H
+#define ALLOCATION_COUNTER_H
+
+#include <cstddef>
+
+namespace allocation
+{
+
+struct counts
+{
+    size_t allocations;
+    size_t frees;
+    size_t bytes;
+
+    counts operator-(const counts& start) const
+    {
+        counts difference = { allocations - start.allocations, frees - start.frees, bytes - start.bytes };
+        return difference;
+    }
+};
+
+// Totals of the calling thread since it started
+inline counts& thread_counts()
+{
+    static thread_local counts totals = { 0, 0, 0 };
+    return totals;
+}
+
+// True when the hooks are compiled into the program, counts stay zero otherwise
+inline bool& hooks_installed()
+{
+    static bool installed = false;
+    return installed;
+}
+
+// Counts what the calling thread allocates from construction on
+class Counter
+{
+public:
+
+    Counter() : start(thread_counts()) {}
+
+    counts delta() const { return thread_counts() - start; }
+
+private:
+
+    counts start;
+};
+
+template <typename Function>
+counts count(Function function)
+{
+    Counter counter;
+    function();
+    return counter.delta();
+}
+
+} // namespace allocation
+
+#endif // ALLOCATION_COUNTER_H
+
+// Outside the include guard so the defining translation unit may have included
+// the header before, through another header
+#if defined(ALLOCATION_COUNTER_HOOKS) && !defined(ALLOCATION_COUNTER_HOOKS_DEFINED)
+#define ALLOCATION_COUNTER_HOOKS_DEFINED
+
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+namespace allocation
+{
+    // Null when the memory is exhausted
+    inline void* try_allocate(size_t size) noexcept
+    {
+        void* memory = std::malloc(size == 0 ? 1 : size);
+        if (memory == nullptr) { return nullptr; }
+
+        counts& totals = thread_counts();
+        ++totals.allocations;
+        totals.bytes += size;
+        return memory;
+    }
+
+    inline void* counted_allocate(size_t size)
+    {
+        void* memory = try_allocate(size);
+        if (memory == nullptr) { throw std::bad_alloc(); }
+        return memory;
+    }
+
+    inline void counted_free(void* memory) noexcept
+    {
+        if (memory == nullptr) { return; }
+
+        ++thread_counts().frees;
+        std::free(memory);
+    }
+
+    // Over-allocates with malloc and keeps the block it returned just before
+    // the aligned address, where counted_free_aligned finds it
+    inline void* try_allocate_aligned(size_t size, size_t alignment) noexcept
+    {
+        void* block = std::malloc(size + alignment + sizeof(void*));
+        if (block == nullptr) { return nullptr; }
+
+        std::uintptr_t address = reinterpret_cast<std::uintptr_t>(block) + sizeof(void*);
+        address = (address + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+        reinterpret_cast<void**>(address)[-1] = block;
+
+        counts& totals = thread_counts();
+        ++totals.allocations;
+        totals.bytes += size;
+        return reinterpret_cast<void*>(address);
+    }
+
+    inline void* counted_allocate_aligned(size_t size, size_t alignment)
+    {
+        void* memory = try_allocate_aligned(size, alignment);
+        if (memory == nullptr) { throw std::bad_alloc(); }
+        return memory;
+    }
+
+    inline void counted_free_aligned(void* memory) noexcept
+    {
+        if (memory == nullptr) { return; }
+
+        ++thread_counts().frees;
+        std::free(static_cast<void**>(memory)[-1]);
+    }
+
+    static const bool installed = (hooks_installed() = true);
+}
+
+void* operator new(size_t size) { return allocation::counted_allocate(size); }
+void* operator new[](size_t size) { return allocation::counted_allocate(size); }
+void operator delete(void* memory) noexcept { allocation::counted_free(memory); }
+void operator delete[](void* memory) noexcept { allocation::counted_free(memory); }
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return allocation::try_allocate(size); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return allocation::try_allocate(size); }
+void operator delete(void* memory, const std::nothrow_t&) noexcept { allocation::counted_free(memory); }
+void operator delete[](void* memory, const std::nothrow_t&) noexcept { allocation::counted_free(memory); }
+
+#if defined(__cpp_sized_deallocation)
+void operator delete(void* memory, size_t) noexcept { allocation::counted_free(memory); }
+void operator delete[](void* memory, size_t) noexcept { allocation::counted_free(memory); }
+#endif
+
+#if defined(__cpp_aligned_new)
+void* operator new(size_t size, std::align_val_t alignment)
+{
+    return allocation::counted_allocate_aligned(size, static_cast<size_t>(alignment));
+}
+void* operator new[](size_t size, std::align_val_t alignment)
+{
+    return allocation::counted_allocate_aligned(size, static_cast<size_t>(alignment));
+}
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return allocation::try_allocate_aligned(size, static_cast<size_t>(alignment));
+}
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return allocation::try_allocate_aligned(size, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* memory, std::align_val_t) noexcept { allocation::counted_free_aligned(memory); }
+void operator delete[](void* memory, std::align_val_t) noexcept { allocation::counted_free_aligned(memory); }
+void operator delete(void* memory, size_t, std::align_val_t) noexcept { allocation::counted_free_aligned(memory); }
+void operator delete[](void* memory, size_t, std::align_val_t) noexcept { allocation::counted_free_aligned(memory); }
+void operator delete(void* memory, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    allocation::counted_free_aligned(memory);
+}
+void operator delete[](void* memory, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    allocation::counted_free_aligned(memory);
+}
+#endif
+
+#endif // ALLOCATION_COUNTER_HOOKS
@@ -0,0 +1,499 @@
+/*
+
+File: compactLinkedList.cpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#ifndef COMPACT_LINKED_LIST_TPP
+#define COMPACT_LINKED_LIST_TPP
+
+#include "compactLinkedList.hpp"
+
+/*******************************************************************************
+CONSTRUCTORS
+*******************************************************************************/
+
+// Fill
+template <typename T>
+CompactLinkedList<T>::CompactLinkedList(size_type count, const_reference data) : CompactLinkedList()
+{
+    for (; count > 0; --count)
+    {
+        push_front(data);
+    }
+}
+
+// Range
+template <typename T>
+template <typename InputIterator, typename ::std::enable_if< ::std::is_constructible
+         < T, decltype(*::std::declval<InputIterator>()) >::value >::type* >
+CompactLinkedList<T>::CompactLinkedList(InputIterator begin, InputIterator end) : CompactLinkedList()
+{
+    for (; begin != end; ++begin)
+    {
+        push_back(*begin);
+    }
+}
+
+// Copy
+template <typename T>
+CompactLinkedList<T>::CompactLinkedList(const CompactLinkedList<value_type>& origin)
+    : CompactLinkedList(origin.begin(), origin.end()) {}
+
+// Move
+template <typename T>
+CompactLinkedList<T>::CompactLinkedList(CompactLinkedList<value_type>&& origin) noexcept
+    : last(origin.last)
+{
+    origin.last = nullptr;
+}
+
+// Initializer List
+template <typename T>
+CompactLinkedList<T>::CompactLinkedList(std::initializer_list<value_type> init)
+    : CompactLinkedList(init.begin(), init.end()) {}
+
+// Destructor
+template <typename T>
+CompactLinkedList<T>::~CompactLinkedList()
+{
+    clear();
+}
+
+/*******************************************************************************
+ITERATORS
+*******************************************************************************/
+
+template <typename T>
+typename CompactLinkedList<T>::const_iterator CompactLinkedList<T>::cbegin() const noexcept
+{
+    return const_iterator(first(), this);
+}
+
+template <typename T>
+typename CompactLinkedList<T>::const_iterator CompactLinkedList<T>::begin() const noexcept
+{
+    return cbegin();
+}
+
+template <typename T>
+typename CompactLinkedList<T>::iterator CompactLinkedList<T>::begin() noexcept
+{
+    return iterator(first(), this);
+}
+
+template <typename T>
+typename CompactLinkedList<T>::const_iterator CompactLinkedList<T>::cend() const noexcept
+{
+    return const_iterator(nullptr, this);
+}
+
+template <typename T>
+typename CompactLinkedList<T>::const_iterator CompactLinkedList<T>::end() const noexcept
+{
+    return cend();
+}
+
+template <typename T>
+typename CompactLinkedList<T>::iterator CompactLinkedList<T>::end() noexcept
+{
+    return iterator(nullptr, this);
+}
+
+/*******************************************************************************
+ELEMENT ACCESS
+*******************************************************************************/
+
+template <typename T>
+T& CompactLinkedList<T>::front()
+{
+    return *first()->data();
+}
+
+template <typename T>
+const T& CompactLinkedList<T>::front() const
+{
+    return *first()->data();
+}
+
+template <typename T>
+T& CompactLinkedList<T>::back()
+{
+    return *last->data();
+}
+
+template <typename T>
+const T& CompactLinkedList<T>::back() const
+{
+    return *last->data();
+}
+
+/*******************************************************************************
+MODIFIERS
+*******************************************************************************/
+
+template <typename T>
+void CompactLinkedList<T>::push_front(const_reference data)
+{
+    node_pointer temp = new Node<T>(data);
+
+    if (empty())
+    {
+        temp->next(temp);
+        last = temp;
+        return;
+    }
+
+    temp->next(last->next());
+    last->next(temp);
+    return;
+}
+
+template <typename T>
+void CompactLinkedList<T>::push_back(const_reference data)
+{
+    // A new first node that becomes the last one by turning the ring
+    push_front(data);
+    last = last->next();
+    return;
+}
+
+template <typename T>
+void CompactLinkedList<T>::pop_front()
+{
+    if (empty()) { return; }
+
+    node_pointer temp = last->next();
+
+    if (temp == last)
+    {
+        last = nullptr;
+    }
+    else
+    {
+        last->next(temp->next());
+    }
+
+    delete temp;
+    return;
+}
+
+template <typename T>
+T& CompactLinkedList<T>::pop_front(reference out_data)
+{
+    if (empty()) { return out_data; }
+
+    out_data = front();
+    pop_front();
+    return out_data;
+}
+
+template <typename T>
+void CompactLinkedList<T>::pop_back()
+{
+    if (empty()) { return; }
+
+    iterator position(last, this);
+    erase(position);
+    return;
+}
+
+template <typename T>
+T& CompactLinkedList<T>::pop_back(reference out_data)
+{
+    if (empty()) { return out_data; }
+
+    out_data = back();
+    pop_back();
+    return out_data;
+}
+
+template <typename T>
+void CompactLinkedList<T>::insert(const_iterator& position, const_reference data)
+{
+    if (empty())
+    {
+        push_front(data);
+        position = cbegin();
+        return;
+    }
+
+    node_pointer temp = new Node<T>(data);
+    temp->next(position.node->next());
+    position.node->next(temp);
+
+    if (position.node == last)
+    {
+        last = temp;
+    }
+    return;
+}
+
+template <typename T>
+typename CompactLinkedList<T>::iterator CompactLinkedList<T>::erase(iterator& position)
+{
+    if (empty() || position.node == nullptr) { return position; }
+
+    // Starting from the last node finds the predecessor of the first as well
+    node_pointer previous = last;
+    while (previous->next() != position.node)
+    {
+        previous = previous->next();
+    }
+
+    node_pointer temp = position.node;
+
+    if (temp == previous)
+    {
+        last = nullptr;
+        position = end();
+    }
+    else
+    {
+        previous->next(temp->next());
+        if (temp == last)
+        {
+            last = previous;
+            position = end();
+        }
+        else
+        {
+            position = iterator(previous->next(), this);
+        }
+    }
+
+    delete temp;
+    return position;
+}
+
+template <typename T>
+void CompactLinkedList<T>::clear() noexcept
+{
+    node_pointer current = open();
+    while (current != nullptr)
+    {
+        node_pointer next = current->next();
+        delete current;
+        current = next;
+    }
+
+    last = nullptr;
+    return;
+}
+
+/*******************************************************************************
+CAPACITY
+*******************************************************************************/
+
+template <typename T>
+bool CompactLinkedList<T>::empty() const noexcept
+{
+    return last == nullptr;
+}
+
+template <typename T>
+size_t CompactLinkedList<T>::size() const noexcept
+{
+    size_type count = 0;
+    for (const_iterator it = cbegin(); it != cend(); ++it)
+    {
+        ++count;
+    }
+    return count;
+}
+
+template <typename T>
+size_t CompactLinkedList<T>::memory_usage() const
+{
+    size_type bytes = sizeof(*this);
+
+    for (const_iterator it = cbegin(); it != cend(); ++it)
+    {
+        bytes += footprint::allocated_size(sizeof(Node<T>)) + footprint::value_bytes(*it);
+    }
+
+    return bytes;
+}
+
+/*******************************************************************************
+OPERATIONS
+*******************************************************************************/
+
+template <typename T>
+void CompactLinkedList<T>::reverse() noexcept
+{
+    if (empty()) { return; }
+
+    // Every node is pointed back at its predecessor, the first node then
+    // closes the ring as the new last one
+    node_pointer head = last->next();
+    node_pointer previous = last;
+    node_pointer current = head;
+    do
+    {
+        node_pointer next = current->next();
+        current->next(previous);
+        previous = current;
+        current = next;
+    } while (current != head);
+
+    last = head;
+    return;
+}
+
+template <typename T>
+void CompactLinkedList<T>::remove(const_reference target)
+{
+    remove_if([&target] (const_reference value) { return value == target; });
+    return;
+}
+
+template <typename T>
+template <class Predicate>
+void CompactLinkedList<T>::remove_if(Predicate pred)
+{
+    node_pointer head = open();
+    node_pointer tail = nullptr;
+
+    // The ring is closed again around what is left if pred throws
+    try
+    {
+        node_chain::filter(head, pred, [](node_pointer node) { delete node; }, tail);
+    }
+    catch (...)
+    {
+        close(head, tail);
+        throw;
+    }
+    close(head, tail);
+    return;
+}
+
+template <typename T>
+typename CompactLinkedList<T>::iterator CompactLinkedList<T>::find(const_reference target)
+{
+    return find_if([&target](const_reference value) { return value == target; });
+}
+
+template <typename T>
+template <class Predicate>
+typename CompactLinkedList<T>::iterator CompactLinkedList<T>::find_if(Predicate pred)
+{
+    iterator it = begin();
+    while (it != end() && !pred(*it))
+    {
+        ++it;
+    }
+    return it;
+}
+
+template <typename T>
+void CompactLinkedList<T>::unique()
+{
+    std::unordered_set<T> seen;
+    remove_if([&seen](const_reference value) { return !seen.insert(value).second; });
+    return;
+}
+
+template <typename T>
+template <class Comparator>
+void CompactLinkedList<T>::sort(Comparator compare)
+{
+    node_pointer head = open();
+    node_pointer tail = nullptr;
+
+    try
+    {
+        node_chain::sort(head, compare, tail);
+    }
+    catch (...)
+    {
+        close(head, tail);
+        throw;
+    }
+    close(head, tail);
+    return;
+}
+
+template <typename T>
+void CompactLinkedList<T>::sort()
+{
+    sort([](const_reference lhs, const_reference rhs) { return lhs < rhs; });
+}
+
+/*******************************************************************************
+OPERATOR OVERLOADS
+*******************************************************************************/
+
+template <typename T>
+bool CompactLinkedList<T>::operator==(const CompactLinkedList<value_type>& rhs) const
+{
+    const_iterator left = cbegin();
+    const_iterator right = rhs.cbegin();
+
+    while (left != cend() && right != rhs.cend())
+    {
+        if (*left != *right) { return false; }
+        ++left;
+        ++right;
+    }
+
+    return left == cend() && right == rhs.cend();
+}
+
+template <typename T>
+bool CompactLinkedList<T>::operator!=(const CompactLinkedList<value_type>& rhs) const
+{
+    return !(*this == rhs);
+}
+
+template <typename T>
+CompactLinkedList<T>& CompactLinkedList<T>::operator=(CompactLinkedList<value_type> list) noexcept
+{
+    swap(list);
+    return *this;
+}
+
+template <typename T>
+void CompactLinkedList<T>::swap(CompactLinkedList<value_type>& other) noexcept
+{
+    std::swap(last, other.last);
+}
+
+/*******************************************************************************
+HELPER FUNCTIONS
+*******************************************************************************/
+
+template <typename T>
+Node<T>* CompactLinkedList<T>::open() noexcept
+{
+    if (empty()) { return nullptr; }
+
+    node_pointer head = last->next();
+    last->next(nullptr);
+    last = nullptr;
+    return head;
+}
+
+template <typename T>
+void CompactLinkedList<T>::close(node_pointer head, node_pointer tail) noexcept
+{
+    if (head == nullptr)
+    {
+        last = nullptr;
+        return;
+    }
+
+    tail->next(head);
+    last = tail;
+}
+
+#endif // COMPACT_LINKED_LIST_TPP
@@ -0,0 +1,214 @@
+/*
+
+File: compactLinkedList.hpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+/*
+A singly linked list that is a single pointer, for programs that hold
+millions of mostly empty or tiny lists, adjacency lists for example. An
+empty CompactLinkedList is one null pointer and allocates nothing.
+
+The nodes form a ring and the list keeps a pointer to the last one, whose
+next is the first. Both ends are reachable from that one pointer, so
+push_front, push_back and pop_front are constant time with no separate tail
+to store. pop_back and erase walk to the predecessor, as in LinkedList.
+
+The list has the operations of LinkedList without the parallel ones, and
+insert(position, value) inserts after position in the same way. Iterators
+refer to the list they came from, moving the list invalidates them.
+*/
+
+#ifndef COMPACT_LINKED_LIST_H
+#define COMPACT_LINKED_LIST_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <unordered_set>
+#include "node.hpp"
+#include "nodeChain.hpp"
+#include "memoryFootprint.hpp"
+
+template<typename T>
+class CompactLinkedList
+{
+public:
+
+    /* Type Defs */
+    typedef size_t size_type;
+    typedef T value_type;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef Node<T>* node_pointer;
+
+    // Value is T for iterator and const T for const_iterator
+    template <typename Value>
+    class basic_iterator
+    {
+    public:
+
+        typedef Value value_type;
+        typedef Value& reference;
+        typedef Value* pointer;
+        typedef std::ptrdiff_t difference_type;
+        typedef std::forward_iterator_tag iterator_category;
+        typedef basic_iterator self_type;
+
+        basic_iterator() : node(nullptr), list(nullptr) {}
+
+        // An iterator converts to a const_iterator
+        template <typename Other, typename = typename std::enable_if
+                 < std::is_same<Value, const Other>::value >::type>
+        basic_iterator(const basic_iterator<Other>& other) : node(other.node), list(other.list) {}
+
+        // Past the last node of the ring comes the end of the list
+        self_type& operator++()
+        {
+            node = (node == list->last) ? nullptr : node->next();
+            return *this;
+        }
+
+        self_type operator++(int)
+        {
+            self_type previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        reference operator*() const { return *node->data(); }
+        pointer operator->() const { return node->data(); }
+
+        bool operator==(const self_type& rhs) const { return node == rhs.node; }
+        bool operator!=(const self_type& rhs) const { return node != rhs.node; }
+
+        friend class CompactLinkedList<T>;
+        template <typename> friend class basic_iterator;
+
+    private:
+
+        basic_iterator(node_pointer node, const CompactLinkedList* list) : node(node), list(list) {}
+
+        node_pointer node;
+        const CompactLinkedList* list;
+    };
+
+    typedef basic_iterator<T> iterator;
+    typedef basic_iterator<const T> const_iterator;
+
+    /* Constructors */
+
+    // Default
+    CompactLinkedList() noexcept : last(nullptr) {}
+
+    // Fill
+    CompactLinkedList(size_type count, const_reference data);
+
+    // Range
+    template <typename InputIterator, typename ::std::enable_if< ::std::is_constructible
+             < T, decltype(*::std::declval<InputIterator>()) >::value >::type* = nullptr >
+    CompactLinkedList(InputIterator begin, InputIterator end);
+
+    // Copy
+    CompactLinkedList(const CompactLinkedList<value_type>& origin);
+
+    // Move, leaves origin empty
+    CompactLinkedList(CompactLinkedList<value_type>&& origin) noexcept;
+
+    // Initializer List
+    explicit CompactLinkedList(std::initializer_list<value_type> init);
+
+    // Destructor
+    ~CompactLinkedList();
+
+    /* Iterators */
+    const_iterator cbegin() const noexcept;
+    const_iterator begin() const noexcept;
+    iterator begin() noexcept;
+
+    const_iterator cend() const noexcept;
+    const_iterator end() const noexcept;
+    iterator end() noexcept;
+
+    /* Element Access */
+    reference front();
+    const_reference front() const;
+    reference back();
+    const_reference back() const;
+
+    /* Modifiers */
+    void push_front(const_reference data);
+    void push_back(const_reference data);
+
+    void pop_front();
+    reference pop_front(reference out_data);
+    void pop_back();
+    reference pop_back(reference out_data);
+
+    void insert(const_iterator& position, const_reference data);
+
+    iterator erase(iterator& position);
+
+    void clear() noexcept;
+
+    /* Capacity */
+    bool empty() const noexcept;
+    size_type size() const noexcept;
+
+    // Bytes held by the list, counted as LinkedList::memory_usage() does
+    size_type memory_usage() const;
+
+    /* Operations */
+    void reverse() noexcept;
+
+    void remove(const_reference target);
+    template <class Predicate>
+    void remove_if(Predicate pred);
+
+    iterator find(const_reference target);
+    template <class Predicate>
+    iterator find_if(Predicate pred);
+
+    // Keeps the first occurrence of every value, T must be hashable
+    void unique();
+
+    template <class Comparator>
+    void sort(Comparator compare);
+    void sort();
+
+    /* Operator Overloads */
+    bool operator==(const CompactLinkedList<value_type>& rhs) const;
+    bool operator!=(const CompactLinkedList<value_type>& rhs) const;
+    CompactLinkedList<value_type>& operator=(CompactLinkedList<value_type> list) noexcept;
+
+    /* Swap */
+    void swap(CompactLinkedList<value_type>& other) noexcept;
+
+private:
+
+    // The last node of the ring, null when the list is empty
+    node_pointer last;
+
+    node_pointer first() const { return (last == nullptr) ? nullptr : last->next(); }
+
+    // Breaks the ring into a null terminated chain and returns its first node
+    node_pointer open() noexcept;
+
+    // Closes the chain from first to tail into the ring again
+    void close(node_pointer first, node_pointer tail) noexcept;
+};
+
+#include "compactLinkedList.cpp"
+
+#endif // COMPACT_LINKED_LIST_H
@@ -0,0 +1,406 @@
+/*
+
+File: concurrentLinkedList.cpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#ifndef CONCURRENT_LINKED_LIST_TPP
+#define CONCURRENT_LINKED_LIST_TPP
+
+#include "concurrentLinkedList.hpp"
+
+/*******************************************************************************
+ITERATOR
+*******************************************************************************/
+
+template <typename T>
+ConcurrentLinkedList<T>::iterator::iterator(link* previous, node* current)
+    : previous(previous), current(current) {}
+
+template <typename T>
+ConcurrentLinkedList<T>::iterator::iterator(iterator&& origin) noexcept
+    : previous(origin.previous), current(origin.current)
+{
+    origin.previous = nullptr;
+    origin.current = nullptr;
+}
+
+template <typename T>
+ConcurrentLinkedList<T>::iterator::~iterator()
+{
+    release();
+}
+
+template <typename T>
+typename ConcurrentLinkedList<T>::iterator&
+ConcurrentLinkedList<T>::iterator::operator=(iterator&& origin) noexcept
+{
+    if (this != &origin)
+    {
+        release();
+
+        previous = origin.previous;
+        current = origin.current;
+
+        origin.previous = nullptr;
+        origin.current = nullptr;
+    }
+    return *this;
+}
+
+template <typename T>
+typename ConcurrentLinkedList<T>::iterator&
+ConcurrentLinkedList<T>::iterator::operator++()
+{
+    node* next = static_cast<node*>(current->next);
+
+    if (next == nullptr)
+    {
+        release();
+        return *this;
+    }
+
+    // Lock coupling, the next lock is held before the previous is released
+    next->lock.lock();
+    previous->lock.unlock();
+
+    previous = current;
+    current = next;
+
+    return *this;
+}
+
+template <typename T>
+typename ConcurrentLinkedList<T>::iterator::reference
+ConcurrentLinkedList<T>::iterator::operator*() const
+{
+    return current->data;
+}
+
+template <typename T>
+typename ConcurrentLinkedList<T>::iterator::pointer
+ConcurrentLinkedList<T>::iterator::operator->() const
+{
+    return &current->data;
+}
+
+template <typename T>
+bool ConcurrentLinkedList<T>::iterator::operator==(const self_type& rhs) const
+{
+    return current == rhs.current;
+}
+
+template <typename T>
+bool ConcurrentLinkedList<T>::iterator::operator!=(const self_type& rhs) const
+{
+    return !(*this == rhs);
+}
+
+template <typename T>
+void ConcurrentLinkedList<T>::iterator::release() noexcept
+{
+    if (current == nullptr) { return; }
+
+    current->lock.unlock();
+    previous->lock.unlock();
+
+    previous = nullptr;
+    current = nullptr;
+
+    return;
+}
+
+/*******************************************************************************
+CONSTRUCTORS
+*******************************************************************************/
+
+// Default
+template <typename T>
+ConcurrentLinkedList<T>::ConcurrentLinkedList() : head(), count(0) {}
+
+// Range
+template <typename T>
+template <typename InputIterator>
+ConcurrentLinkedList<T>::ConcurrentLinkedList(InputIterator begin, InputIterator end)
+    : ConcurrentLinkedList()
+{
+    // No other thread can see the list yet, append without locking
+    link* last = &head;
+    for (; begin != end; ++begin)
+    {
+        last->next = new node(*begin);
+        last = last->next;
+        ++count;
+    }
+}
+
+// Initializer List
+template <typename T>
+ConcurrentLinkedList<T>::ConcurrentLinkedList(std::initializer_list<value_type> init)
+    : ConcurrentLinkedList(init.begin(), init.end()) {}
+
+// Destructor
+template <typename T>
+ConcurrentLinkedList<T>::~ConcurrentLinkedList()
+{
+    link* current = head.next;
+    while (current != nullptr)
+    {
+        link* next = current->next;
+        delete static_cast<node*>(current);
+        current = next;
+    }
+}
+
+/*******************************************************************************
+ITERATORS
+*******************************************************************************/
+
+template <typename T>
+typename ConcurrentLinkedList<T>::iterator ConcurrentLinkedList<T>::begin()
+{
+    head.lock.lock();
+
+    node* first = static_cast<node*>(head.next);
+    if (first == nullptr)
+    {
+        head.lock.unlock();
+        return end();
+    }
+
+    first->lock.lock();
+    return iterator(&head, first);
+}
+
+template <typename T>
+typename ConcurrentLinkedList<T>::iterator ConcurrentLinkedList<T>::end()
+{
+    return iterator();
+}
+
+/*******************************************************************************
+MODIFIERS
+*******************************************************************************/
+
+template <typename T>
+void ConcurrentLinkedList<T>::push_front(const_reference data)
+{
+    node* temp = new node(data);
+
+    std::lock_guard<std::mutex> guard(head.lock);
+
+    temp->next = head.next;
+    head.next = temp;
+    ++count;
+
+    return;
+}
+
+template <typename T>
+void ConcurrentLinkedList<T>::push_back(const_reference data)
+{
+    node* temp = new node(data);
+
+    // Walk to the last link hand-over-hand, holding at most two locks
+    std::unique_lock<std::mutex> guard(head.lock);
+    link* last = &head;
+    while (last->next != nullptr)
+    {
+        std::unique_lock<std::mutex> next_guard(last->next->lock);
+        last = last->next;
+        guard.swap(next_guard);
+    }
+
+    last->next = temp;
+    ++count;
+
+    return;
+}
+
+template <typename T>
+bool ConcurrentLinkedList<T>::pop_front()
+{
+    std::unique_lock<std::mutex> guard(head.lock);
+
+    link* first = head.next;
+    if (first == nullptr) { return false; }
+
+    // Wait for any thread still working on the first node to move past it
+    first->lock.lock();
+    head.next = first->next;
+    first->lock.unlock();
+    --count;
+
+    guard.unlock();
+
+    delete static_cast<node*>(first);
+
+    return true;
+}
+
+template <typename T>
+bool ConcurrentLinkedList<T>::pop_front(reference out_data)
+{
+    std::unique_lock<std::mutex> guard(head.lock);
+
+    node* first = static_cast<node*>(head.next);
+    if (first == nullptr) { return false; }
+
+    {
+        std::lock_guard<std::mutex> first_guard(first->lock);
+        out_data = first->data;
+        head.next = first->next;
+        --count;
+    }
+
+    guard.unlock();
+
+    delete first;
+
+    return true;
+}
+
+template <typename T>
+void ConcurrentLinkedList<T>::insert(iterator& position, const_reference data)
+{
+    node* temp = new node(data);
+
+    // position already holds the lock of the node we link after
+    temp->next = position.current->next;
+    position.current->next = temp;
+    ++count;
+
+    return;
+}
+
+template <typename T>
+typename ConcurrentLinkedList<T>::iterator&
+ConcurrentLinkedList<T>::erase(iterator& position)
+{
+    if (position.current == nullptr) { return position; }
+
+    node* target = position.current;
+    node* next = static_cast<node*>(target->next);
+
+    if (next != nullptr)
+    {
+        next->lock.lock();
+    }
+
+    position.previous->next = next;
+
+    // Nobody can be waiting on target, that requires the previous lock we hold
+    target->lock.unlock();
+    delete target;
+    --count;
+
+    if (next == nullptr)
+    {
+        position.previous->lock.unlock();
+        position.previous = nullptr;
+    }
+    position.current = next;
+
+    return position;
+}
+
+template <typename T>
+void ConcurrentLinkedList<T>::clear()
+{
+    while (pop_front());
+
+    return;
+}
+
+/*******************************************************************************
+CAPACITY
+*******************************************************************************/
+
+template <typename T>
+bool ConcurrentLinkedList<T>::empty() const
+{
+    return count.load() == 0;
+}
+
+template <typename T>
+typename ConcurrentLinkedList<T>::size_type ConcurrentLinkedList<T>::size() const
+{
+    return count.load();
+}
+
+template <typename T>
+typename ConcurrentLinkedList<T>::size_type ConcurrentLinkedList<T>::memory_usage() const
+{
+    size_type bytes = sizeof(*this);
+
+    std::unique_lock<std::mutex> guard(head.lock);
+    const link* current = &head;
+    while (current->next != nullptr)
+    {
+        std::unique_lock<std::mutex> next_guard(current->next->lock);
+        current = current->next;
+        guard.swap(next_guard);
+
+        bytes += footprint::allocated_size(sizeof(node))
+               + footprint::value_bytes(static_cast<const node*>(current)->data);
+    }
+
+    return bytes;
+}
+
+/*******************************************************************************
+OPERATIONS
+*******************************************************************************/
+
+template <typename T>
+void ConcurrentLinkedList<T>::remove(const_reference target)
+{
+    remove_if([&target] (const_reference value) { return value == target; });
+    return;
+}
+
+template <typename T>
+template <class Predicate>
+void ConcurrentLinkedList<T>::remove_if(Predicate pred)
+{
+    iterator it = begin();
+    while (it != end())
+    {
+        pred(*it) ? erase(it) : ++it;
+    }
+    return;
+}
+
+template <typename T>
+typename ConcurrentLinkedList<T>::iterator
+ConcurrentLinkedList<T>::find(const_reference target)
+{
+    return find_if([&target](const_reference value){ return value == target; });
+}
+
+template <typename T>
+template <class Predicate>
+typename ConcurrentLinkedList<T>::iterator
+ConcurrentLinkedList<T>::find_if(Predicate pred)
+{
+    iterator it = begin();
+    while (it != end())
+    {
+        if (pred(*it))
+        {
+            return it;
+        }
+        ++it;
+    }
+    return it;
+}
+
+#endif // CONCURRENT_LINKED_LIST_TPP
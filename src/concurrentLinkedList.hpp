@@ -0,0 +1,178 @@
+/*
+
+File: concurrentLinkedList.hpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+/*
+ConcurrentLinkedList is a singly linked list that may be modified by several
+threads at once. Every node carries its own mutex and all traversal uses lock
+coupling (hand-over-hand locking): the lock on the next node is acquired before
+the lock on the current node is released, so threads working at different
+positions of the list never block each other.
+
+Iterators own the locks of the node they point to and of its predecessor, which
+is what makes insert(position) and erase(position) safe. As a consequence the
+iterators are move-only, and a thread holding a live iterator must not call any
+other member function of the same list until the iterator reaches end() or is
+destroyed, otherwise it will deadlock on its own locks.
+*/
+
+#ifndef CONCURRENT_LINKED_LIST_H
+#define CONCURRENT_LINKED_LIST_H
+
+#include <atomic>
+#include <mutex>
+#include <iterator>
+#include <initializer_list>
+#include "memoryFootprint.hpp"
+
+template<typename T>
+class ConcurrentLinkedList
+{
+private:
+
+    // The sentinel head only needs a lock and a link, it never holds a value
+    struct link
+    {
+        link() : next(nullptr) {}
+
+        // Mutable so that const walks can lock hand-over-hand as well
+        mutable std::mutex lock;
+        link* next;
+    };
+
+    struct node : public link
+    {
+        explicit node(const T& value) : link(), data(value) {}
+
+        T data;
+    };
+
+public:
+
+    /* Type Defs */
+    typedef size_t size_type;
+    typedef T value_type;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+
+    class iterator
+    {
+    public:
+        // Typedefs to make iterators STL friendly
+        typedef T value_type;
+        typedef T& reference;
+        typedef T* pointer;
+        typedef iterator self_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef std::input_iterator_tag iterator_category;
+
+        // Constructors
+        iterator() : previous(nullptr), current(nullptr) {}
+        iterator(iterator&& origin) noexcept;
+
+        // Releases any locks still held
+        ~iterator();
+
+        // Iterators own locks and cannot be copied
+        iterator(const iterator&) = delete;
+        iterator& operator=(const iterator&) = delete;
+        iterator& operator=(iterator&& origin) noexcept;
+
+        // operator overloads
+        self_type& operator++(); // Prefix ++
+        reference operator*() const;
+        pointer operator->() const;
+
+        bool operator==(const self_type& rhs) const;
+        bool operator!=(const self_type& rhs) const;
+
+        friend class ConcurrentLinkedList<T>;
+
+    private:
+
+        // Both links are locked whenever current is not nullptr
+        iterator(link* previous, node* current);
+
+        void release() noexcept;
+
+        link* previous;
+        node* current;
+    };
+
+    /* Constructors */
+
+    // Default
+    ConcurrentLinkedList();
+
+    // Range
+    template <typename InputIterator>
+    ConcurrentLinkedList(InputIterator begin, InputIterator end);
+
+    // Initializer List
+    explicit ConcurrentLinkedList(std::initializer_list<value_type> init);
+
+    // Mutexes cannot be copied, neither can the list
+    ConcurrentLinkedList(const ConcurrentLinkedList&) = delete;
+    ConcurrentLinkedList& operator=(const ConcurrentLinkedList&) = delete;
+
+    // Destructor, must not race with any other member function
+    ~ConcurrentLinkedList();
+
+    /* Iterators */
+    iterator begin();
+    iterator end();
+
+    /* Modifiers */
+    void push_front(const_reference data);
+    void push_back(const_reference data);
+
+    bool pop_front();
+    bool pop_front(reference out_data);
+
+    // Inserts after position, which keeps both of its locks
+    void insert(iterator& position, const_reference data);
+
+    // Unlinks the element at position and advances position to the next one
+    iterator& erase(iterator& position);
+
+    void clear();
+
+    /* Capacity */
+    bool empty() const;
+    size_type size() const;
+
+    // Bytes held by the list, its nodes with the allocator's overhead and the
+    // memory the values own. Walks the list hand-over-hand.
+    size_type memory_usage() const;
+
+    /* Operations */
+    void remove(const_reference target);
+    template <class Predicate>
+    void remove_if(Predicate pred);
+
+    iterator find(const_reference target);
+    template <class Predicate>
+    iterator find_if(Predicate pred);
+
+private:
+
+    link head;
+
+    std::atomic<size_type> count;
+};
+
+#include "concurrentLinkedList.cpp"
+
+#endif // CONCURRENT_LINKED_LIST_H
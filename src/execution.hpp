@@ -0,0 +1,98 @@
+/*
+
+File: execution.hpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+/*
+Execution policies select the parallel overloads of the list operations, in the
+spirit of std::execution from C++17:
+
+    list.for_each(execution::par, function);
+    list.reduce(execution::par.on(pool).grain(4096), 0, std::plus<int>());
+
+Without on() the work runs on the default executor, ThreadPool::shared()
+unless another one was installed with set_default_executor().
+*/
+
+#ifndef EXECUTION_H
+#define EXECUTION_H
+
+#include <atomic>
+#include <cstddef>
+#include "executor.hpp"
+#include "threadPool.hpp"
+
+namespace execution
+{
+
+inline std::atomic<Executor*>& injected_executor()
+{
+    static std::atomic<Executor*> executor(nullptr);
+    return executor;
+}
+
+// Replaces the shared pool for every policy without an executor of its own,
+// nullptr restores the shared pool. The executor must outlive its use.
+inline void set_default_executor(Executor* executor)
+{
+    injected_executor().store(executor);
+}
+
+inline Executor& default_executor()
+{
+    Executor* executor = injected_executor().load();
+    return (executor != nullptr) ? *executor : ThreadPool::shared();
+}
+
+class parallel_policy
+{
+public:
+
+    constexpr parallel_policy() : pool(nullptr), min_segment(1024) {}
+
+    // Runs on the given executor instead of the default one
+    parallel_policy on(Executor& executor) const
+    {
+        parallel_policy policy(*this);
+        policy.pool = &executor;
+        return policy;
+    }
+
+    // Lists are never split into segments shorter than this many nodes
+    parallel_policy grain(size_t nodes) const
+    {
+        parallel_policy policy(*this);
+        policy.min_segment = (nodes == 0) ? 1 : nodes;
+        return policy;
+    }
+
+    Executor& executor() const
+    {
+        return (pool != nullptr) ? *pool : default_executor();
+    }
+
+    size_t grain() const
+    {
+        return min_segment;
+    }
+
+private:
+
+    Executor* pool;
+    size_t min_segment;
+};
+
+constexpr parallel_policy par {};
+
+} // namespace execution
+
+#endif // EXECUTION_H
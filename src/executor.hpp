@@ -0,0 +1,44 @@
+/*
+
+File: executor.hpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+/*
+Executor is the interface the parallel list algorithms schedule their work on.
+ThreadPool implements it. Any other scheduler can be injected by implementing
+it and passing it to execution::par.on(executor), or process wide through
+execution::set_default_executor(&executor).
+*/
+
+#ifndef EXECUTOR_H
+#define EXECUTOR_H
+
+#include <cstddef>
+#include <functional>
+
+class Executor
+{
+public:
+
+    typedef std::function<void(size_t)> index_task;
+
+    virtual ~Executor() {}
+
+    // Number of threads that run tasks, used to decide how finely to split work
+    virtual size_t size() const = 0;
+
+    // Calls task(i) for every i in [0, count) and returns once all of them are
+    // done. An exception thrown by a task is rethrown to the caller.
+    virtual void parallel_for(size_t count, const index_task& task) = 0;
+};
+
+#endif // EXECUTOR_H
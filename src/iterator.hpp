@@ -15,11 +15,13 @@ https://github.com/AlexanderJDupree/LinkedListsCPP
 #ifndef ITERATORS_H
 #define ITERATORS_H
 
+#include <cstddef>
 #include <iterator>
 #include "node.hpp"
 
-// Forward Declaration
+// Forward Declarations
 template <typename T> class LinkedList;
+template <typename T, size_t N> class SmallLinkedList;
 
 template <typename T>
 class iterator_base
@@ -46,6 +48,7 @@ public:
     bool operator!=(const self_type& rhs) const;
 
     friend class LinkedList<T>;
+    template <typename U, size_t N> friend class SmallLinkedList;
 
 protected:
 
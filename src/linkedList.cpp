@@ -23,16 +23,16 @@ CONSTRUCTORS
 
 // Default
 template <typename T>
-LinkedList<T>::LinkedList() : head(nullptr), tail(nullptr) {}
+LinkedList<T>::LinkedList() 
+    : head(nullptr), tail(nullptr), extras(nullptr) {}
 // Fill
 template <typename T>
 LinkedList<T>::LinkedList(size_type count, const_reference data) : LinkedList()
 {
-    while (count > 0)
-    {
-        push_front(data);
-        --count;
-    }
+    LIST_STATS_CALL(construct);
+
+    repeat source = { &data };
+    append(source, count);
 }
 
 // Range
@@ -41,40 +41,50 @@ template <typename InputIterator, typename ::std::enable_if< ::std::is_construct
          < T, decltype(*::std::declval<InputIterator>()) >::value >::type* >
 LinkedList<T>::LinkedList(InputIterator begin, InputIterator end) : LinkedList()
 {
-    for (;begin != end; ++begin)
-    {
-        push_back(*begin);
-    }
+    LIST_STATS_CALL(construct);
+    append_range(begin, end, typename std::iterator_traits<InputIterator>::iterator_category());
 }
 
-
-
 // Copy
 template <typename T>
 LinkedList<T>::LinkedList(const LinkedList<value_type>& origin) : LinkedList()
 {
-    LinkedList<T>::const_iterator it;
-    for (it = origin.cbegin(); it != origin.cend(); ++it)
+    LIST_STATS_CALL(copy);
+
+    // Counting first lets the copies go into one block. Runs of nodes laid
+    // out in order are counted without waiting on each link.
+    size_type count = 0;
+    for (const Node<T>* current = origin.head; current != nullptr; )
+    {
+        LIST_PREFETCH(current->next());
+        size_type run = origin.run_length(current, std::numeric_limits<size_type>::max());
+        count += run;
+        current = current[run - 1].next();
+    }
+    LIST_STATS_NODES(copy, count);
+    LIST_STATS_LENGTH(count);
+
+    if (count >= batch_minimum)
     {
-        push_back(*it);
+        copy_runs(origin, count, std::is_trivially_copyable<Node<T> >());
+        return;
     }
+    append(origin.cbegin(), count);
 }
 
 // Initializer List
 template <typename T>
 LinkedList<T>::LinkedList(std::initializer_list<value_type> init) : LinkedList()
 {
-    typename std::initializer_list<T>::iterator it;
-    for(it = init.begin(); it != init.end(); ++it)
-    {
-        push_back(*it);
-    }
+    LIST_STATS_CALL(construct);
+    append(init.begin(), init.size());
 }
 
 // Destructor
 template <typename T>
 LinkedList<T>::~LinkedList() 
 {
+    LIST_STATS_CALL(destroy);
     clear();
 }
 
@@ -118,6 +128,34 @@ typename LinkedList<T>::iterator LinkedList<T>::end()
     return iterator(nullptr);
 } 
 
+/*******************************************************************************
+ELEMENT ACCESS
+*******************************************************************************/
+
+template <typename T>
+typename LinkedList<T>::reference LinkedList<T>::at(size_type i)
+{
+    LIST_STATS_CALL(at);
+
+    if (!empty()) { side(); }
+
+    node_pointer node = seek(i, extras != nullptr);
+    if (node == nullptr) { throw std::out_of_range("LinkedList::at: position past the end"); }
+
+    return *node->data();
+}
+
+template <typename T>
+typename LinkedList<T>::const_reference LinkedList<T>::at(size_type i) const
+{
+    LIST_STATS_CALL(at);
+
+    node_pointer node = seek(i, false);
+    if (node == nullptr) { throw std::out_of_range("LinkedList::at: position past the end"); }
+
+    return *node->data();
+}
+
 /*******************************************************************************
 MODIFIERS
 *******************************************************************************/
@@ -125,7 +163,10 @@ MODIFIERS
 template <typename T>
 void LinkedList<T>::push_front(const_reference data)
 {
+    LIST_STATS_CALL(push_front);
+
     node_pointer temp = new Node<T>(data);
+    LIST_STATS_ALLOCATIONS(1);
 
     temp->next(head);
     head = temp;
@@ -134,6 +175,7 @@ void LinkedList<T>::push_front(const_reference data)
     {
         tail = head;
     }
+    shift_positions(0, true);
 
     return;
 }
@@ -141,6 +183,8 @@ void LinkedList<T>::push_front(const_reference data)
 template <typename T>
 void LinkedList<T>::push_back(const_reference data)
 {
+    LIST_STATS_CALL(push_back);
+
     if (empty())
     {
         push_front(data);
@@ -148,6 +192,7 @@ void LinkedList<T>::push_back(const_reference data)
     }
 
     node_pointer temp = new Node<T>(data);
+    LIST_STATS_ALLOCATIONS(1);
 
     tail->next(temp);
     tail = temp;
@@ -158,12 +203,21 @@ void LinkedList<T>::push_back(const_reference data)
 template<typename T>
 void LinkedList<T>::pop_front()
 {
+    LIST_STATS_CALL(pop_front);
+
     if (empty()) { return; }
 
     node_pointer next = head->next();
 
-    delete head;
+    release(head);
+    LIST_STATS_FREES(1);
     head = next;
+    shift_positions(0, false);
+
+    if (head == nullptr)
+    {
+        tail = nullptr;
+    }
 
     return;
 }
@@ -171,13 +225,22 @@ void LinkedList<T>::pop_front()
 template<typename T>
 T& LinkedList<T>::pop_front(reference out_data)
 {
+    LIST_STATS_CALL(pop_front);
+
     if (empty()) { return out_data; }
 
     node_pointer next = head->next();
     out_data = *head->data();
 
-    delete head;
+    release(head);
+    LIST_STATS_FREES(1);
     head = next;
+    shift_positions(0, false);
+
+    if (head == nullptr)
+    {
+        tail = nullptr;
+    }
 
     return out_data;
 }
@@ -185,15 +248,26 @@ T& LinkedList<T>::pop_front(reference out_data)
 template<typename T>
 void LinkedList<T>::pop_back()
 {
-    if (empty()) { return; }
+    LIST_STATS_CALL(pop_back);
+
+    if (head == tail)
+    {
+        pop_front();
+        return;
+    }
 
     node_pointer previous = head; 
+    LIST_STATS_COUNTER(walked);
 
     while (previous->next() != tail)
     {
         previous = previous->next();
+        LIST_STATS_STEP(walked);
     }
-    delete tail;
+    LIST_STATS_NODES(pop_back, walked);
+    forget_tail();
+    release(tail);
+    LIST_STATS_FREES(1);
 
     previous->next(nullptr);
     tail = previous;
@@ -205,16 +279,26 @@ void LinkedList<T>::pop_back()
 template<typename T>
 T& LinkedList<T>::pop_back(reference out_data)
 {
-    if (empty()) { return out_data; }
+    LIST_STATS_CALL(pop_back);
+
+    if (head == tail)
+    {
+        return pop_front(out_data);
+    }
 
     node_pointer previous = head; 
+    LIST_STATS_COUNTER(walked);
 
     while (previous->next() != tail)
     {
         previous = previous->next();
+        LIST_STATS_STEP(walked);
     }
+    LIST_STATS_NODES(pop_back, walked);
     out_data = *tail->data();
-    delete tail;
+    forget_tail();
+    release(tail);
+    LIST_STATS_FREES(1);
 
     previous->next(nullptr);
     tail = previous;
@@ -225,6 +309,8 @@ T& LinkedList<T>::pop_back(reference out_data)
 template<typename T>
 void LinkedList<T>::insert(const_iterator& position, const_reference data)
 {
+    LIST_STATS_CALL(insert);
+
     if(empty())
     {
         push_front(data);
@@ -232,7 +318,14 @@ void LinkedList<T>::insert(const_iterator& position, const_reference data)
         return;
     }
 
+    // Appending shifts no position, anything else shifts an unknown one
+    if (position.node != tail)
+    {
+        forget_positions();
+    }
+
     node_pointer newNode = new Node<T>(data);
+    LIST_STATS_ALLOCATIONS(1);
     newNode->next(position.node->next());
 
     position.node->next(newNode);
@@ -248,15 +341,30 @@ void LinkedList<T>::insert(const_iterator& position, const_reference data)
 template <typename T>
 void LinkedList<T>::insert(const_iterator position, size_type n, const_reference data)
 {
-    LinkedList<value_type> temp(n, data);
-    insert(position, temp.begin(), temp.end());
+    if (n == 0) { return; }
+
+    if (empty())
+    {
+        push_front(data);
+        position = iterator(head);
+        --n;
+    }
+
+    for (; n > 0; --n)
+    {
+        insert(position, data);
+        ++position;
+    }
     return;
 }
 
 template <typename T>
-template <typename InputIterator>
+template <typename InputIterator, typename ::std::enable_if< ::std::is_constructible
+         < T, decltype(*::std::declval<InputIterator>()) >::value >::type* >
 void LinkedList<T>::insert(const_iterator position, InputIterator begin, InputIterator end)
 {
+    if (begin == end) { return; }
+
     if (empty())
     {
         push_front(*begin++);
@@ -275,22 +383,36 @@ template<typename T>
 typename LinkedList<T>::iterator 
 LinkedList<T>::erase(iterator& position)
 {
+    LIST_STATS_CALL(erase);
+
     if (empty()) { return position; }
 
     node_pointer previous = head;
+    size_type index = 0;
+    LIST_STATS_COUNTER(walked);
 
     if (previous != position.node)
     {
+        index = 1;
         while (previous->next() != position.node)
         {
             previous = previous->next();
+            ++index;
+            LIST_STATS_STEP(walked);
         }
     }
+    LIST_STATS_NODES(erase, walked);
+    shift_positions(index, false);
 
     previous->next(position.node->next());
 
     node_pointer temp = position.node;
 
+    if (temp == tail)
+    {
+        tail = (temp == head) ? nullptr : previous;
+    }
+
     if (temp == head)
     {
         head = head->next();
@@ -298,7 +420,8 @@ LinkedList<T>::erase(iterator& position)
 
     position = iterator(previous->next());
 
-    delete temp;
+    release(temp);
+    LIST_STATS_FREES(1);
 
     return position;
 }
@@ -315,273 +438,1659 @@ LinkedList<T>::erase(iterator& first, iterator& last)
     return first;
 }
 
-
 template <typename T>
-void LinkedList<T>::clear()
+typename LinkedList<T>::iterator LinkedList<T>::insert_at(size_type i, const_reference data)
 {
-    if (empty())
+    if (i == 0)
     {
-        return;
+        push_front(data);
+        return begin();
     }
 
-    node_pointer previous = head;
+    LIST_STATS_CALL(insert);
 
-    while (head != nullptr)
+    if (!empty()) { side(); }
+
+    node_pointer previous = seek(i - 1, extras != nullptr);
+    if (previous == nullptr) { throw std::out_of_range("LinkedList::insert_at: position past the end"); }
+
+    node_pointer node = new Node<T>(data);
+    LIST_STATS_ALLOCATIONS(1);
+    node->next(previous->next());
+    previous->next(node);
+
+    if (previous == tail)
     {
-        previous = head;
-        head = head->next();
-        delete previous;
+        tail = node;
     }
 
-    return;
-}
-
-/*******************************************************************************
-CAPACITY
-*******************************************************************************/ 
+    shift_positions(i, true);
+    extras->indexed.finger = node;
+    extras->indexed.finger_position = i;
 
-template <typename T>
-bool LinkedList<T>::empty() const
-{
-    return !(head);
+    return iterator(node);
 }
 
 template <typename T>
-size_t LinkedList<T>::size() const
+typename LinkedList<T>::iterator LinkedList<T>::erase_at(size_type i)
 {
-    size_type SIZE = 0;
+    if (i == 0)
+    {
+        if (empty()) { throw std::out_of_range("LinkedList::erase_at: position past the end"); }
 
-    for(const_iterator it = cbegin(); it != cend(); ++it)
+        pop_front();
+        return begin();
+    }
+
+    LIST_STATS_CALL(erase);
+
+    if (!empty()) { side(); }
+
+    // The finger stays on the node before, which is still at i - 1
+    node_pointer previous = seek(i - 1, extras != nullptr);
+    if (previous == nullptr || previous->next() == nullptr)
     {
-        ++SIZE;
+        throw std::out_of_range("LinkedList::erase_at: position past the end");
     }
 
-    return SIZE;
+    node_pointer node = previous->next();
+    previous->next(node->next());
+
+    if (node == tail)
+    {
+        tail = previous;
+    }
+
+    shift_positions(i, false);
+    release(node);
+    LIST_STATS_FREES(1);
+
+    return iterator(previous->next());
 }
 
-/*******************************************************************************
-Operations
-*******************************************************************************/ 
 
 template <typename T>
-void LinkedList<T>::reverse() noexcept
+void LinkedList<T>::clear()
 {
-    if (empty()) { return; }
+    LIST_STATS_CALL(clear);
+
+    interrupt_compaction();
 
-    reverse_links(head, nullptr);
+    node_pointer previous = head;
+    LIST_STATS_COUNTER(walked);
+
+    // Nodes in a block are only destroyed, without counting down the block's
+    // live nodes, since every block is freed below
+    while (head != nullptr)
+    {
+        previous = head;
+        head = head->next();
+        LIST_PREFETCH(head);
+        if (in_block(previous)) { previous->~Node<T>(); }
+        else { delete previous; }
+        LIST_STATS_STEP(walked);
+    }
+    tail = nullptr;
 
-    std::swap(head, tail);
+    LIST_STATS_NODES(clear, walked);
+    LIST_STATS_FREES(walked);
+    LIST_STATS_LENGTH(walked);
 
+    if (extras != nullptr)
+    {
+        free_blocks(extras->compacted.blocks.size());
+        delete extras;
+        extras = nullptr;
+    }
     return;
 }
 
 template <typename T>
-void LinkedList<T>::remove(const_reference target)
+template <typename InputIterator, typename ::std::enable_if< ::std::is_constructible
+         < T, decltype(*::std::declval<InputIterator>()) >::value >::type* >
+void LinkedList<T>::assign(InputIterator first, InputIterator last)
 {
-    remove_if([&target] (const_reference value) { return value == target; });
+    LIST_STATS_CALL(assign);
+
+    LinkedList<T> replacement(first, last);
+    swap(*this, replacement);
     return;
 }
 
 template <typename T>
-template <class Predicate>
-void LinkedList<T>::remove_if(Predicate pred)
+void LinkedList<T>::assign(size_type n, const_reference value)
 {
-    iterator it = begin();
-    while(it != end())
-    {
-        pred(*it) ? erase(it) : ++it;
-    }
+    LIST_STATS_CALL(assign);
+
+    LinkedList<T> replacement(n, value);
+    swap(*this, replacement);
     return;
 }
 
 template <typename T>
-typename LinkedList<T>::iterator LinkedList<T>::find(const_reference target)
+void LinkedList<T>::resize(size_type n)
 {
-    return find_if([&target](const_reference value){return value == target;});
+    resize(n, T());
+    return;
 }
 
 template <typename T>
-template <class Predicate>
-typename LinkedList<T>::iterator LinkedList<T>::find_if(Predicate pred)
+void LinkedList<T>::resize(size_type n, const_reference value)
 {
-    iterator it = begin();
-    while(it != end())
+    LIST_STATS_CALL(resize);
+
+    if (n == 0)
     {
-        if(pred(*it))
-        {
-            return it;
-        }
-        ++it;
+        clear();
+        return;
     }
-    return it;
-}
 
-template <typename T>
-void LinkedList<T>::unique()
-{
-    std::unordered_set<T> uniqueElements;
-    iterator it = begin();
-    while(it != end())
+    // Walks to the last node that stays, or counts a list too short
+    size_type count = 1;
+    node_pointer last = head;
+    while (last != nullptr && count < n && last->next() != nullptr)
     {
-        if (uniqueElements.find(*it) == uniqueElements.end())
-        {
-            uniqueElements.insert(*it);
-            ++it;
-        }
-        else
-        {
-            it = erase(it);
-        }
+        last = last->next();
+        ++count;
     }
-    return;
-}
+    LIST_STATS_NODES(resize, (last != nullptr) ? count : 0);
 
-template <typename T>
-template <class Comparator>
-void LinkedList<T>::sort(Comparator compare)
-{
-    merge_sort(head, compare);
+    if (last == nullptr || count < n)
+    {
+        repeat source = { &value };
+        append(source, n - ((last == nullptr) ? 0 : count));
+        return;
+    }
+
+    // Already n elements, nothing to erase
+    if (last->next() == nullptr)
+    {
+        return;
+    }
+
+    forget_positions();
 
+    node_pointer rest = last->next();
+    last->next(nullptr);
+    tail = last;
+
+    while (rest != nullptr)
+    {
+        node_pointer next = rest->next();
+        release(rest);
+        LIST_STATS_FREES(1);
+        rest = next;
+    }
     return;
 }
 
+/*******************************************************************************
+CAPACITY
+*******************************************************************************/ 
+
 template <typename T>
-void LinkedList<T>::sort()
+bool LinkedList<T>::empty() const
 {
-    sort([](const_reference val1, const_reference val2){return val1 < val2;});
+    return !(head);
 }
 
-/*******************************************************************************
-OPERATOR OVERLOADS
-*******************************************************************************/
-
 template <typename T>
-bool LinkedList<T>::operator==(const LinkedList<value_type>& rhs) const
+size_t LinkedList<T>::size() const
 {
-    if (size() != rhs.size()) { return false; }
+    LIST_STATS_CALL(size);
 
-    LinkedList<T>::const_iterator left = cbegin();
-    LinkedList<T>::const_iterator right = rhs.cbegin();
+    size_type SIZE = 0;
 
-    while(left != cend() && right != rhs.cend())
+    for(const_iterator it = cbegin(); it != cend(); ++it)
     {
-        if (*left != *right) { return false; }
-        ++left;
-        ++right;
+        LIST_PREFETCH(it.node->next());
+        ++SIZE;
     }
+    LIST_STATS_NODES(size, SIZE);
+    LIST_STATS_LENGTH(SIZE);
 
-    return true;
+    return SIZE;
 }
 
 template <typename T>
-bool LinkedList<T>::operator!=(const LinkedList<value_type>& rhs) const
+size_t LinkedList<T>::memory_usage() const
 {
-    return !(*this == rhs);
-}
+    size_type bytes = sizeof(*this);
 
-template <typename T>
-LinkedList<T>& LinkedList<T>::operator=(LinkedList<value_type> list)
-{
-    swap(*this, list);
+    if (extras != nullptr)
+    {
+        const std::vector<node_block>& blocks = extras->compacted.blocks;
+        const std::vector<skip>& skips = extras->indexed.skips;
 
-    return *this;
+        bytes += footprint::allocated_size(sizeof(side_state));
+        if (blocks.capacity() > 0)
+        {
+            bytes += footprint::allocated_size(blocks.capacity() * sizeof(node_block));
+        }
+        for (const node_block& block : blocks)
+        {
+            bytes += footprint::allocated_size(block.capacity * sizeof(slot));
+        }
+        if (skips.capacity() > 0)
+        {
+            bytes += footprint::allocated_size(skips.capacity() * sizeof(skip));
+        }
+    }
+
+    for (node_pointer current = head; current != nullptr; current = current->next())
+    {
+        LIST_PREFETCH(current->next());
+        if (!in_block(current))
+        {
+            bytes += footprint::allocated_size(sizeof(Node<T>));
+        }
+        bytes += footprint::value_bytes(*current->data());
+    }
+
+    return bytes;
 }
 
 /*******************************************************************************
+COMPACTION
 *******************************************************************************/
 
 template <typename T>
-void LinkedList<T>::swap(LinkedList<T>& newList, LinkedList<T>& oldList) noexcept
+void LinkedList<T>::compact()
 {
-    // Enables ADL
-    using std::swap;
-    
-    // Swap pointers, reassigns ownership
-    swap(newList.head, oldList.head);
-    swap(newList.tail, oldList.tail);
-    return;
-}
+    interrupt_compaction();
 
-template <typename T>
-void LinkedList<T>::reverse_links(node_pointer current, node_pointer previous) noexcept
-{
-    if (current->next() != nullptr)
+    size_type count = 0;
+    for (node_pointer current = head; current != nullptr; current = current->next())
     {
-        reverse_links(current->next(), current);
+        ++count;
     }
 
-    current->next(previous);
+    // One block that fits the whole list, the pass never opens another
+    if (count > 0)
+    {
+        compaction& state = side().compacted;
+        state.running = true;
+        state.pass_begin = state.blocks.size();
+
+        node_block block(new slot[count], count);
+        state.blocks.push_back(block);
+    }
 
+    compact(count);
     return;
 }
 
 template <typename T>
-template <class Comparator>
-void LinkedList<T>::merge_sort(node_pointer& begin, Comparator compare)
+bool LinkedList<T>::compact(size_type steps)
 {
-    // Base case
-    if(begin == nullptr || begin->next() == nullptr)
+    LIST_STATS_CALL(compact);
+
+    // Moved nodes get new addresses
+    forget_positions();
+
+    compaction& state = side().compacted;
+    if (!state.running)
     {
-        return;
+        state.running = true;
+        state.cursor = nullptr;
+        state.pass_begin = state.blocks.size();
     }
 
-    node_pointer left = begin;
-    node_pointer right = begin->next();
+    node_pointer previous = state.cursor;
+    node_pointer current = (previous != nullptr) ? previous->next() : head;
+    LIST_STATS_COUNTER(moved);
 
-    // Split the list in half, break the links from left -> right
-    split(left, right);
+    for (; current != nullptr && steps > 0; --steps)
+    {
+        LIST_PREFETCH(current->next());
 
-    left = begin;
+        // A pass fills its blocks in order and opens one twice as large when
+        // the last is full, so a long list ends up in a few large blocks
+        const bool first_block = state.blocks.size() == state.pass_begin;
+        if (first_block || state.blocks.back().used == state.blocks.back().capacity)
+        {
+            size_type capacity = first_block ? 16 : 2 * state.blocks.back().capacity;
+            node_block block(new slot[capacity], capacity);
+            state.blocks.push_back(block);
+        }
 
-    // Recursively break the links and split the list in half
-    merge_sort(left, compare);
-    merge_sort(right, compare);
+        node_block& block = state.blocks.back();
+        void* address = static_cast<void*>(block.slots + block.used++);
+        node_pointer moved = ::new (address) Node<T>(std::move(*current->data()));
+        block.live.store(block.live.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
 
-    // Relink the list together in sorted order
-    begin = merge(left, right, compare);
+        moved->next(current->next());
+        if (previous != nullptr) { previous->next(moved); }
+        else { head = moved; }
 
-    return;
-}
+        if (current == tail) { tail = moved; }
 
-template <typename T>
-void LinkedList<T>::split(node_pointer& left, node_pointer& right)
-{
-    // right travels through the list two links at a time
-    while((right = right->next()) != nullptr)
-    {
-        if (right->next() != nullptr)
-        {
-            // left travels through the list only one link at a time
-            left = left->next();
-            right = right->next();
-        }
+        release(current);
+        previous = moved;
+        current = moved->next();
+        LIST_STATS_STEP(moved);
     }
-    // Left is at the midpoint of the list
-    right = left->next();
-    left->next(nullptr);
-}
+    LIST_STATS_NODES(compact, moved);
 
-template <typename T>
-template <class Comparator>
-Node<T>* LinkedList<T>::merge(node_pointer left, node_pointer right, Comparator compare)
-{
-    node_pointer begin = nullptr;
+    state.cursor = previous;
+    if (current != nullptr) { return false; }
 
-    if(left == nullptr) { return right; }
-    else if (right == nullptr) { return left; }
+    // Every node now sits in a block of this pass or was allocated on its
+    // own since. The older blocks went with their last node, except one a
+    // throwing constructor left empty.
+    free_blocks(state.pass_begin);
+    state.running = false;
+    state.cursor = nullptr;
 
-    if(compare(*left->data(), *right->data()))
+    // Only an empty list has no block left, and nothing to index
+    if (state.blocks.empty())
     {
-        begin = left;
-        begin->next(merge(left->next(), right, compare));
+        delete extras;
+        extras = nullptr;
     }
-    else
-    {
-        begin = right;
-        begin->next(merge(left, right->next(), compare));
-    }
-    return begin;
+    return true;
 }
 
+/*******************************************************************************
+Operations
+*******************************************************************************/ 
+
+template <typename T>
+void LinkedList<T>::reverse() noexcept
+{
+    LIST_STATS_CALL(reverse);
+
+    interrupt_compaction();
+    forget_positions();
+    if (empty()) { return; }
+
+    tail = head;
+    head = reverse_links(head, nullptr);
+
+    return;
+}
+
+template <typename T>
+void LinkedList<T>::reverse(const_iterator first, const_iterator last) noexcept
+{
+    LIST_STATS_CALL(reverse);
+
+    if (first == last) { return; }
+
+    interrupt_compaction();
+    forget_positions();
+
+    node_pointer begin = first.node;
+    if (begin == head)
+    {
+        head = reverse_links(begin, last.node);
+    }
+    else
+    {
+        node_pointer previous = head;
+        while (previous->next() != begin)
+        {
+            previous = previous->next();
+        }
+        previous->next(reverse_links(begin, last.node));
+    }
+
+    if (last.node == nullptr)
+    {
+        tail = begin;
+    }
+    return;
+}
+
+template <typename T>
+typename LinkedList<T>::iterator LinkedList<T>::rotate(const_iterator middle) noexcept
+{
+    LIST_STATS_CALL(rotate);
+
+    if (middle.node == head) { return end(); }
+    if (middle.node == nullptr) { return begin(); }
+
+    interrupt_compaction();
+    forget_positions();
+
+    node_pointer previous = head;
+    LIST_STATS_COUNTER(walked);
+    while (previous->next() != middle.node)
+    {
+        previous = previous->next();
+        LIST_STATS_STEP(walked);
+    }
+    LIST_STATS_NODES(rotate, walked);
+
+    // The front run moves behind the old tail, the node before middle ends
+    // the list now
+    node_pointer first = head;
+    tail->next(first);
+    head = middle.node;
+    tail = previous;
+    tail->next(nullptr);
+
+    return iterator(first);
+}
+
+template <typename T>
+void LinkedList<T>::remove(const_reference target)
+{
+    remove_if([&target] (const_reference value) { return value == target; });
+    return;
+}
+
+template <typename T>
+template <class Predicate>
+void LinkedList<T>::remove_if(Predicate pred)
+{
+    LIST_STATS_CALL(remove);
+    forget_positions();
+
+    // Relinks the survivors in one pass instead of erasing one at a time
+    filter(head, nullptr, [&pred](node_pointer node) { return pred(*node->data()); },
+           head, tail);
+
+    if (tail != nullptr)
+    {
+        tail->next(nullptr);
+    }
+    return;
+}
+
+template <typename T>
+typename LinkedList<T>::iterator LinkedList<T>::find(const_reference target)
+{
+    return find_if([&target](const_reference value){return value == target;});
+}
+
+template <typename T>
+template <class Predicate>
+typename LinkedList<T>::iterator LinkedList<T>::find_if(Predicate pred)
+{
+    LIST_STATS_CALL(find);
+    LIST_STATS_COUNTER(walked);
+
+    iterator it = begin();
+    while(it != end())
+    {
+        LIST_STATS_STEP(walked);
+        LIST_PREFETCH(it.node->next());
+        if(pred(*it))
+        {
+            break;
+        }
+        ++it;
+    }
+    LIST_STATS_NODES(find, walked);
+    return it;
+}
+
+template <typename T>
+void LinkedList<T>::unique()
+{
+    unique(std::hash<T>(), std::equal_to<T>());
+    return;
+}
+
+template <typename T>
+template <class Hash, class Equal>
+void LinkedList<T>::unique(Hash hash, Equal equal)
+{
+    LIST_STATS_CALL(unique);
+
+    if (head == tail) { return; }
+
+    // Kept nodes go into an open addressing table with their hashes, values
+    // are never copied and a lookup only compares values of equal hash
+    struct entry
+    {
+        size_t hash;
+        node_pointer node;
+    };
+
+    // Fibonacci hashing takes the top bits of the product, which spreads
+    // hashes that differ only in their high bits
+    struct table
+    {
+        std::vector<entry> entries;
+        size_type bits;
+        size_type kept;
+
+        size_type home(size_t code) const
+        {
+            const size_t product = code * static_cast<size_t>(0x9E3779B97F4A7C15ull);
+            return product >> (std::numeric_limits<size_t>::digits - bits);
+        }
+
+        // Doubles the table, the stored hashes are placed again without
+        // touching the values
+        void grow()
+        {
+            std::vector<entry> old(size_type(1) << ++bits, entry { 0, nullptr });
+            old.swap(entries);
+
+            const size_type mask = entries.size() - 1;
+            for (const entry& item : old)
+            {
+                if (item.node == nullptr) { continue; }
+
+                size_type index = home(item.hash);
+                while (entries[index].node != nullptr) { index = (index + 1) & mask; }
+                entries[index] = item;
+            }
+        }
+    };
+
+    // Grows as values are kept instead of being sized for the whole list, a
+    // list of few distinct values keeps a small table that stays in cache
+    table seen = { std::vector<entry>(16, entry { 0, nullptr }), 4, 0 };
+
+    forget_positions();
+
+    filter(head, nullptr, [&seen, &hash, &equal](node_pointer node)
+    {
+        const size_t code = hash(*node->data());
+        const size_type mask = seen.entries.size() - 1;
+
+        size_type index = seen.home(code);
+        for (; seen.entries[index].node != nullptr; index = (index + 1) & mask)
+        {
+            const entry& item = seen.entries[index];
+            if (item.hash == code && equal(*item.node->data(), *node->data())) { return true; }
+        }
+
+        entry kept = { code, node };
+        seen.entries[index] = kept;
+
+        // At most half full, so probe sequences stay short
+        if (2 * ++seen.kept > seen.entries.size()) { seen.grow(); }
+        return false;
+    }, head, tail);
+
+    tail->next(nullptr);
+    return;
+}
+
+template <typename T>
+void LinkedList<T>::unique_adjacent()
+{
+    unique_adjacent([](const_reference kept, const_reference value) { return kept == value; });
+    return;
+}
+
+template <typename T>
+template <class BinaryPredicate>
+void LinkedList<T>::unique_adjacent(BinaryPredicate pred)
+{
+    LIST_STATS_CALL(unique);
+    forget_positions();
+
+    node_pointer kept = nullptr;
+    filter(head, nullptr, [&kept, &pred](node_pointer node)
+    {
+        if (kept != nullptr && pred(*kept->data(), *node->data())) { return true; }
+
+        kept = node;
+        return false;
+    }, head, tail);
+
+    if (tail != nullptr)
+    {
+        tail->next(nullptr);
+    }
+    return;
+}
+
+template <typename T>
+void LinkedList<T>::unique_sorted()
+{
+    // In an ascending list kept < value unless the two are equal
+    unique_adjacent([](const_reference kept, const_reference value) { return !(kept < value); });
+    return;
+}
+
+template <typename T>
+template <class Comparator>
+void LinkedList<T>::sort(Comparator compare)
+{
+    LIST_STATS_CALL(sort);
+
+    interrupt_compaction();
+    forget_positions();
+
+    node_chain::sort_counts counts = { 0, 0 };
+    node_chain::sort(head, compare, tail, counts);
+    LIST_STATS_NODES(sort, counts.merged);
+    LIST_STATS_LENGTH(counts.length);
+    return;
+}
+
+template <typename T>
+void LinkedList<T>::sort()
+{
+    sort([](const_reference val1, const_reference val2){return val1 < val2;});
+}
+
+/*******************************************************************************
+PARALLEL OPERATIONS
+*******************************************************************************/
+
+template <typename T>
+template <class Function>
+void LinkedList<T>::for_each(const execution::parallel_policy& policy, Function f)
+{
+    std::vector<node_pointer> starts = segments(policy);
+
+    policy.executor().parallel_for(starts.size(), [&starts, &f](size_type i)
+    {
+        node_pointer last = (i + 1 < starts.size()) ? starts[i + 1] : nullptr;
+        for (node_pointer current = starts[i]; current != last; current = current->next())
+        {
+            f(*current->data());
+        }
+    });
+    return;
+}
+
+template <typename T>
+template <class UnaryOperation>
+void LinkedList<T>::transform(const execution::parallel_policy& policy, UnaryOperation op)
+{
+    for_each(policy, [&op](reference value) { value = op(value); });
+    return;
+}
+
+template <typename T>
+template <typename U, class BinaryOperation>
+U LinkedList<T>::reduce(const execution::parallel_policy& policy, U init, BinaryOperation op) const
+{
+    return transform_reduce(policy, init, op, [](const_reference value) -> const_reference
+    {
+        return value;
+    });
+}
+
+template <typename T>
+template <typename U, class BinaryOperation, class UnaryOperation>
+U LinkedList<T>::transform_reduce(const execution::parallel_policy& policy, U init,
+                                  BinaryOperation combine, UnaryOperation convert) const
+{
+    std::vector<node_pointer> starts = segments(policy);
+
+    // Every segment folds into its own slot, the slots are combined in order.
+    // U is wrapped so a vector of bool is not packed into shared words.
+    struct partial_result { U value; };
+    std::vector<partial_result> partials(starts.size(), partial_result { init });
+
+    policy.executor().parallel_for(starts.size(), 
+    [&starts, &partials, &combine, &convert](size_type i)
+    {
+        node_pointer last = (i + 1 < starts.size()) ? starts[i + 1] : nullptr;
+        node_pointer current = starts[i];
+
+        U partial = convert(*current->data());
+        for (current = current->next(); current != last; current = current->next())
+        {
+            partial = combine(partial, convert(*current->data()));
+        }
+        partials[i].value = partial;
+    });
+
+    for (const partial_result& partial : partials)
+    {
+        init = combine(init, partial.value);
+    }
+    return init;
+}
+
+template <typename T>
+template <class Predicate>
+typename LinkedList<T>::size_type
+LinkedList<T>::count_if(const execution::parallel_policy& policy, Predicate pred) const
+{
+    return transform_reduce(policy, size_type(0), 
+        [](size_type left, size_type right) { return left + right; },
+        [&pred](const_reference value) -> size_type { return pred(value) ? 1 : 0; });
+}
+
+template <typename T>
+template <class Predicate>
+bool LinkedList<T>::any_of(const execution::parallel_policy& policy, Predicate pred) const
+{
+    std::vector<node_pointer> starts = segments(policy);
+
+    // Segments stop scanning as soon as any of them has found a match
+    std::atomic<bool> found(false);
+
+    policy.executor().parallel_for(starts.size(), [&starts, &found, &pred](size_type i)
+    {
+        node_pointer last = (i + 1 < starts.size()) ? starts[i + 1] : nullptr;
+        for (node_pointer current = starts[i]; current != last; current = current->next())
+        {
+            if (found.load(std::memory_order_relaxed)) { return; }
+
+            if (pred(*current->data()))
+            {
+                found.store(true, std::memory_order_relaxed);
+                return;
+            }
+        }
+    });
+    return found.load();
+}
+
+template <typename T>
+template <class Predicate>
+bool LinkedList<T>::all_of(const execution::parallel_policy& policy, Predicate pred) const
+{
+    return !any_of(policy, [&pred](const_reference value) { return !pred(value); });
+}
+
+template <typename T>
+typename LinkedList<T>::iterator
+LinkedList<T>::find(const execution::parallel_policy& policy, const_reference target)
+{
+    return find_if(policy, [&target](const_reference value){return value == target;});
+}
+
+template <typename T>
+template <class Predicate>
+typename LinkedList<T>::iterator
+LinkedList<T>::find_if(const execution::parallel_policy& policy, Predicate pred)
+{
+    std::vector<node_pointer> starts = segments(policy);
+    std::vector<node_pointer> matches(starts.size(), nullptr);
+
+    // Index of the earliest segment known to hold a match, segments after it
+    // can stop scanning since their matches can no longer be the first
+    std::atomic<size_type> first(starts.size());
+
+    policy.executor().parallel_for(starts.size(), 
+    [&starts, &matches, &first, &pred](size_type i)
+    {
+        node_pointer last = (i + 1 < starts.size()) ? starts[i + 1] : nullptr;
+        for (node_pointer current = starts[i]; current != last; current = current->next())
+        {
+            if (first.load(std::memory_order_relaxed) < i) { return; }
+
+            if (pred(*current->data()))
+            {
+                matches[i] = current;
+
+                size_type known = first.load();
+                while (i < known && !first.compare_exchange_weak(known, i));
+                return;
+            }
+        }
+    });
+
+    size_type index = first.load();
+    return (index < matches.size()) ? iterator(matches[index]) : end();
+}
+
+template <typename T>
+void LinkedList<T>::remove(const execution::parallel_policy& policy, const_reference target)
+{
+    remove_if(policy, [&target] (const_reference value) { return value == target; });
+    return;
+}
+
+template <typename T>
+template <class Predicate>
+void LinkedList<T>::remove_if(const execution::parallel_policy& policy, Predicate pred)
+{
+    // Workers only count down the blocks' live nodes while they free nodes,
+    // the blocks they empty are freed once they are done
+    interrupt_compaction();
+    forget_positions();
+
+    std::vector<node_pointer> starts = segments(policy);
+    std::vector<node_pointer> firsts(starts.size(), nullptr);
+    std::vector<node_pointer> lasts(starts.size(), nullptr);
+    std::vector<char> started(starts.size(), 0);
+
+    // Segments are filtered independently, then joined in one cheap pass
+    try
+    {
+        policy.executor().parallel_for(starts.size(),
+        [this, &starts, &firsts, &lasts, &started, &pred](size_type i)
+        {
+            node_pointer last = (i + 1 < starts.size()) ? starts[i + 1] : nullptr;
+            started[i] = 1;
+            filter(starts[i], last, [&pred](node_pointer node) { return pred(*node->data()); },
+                   firsts[i], lasts[i], true);
+        });
+    }
+    catch (...)
+    {
+        // A segment that threw kept the rest of its nodes, one that never
+        // started keeps all of them. Joined, the list is whole again.
+        for (size_type i = 0; i < starts.size(); ++i)
+        {
+            if (started[i]) { continue; }
+
+            node_pointer last = (i + 1 < starts.size()) ? starts[i + 1] : nullptr;
+            firsts[i] = starts[i];
+            for (lasts[i] = starts[i]; lasts[i]->next() != last; lasts[i] = lasts[i]->next()) {}
+        }
+        stitch(firsts, lasts);
+        reclaim_blocks();
+        throw;
+    }
+
+    stitch(firsts, lasts);
+    reclaim_blocks();
+    return;
+}
+
+template <typename T>
+void LinkedList<T>::unique(const execution::parallel_policy& policy)
+{
+    // Values are compared through their nodes, nothing is copied
+    struct value_hash
+    {
+        size_t operator()(node_pointer node) const { return std::hash<T>()(*node->data()); }
+    };
+    struct value_equal
+    {
+        bool operator()(node_pointer lhs, node_pointer rhs) const 
+        {
+            return *lhs->data() == *rhs->data();
+        }
+    };
+    struct entry
+    {
+        node_pointer node;
+        size_type index;
+    };
+
+    // Workers only count down the blocks' live nodes while they free nodes,
+    // the blocks they empty are freed once they are done
+    interrupt_compaction();
+    forget_positions();
+
+    std::vector<node_pointer> starts = segments(policy);
+    const size_type count = starts.size();
+
+    // Every value belongs to exactly one hash partition, so partitions can
+    // find duplicates independently. buckets[s][p] holds the nodes of segment
+    // s that fall in partition p, in list order.
+    std::vector<std::vector<std::vector<entry> > > buckets(count);
+    std::vector<std::vector<char> > duplicate(count);
+
+    Executor& executor = policy.executor();
+
+    executor.parallel_for(count, [&starts, &buckets, &duplicate, count](size_type s)
+    {
+        node_pointer last = (s + 1 < starts.size()) ? starts[s + 1] : nullptr;
+
+        buckets[s].resize(count);
+        size_type index = 0;
+        for (node_pointer current = starts[s]; current != last; current = current->next())
+        {
+            entry item = { current, index++ };
+            buckets[s][value_hash()(current) % count].push_back(item);
+        }
+        duplicate[s].assign(index, 0);
+    });
+
+    executor.parallel_for(count, [&buckets, &duplicate, count](size_type p)
+    {
+        std::unordered_set<node_pointer, value_hash, value_equal> seen;
+
+        // Walking the segments in order keeps the first occurrence in the list
+        for (size_type s = 0; s < count; ++s)
+        {
+            for (const entry& item : buckets[s][p])
+            {
+                if (!seen.insert(item.node).second)
+                {
+                    duplicate[s][item.index] = 1;
+                }
+            }
+        }
+    });
+
+    std::vector<node_pointer> firsts(count, nullptr);
+    std::vector<node_pointer> lasts(count, nullptr);
+
+    executor.parallel_for(count, [this, &starts, &duplicate, &firsts, &lasts](size_type s)
+    {
+        node_pointer last = (s + 1 < starts.size()) ? starts[s + 1] : nullptr;
+        const std::vector<char>& flags = duplicate[s];
+
+        size_type index = 0;
+        filter(starts[s], last, [&flags, &index](node_pointer) { return flags[index++] != 0; },
+               firsts[s], lasts[s], true);
+    });
+
+    stitch(firsts, lasts);
+    reclaim_blocks();
+    return;
+}
+
+template <typename T>
+template <class Comparator>
+void LinkedList<T>::sort(const execution::parallel_policy& policy, Comparator compare)
+{
+    interrupt_compaction();
+    forget_positions();
+
+    std::vector<node_pointer> firsts = segments(policy);
+    std::vector<node_pointer> lasts(firsts.size(), nullptr);
+
+    Executor& executor = policy.executor();
+
+    // Every segment is cut from its successor and sorted on its own
+    const std::vector<node_pointer> starts(firsts);
+    executor.parallel_for(starts.size(), [&starts, &firsts, &lasts, &compare](size_type i)
+    {
+        node_pointer end = (i + 1 < starts.size()) ? starts[i + 1] : nullptr;
+        node_pointer last = starts[i];
+        while (last->next() != end)
+        {
+            last = last->next();
+        }
+        last->next(nullptr);
+
+        node_chain::sort_counts counts = { 0, 0 };
+        node_chain::sort(firsts[i], compare, lasts[i], counts);
+        LIST_STATS_NODES(sort, counts.merged);
+    });
+
+    // Sorted runs are merged pairwise, each round halves the number of runs
+    while (firsts.size() > 1)
+    {
+        const size_type pairs = firsts.size() / 2;
+        std::vector<node_pointer> merged_firsts(firsts.size() - pairs, nullptr);
+        std::vector<node_pointer> merged_lasts(firsts.size() - pairs, nullptr);
+
+        executor.parallel_for(pairs, 
+        [&firsts, &merged_firsts, &merged_lasts, &compare](size_type j)
+        {
+            size_t merged = 0;
+            merged_firsts[j] = node_chain::merge(firsts[2 * j], firsts[2 * j + 1], compare,
+                                                 merged_lasts[j], merged);
+            LIST_STATS_NODES(sort, merged);
+        });
+
+        if (firsts.size() % 2 != 0)
+        {
+            merged_firsts.back() = firsts.back();
+            merged_lasts.back() = lasts.back();
+        }
+        firsts.swap(merged_firsts);
+        lasts.swap(merged_lasts);
+    }
+
+    head = firsts.empty() ? nullptr : firsts.front();
+    tail = lasts.empty() ? nullptr : lasts.front();
+    return;
+}
+
+template <typename T>
+void LinkedList<T>::sort(const execution::parallel_policy& policy)
+{
+    sort(policy, [](const_reference val1, const_reference val2){return val1 < val2;});
+}
+
+/*******************************************************************************
+OPERATOR OVERLOADS
+*******************************************************************************/
+
+template <typename T>
+bool LinkedList<T>::operator==(const LinkedList<value_type>& rhs) const
+{
+    LIST_STATS_CALL(equal);
+    LIST_STATS_COUNTER(walked);
+
+    // Both lists are walked side by side in a single pass, which also finds
+    // a difference in length, so the misses of the two walks overlap. Where
+    // both lists have a run of nodes laid out in order, the run is compared
+    // like an array, without loading the links one after another.
+    const Node<T>* left = head;
+    const Node<T>* right = rhs.head;
+
+    while (left != nullptr && right != nullptr)
+    {
+        size_type run = rhs.run_length(right, run_length(left, run_chunk));
+        LIST_PREFETCH(left[run - 1].next());
+        LIST_PREFETCH(right[run - 1].next());
+
+        for (size_type i = 0; i < run; ++i)
+        {
+            LIST_STATS_STEP(walked);
+            if (*left[i].data() != *right[i].data())
+            {
+                LIST_STATS_NODES(equal, walked);
+                return false;
+            }
+        }
+        left = left[run - 1].next();
+        right = right[run - 1].next();
+    }
+    LIST_STATS_NODES(equal, walked);
+
+    return left == nullptr && right == nullptr;
+}
+
+template <typename T>
+bool LinkedList<T>::operator!=(const LinkedList<value_type>& rhs) const
+{
+    return !(*this == rhs);
+}
+
+template <typename T>
+LinkedList<T>& LinkedList<T>::operator=(LinkedList<value_type> list)
+{
+    LIST_STATS_CALL(assign);
+
+    swap(*this, list);
+
+    return *this;
+}
+
+/*******************************************************************************
+*******************************************************************************/
+
+template <typename T>
+void LinkedList<T>::swap(LinkedList<T>& newList, LinkedList<T>& oldList) noexcept
+{
+    // Enables ADL
+    using std::swap;
+    
+    // Swap pointers, reassigns ownership
+    swap(newList.head, oldList.head);
+    swap(newList.tail, oldList.tail);
+    swap(newList.extras, oldList.extras);
+    return;
+}
+
+template <typename T>
+typename LinkedList<T>::side_state& LinkedList<T>::side()
+{
+    if (extras == nullptr)
+    {
+        extras = new side_state { compaction { std::vector<node_block>(), 0, nullptr, false },
+                                  position_index { 0, nullptr, std::vector<skip>() } };
+    }
+    return *extras;
+}
+
+template <typename T>
+typename LinkedList<T>::node_pointer
+LinkedList<T>::reverse_links(node_pointer first, node_pointer last) noexcept
+{
+    node_pointer previous = last;
+    LIST_STATS_COUNTER(walked);
+
+    // Iterative, reversing a long list takes no stack
+    while (first != last)
+    {
+        node_pointer next = first->next();
+        first->next(previous);
+        previous = first;
+        first = next;
+        LIST_STATS_STEP(walked);
+    }
+    LIST_STATS_NODES(reverse, walked);
+
+    return previous;
+}
+
+template <typename T>
+std::vector<typename LinkedList<T>::node_pointer>
+LinkedList<T>::segments(const execution::parallel_policy& policy) const
+{
+    // Every parallel algorithm splits the list here first
+    LIST_STATS_CALL(parallel);
+    LIST_STATS_COUNTER(walked);
+
+    // A few segments per thread lets work stealing even out uneven segments
+    const size_type target = (policy.executor().size() + 1) * 4;
+
+    std::vector<node_pointer> starts;
+    starts.reserve(2 * target);
+
+    // Record a start every stride nodes. The length is unknown until the walk
+    // ends, so whenever twice the target is reached every other start is
+    // dropped and the stride doubles, the list is walked only once.
+    size_type stride = policy.grain();
+    size_type gap = 0;
+    for (node_pointer current = head; current != nullptr; current = current->next())
+    {
+        if (gap == 0)
+        {
+            starts.push_back(current);
+            gap = stride;
+
+            if (starts.size() == 2 * target)
+            {
+                for (size_type i = 0; i < target; ++i)
+                {
+                    starts[i] = starts[2 * i];
+                }
+                starts.resize(target);
+                stride *= 2;
+            }
+        }
+        --gap;
+        LIST_STATS_STEP(walked);
+    }
+    LIST_STATS_NODES(parallel, walked);
+    LIST_STATS_LENGTH(walked);
+    return starts;
+}
+
+template <typename T>
+template <class Predicate>
+void LinkedList<T>::filter(node_pointer first, node_pointer last, Predicate discard,
+                           node_pointer& kept_first, node_pointer& kept_last, bool concurrently)
+{
+    kept_first = nullptr;
+    kept_last = nullptr;
+
+    // Discarded nodes are chained together and freed as one batch at the end
+    node_pointer discarded = nullptr;
+    auto free_discarded = [this, &discarded, concurrently]()
+    {
+        while (discarded != nullptr)
+        {
+            node_pointer next = discarded->next();
+            release(discarded, concurrently);
+            LIST_STATS_FREES(1);
+            discarded = next;
+        }
+    };
+
+    // Counted as remove, also when the parallel unique filters a segment
+    LIST_STATS_COUNTER(walked);
+
+    node_pointer current = first;
+    try
+    {
+        while (current != last)
+        {
+            node_pointer next = current->next();
+            LIST_PREFETCH(next);
+            LIST_STATS_STEP(walked);
+
+            if (discard(current))
+            {
+                current->next(discarded);
+                discarded = current;
+            }
+            else
+            {
+                if (kept_last != nullptr)
+                {
+                    kept_last->next(current);
+                }
+                else
+                {
+                    kept_first = current;
+                }
+                kept_last = current;
+            }
+            current = next;
+        }
+    }
+    catch (...)
+    {
+        // The node discard threw on and the ones after it are kept as they
+        // are, so the range is whole again before the exception leaves
+        if (kept_last != nullptr)
+        {
+            kept_last->next(current);
+        }
+        else
+        {
+            kept_first = current;
+        }
+        for (kept_last = current; kept_last->next() != last; kept_last = kept_last->next()) {}
+
+        free_discarded();
+        throw;
+    }
+    LIST_STATS_NODES(remove, walked);
+
+    free_discarded();
+    return;
+}
+
+template <typename T>
+void LinkedList<T>::stitch(const std::vector<node_pointer>& firsts, 
+                           const std::vector<node_pointer>& lasts)
+{
+    head = nullptr;
+    tail = nullptr;
+
+    for (size_type i = 0; i < firsts.size(); ++i)
+    {
+        if (firsts[i] == nullptr) { continue; }
+
+        if (tail != nullptr)
+        {
+            tail->next(firsts[i]);
+        }
+        else
+        {
+            head = firsts[i];
+        }
+        tail = lasts[i];
+    }
+
+    if (tail != nullptr)
+    {
+        tail->next(nullptr);
+    }
+    return;
+}
+
+template <typename T>
+void LinkedList<T>::release(node_pointer node, bool concurrently) noexcept
+{
+    // The search is written out here rather than through block_of(), every
+    // node a list frees goes through it
+    if (extras != nullptr)
+    {
+        compaction& state = extras->compacted;
+        const slot* address = reinterpret_cast<const slot*>(node);
+        node_block* const first = state.blocks.data();
+        node_block* const last = first + state.blocks.size();
+
+        for (node_block* block = first; block != last; ++block)
+        {
+            if (!(std::less_equal<const slot*>()(block->slots, address)
+                  && std::less<const slot*>()(address, block->slots + block->capacity)))
+            {
+                continue;
+            }
+
+            if (state.running && node == state.cursor)
+            {
+                interrupt_compaction();
+            }
+            node->~Node<T>();
+
+            // Joining the threads orders their decrements before reclaim_blocks()
+            if (concurrently)
+            {
+                block->live.fetch_sub(1, std::memory_order_relaxed);
+                return;
+            }
+
+            // Alone with the count, a plain load and store spare the locked
+            // decrement
+            const size_type left = block->live.load(std::memory_order_relaxed) - 1;
+            block->live.store(left, std::memory_order_relaxed);
+            if (left == 0)
+            {
+                free_block(static_cast<size_type>(block - first));
+            }
+            return;
+        }
+    }
+
+    delete node;
+    return;
+}
+
+template <typename T>
+typename LinkedList<T>::size_type LinkedList<T>::block_of(const Node<T>* node) const noexcept
+{
+    if (extras == nullptr) { return 0; }
+
+    const std::vector<node_block>& blocks = extras->compacted.blocks;
+    const slot* address = reinterpret_cast<const slot*>(node);
+
+    size_type i = 0;
+    while (i < blocks.size() && !(std::less_equal<const slot*>()(blocks[i].slots, address)
+                                  && std::less<const slot*>()(address, blocks[i].slots + blocks[i].capacity)))
+    {
+        ++i;
+    }
+    return i;
+}
+
+template <typename T>
+bool LinkedList<T>::in_block(const Node<T>* node) const noexcept
+{
+    return extras != nullptr && block_of(node) < extras->compacted.blocks.size();
+}
+
+template <typename T>
+void LinkedList<T>::interrupt_compaction() noexcept
+{
+    if (extras == nullptr) { return; }
+
+    extras->compacted.running = false;
+    extras->compacted.cursor = nullptr;
+    return;
+}
+
+template <typename T>
+typename LinkedList<T>::node_block& LinkedList<T>::open_block(size_type n)
+{
+    std::vector<node_block>& blocks = side().compacted.blocks;
+
+    // A paused compaction would treat the new block as one of its own
+    interrupt_compaction();
+
+    // The block is registered before any node is built in it, so clear()
+    // frees it if building a node throws
+    blocks.reserve(blocks.size() + 1);
+    node_block block(new slot[n], n);
+    blocks.push_back(block);
+
+    return blocks.back();
+}
+
+template <typename T>
+template <class Source>
+void LinkedList<T>::append(Source source, size_type n)
+{
+    if (n < batch_minimum || (extras != nullptr && extras->compacted.blocks.size() >= block_limit))
+    {
+        for (; n > 0; --n, ++source)
+        {
+            push_back(*source);
+        }
+        return;
+    }
+
+    node_block& target = open_block(n);
+
+    // Every node built is live, the count is set once building stops, also
+    // when a value throws
+    struct count_built
+    {
+        node_block& block;
+        ~count_built() { block.live.store(block.used, std::memory_order_relaxed); }
+    } counted = { target };
+
+    for (; target.used < n; ++source)
+    {
+        void* address = static_cast<void*>(target.slots + target.used);
+        node_pointer node = ::new (address) Node<T>(*source);
+        ++target.used;
+        LIST_STATS_ALLOCATIONS(1);
+
+        if (tail != nullptr) { tail->next(node); }
+        else { head = node; }
+        tail = node;
+    }
+    return;
+}
+
+template <typename T>
+void LinkedList<T>::copy_runs(const LinkedList<T>& origin, size_type n, std::true_type)
+{
+    static_assert(std::is_trivially_copyable<Node<T> >::value, "only a node's bytes are copied");
+    static_assert(sizeof(slot) == sizeof(Node<T>), "a block holds nodes back to back");
+
+    // Copying the bytes begins the lifetime of the nodes in the slots, runs of
+    // the origin's nodes are copied whole and relinked after
+    node_block& target = open_block(n);
+    node_pointer nodes = reinterpret_cast<node_pointer>(target.slots);
+
+    for (const Node<T>* current = origin.head; current != nullptr && target.used < n; )
+    {
+        LIST_PREFETCH(current->next());
+        size_type run = origin.run_length(current, n - target.used);
+        std::memcpy(nodes + target.used, current, run * sizeof(Node<T>));
+        target.used += run;
+        current = current[run - 1].next();
+    }
+    target.live.store(n, std::memory_order_relaxed);
+    LIST_STATS_ALLOCATIONS(n);
+
+    for (size_type i = 1; i < n; ++i)
+    {
+        nodes[i - 1].next(nodes + i);
+    }
+    nodes[n - 1].next(nullptr);
+
+    head = nodes;
+    tail = nodes + (n - 1);
+    return;
+}
+
+template <typename T>
+void LinkedList<T>::copy_runs(const LinkedList<T>& origin, size_type n, std::false_type)
+{
+    append(origin.cbegin(), n);
+    return;
+}
+
+template <typename T>
+typename LinkedList<T>::size_type
+LinkedList<T>::run_length(const Node<T>* node, size_type limit) const noexcept
+{
+    // Only the slots of one block form an array the run may step through.
+    // The block is searched here rather than through block_of(), which then
+    // stays small enough to inline into the loop of clear().
+    const node_block* block = nullptr;
+    if (extras != nullptr)
+    {
+        const slot* address = reinterpret_cast<const slot*>(node);
+        for (const node_block& candidate : extras->compacted.blocks)
+        {
+            if (std::less_equal<const slot*>()(candidate.slots, address)
+                && std::less<const slot*>()(address, candidate.slots + candidate.capacity))
+            {
+                block = &candidate;
+                limit = std::min(limit, block->capacity - static_cast<size_type>(address - block->slots));
+                break;
+            }
+        }
+    }
+    if (block == nullptr) { return 1; }
+
+    size_type length = 1;
+    while (length < limit && node[length - 1].next() == node + length)
+    {
+        ++length;
+    }
+    return length;
+}
+
+template <typename T>
+template <typename InputIterator>
+void LinkedList<T>::append_range(InputIterator first, InputIterator last, std::input_iterator_tag)
+{
+    // The length is unknown until the input ends
+    for (; first != last; ++first)
+    {
+        push_back(*first);
+    }
+    return;
+}
+
+template <typename T>
+template <typename ForwardIterator>
+void LinkedList<T>::append_range(ForwardIterator first, ForwardIterator last, 
+                                 std::forward_iterator_tag)
+{
+    append(first, static_cast<size_type>(std::distance(first, last)));
+    return;
+}
+
+template <typename T>
+void LinkedList<T>::free_blocks(size_type n) noexcept
+{
+    compaction& state = extras->compacted;
+    for (size_type i = 0; i < n; ++i)
+    {
+        delete[] state.blocks[i].slots;
+    }
+
+    state.blocks.erase(state.blocks.begin(), state.blocks.begin() + n);
+    state.pass_begin -= (n < state.pass_begin) ? n : state.pass_begin;
+    return;
+}
+
+template <typename T>
+void LinkedList<T>::free_block(size_type i) noexcept
+{
+    compaction& state = extras->compacted;
+
+    delete[] state.blocks[i].slots;
+    state.blocks.erase(state.blocks.begin() + i);
+    if (i < state.pass_begin)
+    {
+        --state.pass_begin;
+    }
+
+    // The vector holding no block gives its buffer back as well
+    if (state.blocks.empty())
+    {
+        std::vector<node_block>().swap(state.blocks);
+    }
+    return;
+}
+
+template <typename T>
+void LinkedList<T>::reclaim_blocks() noexcept
+{
+    if (extras == nullptr) { return; }
+
+    for (size_type i = extras->compacted.blocks.size(); i > 0; --i)
+    {
+        if (extras->compacted.blocks[i - 1].live.load(std::memory_order_relaxed) == 0)
+        {
+            free_block(i - 1);
+        }
+    }
+    return;
+}
+
+template <typename T>
+typename LinkedList<T>::node_pointer LinkedList<T>::seek(size_type i, bool record) const
+{
+    node_pointer current = head;
+    size_type position = 0;
+
+    // Position of the last skip at or before i, new skips go after it
+    size_type anchor = 0;
+    size_type after = 0;
+
+    if (extras != nullptr)
+    {
+        const position_index& index = extras->indexed;
+
+        after = std::upper_bound(index.skips.begin(), index.skips.end(), i,
+                [](size_type value, const skip& entry) { return value < entry.position; })
+              - index.skips.begin();
+        if (after > 0)
+        {
+            current = index.skips[after - 1].node;
+            position = anchor = index.skips[after - 1].position;
+        }
+
+        if (index.finger != nullptr && position < index.finger_position && index.finger_position <= i)
+        {
+            current = index.finger;
+            position = index.finger_position;
+        }
+    }
+
+    LIST_STATS_COUNTER(walked);
+    while (current != nullptr && position < i)
+    {
+        current = current->next();
+        ++position;
+        LIST_STATS_STEP(walked);
+
+        if (record && current != nullptr && position - anchor >= skip_stride)
+        {
+            skip entry = { position, current };
+            extras->indexed.skips.insert(extras->indexed.skips.begin() + after++, entry);
+            anchor = position;
+        }
+    }
+    LIST_STATS_NODES(at, walked);
+
+    if (record && current != nullptr)
+    {
+        extras->indexed.finger = current;
+        extras->indexed.finger_position = i;
+    }
+    return current;
+}
+
+template <typename T>
+void LinkedList<T>::shift_positions(size_type position, bool inserted) noexcept
+{
+    if (extras == nullptr) { return; }
+
+    position_index& index = extras->indexed;
+    std::vector<skip>& skips = index.skips;
+    if (position == 0)
+    {
+        // Every skip would move, the next walks record them again
+        skips.clear();
+    }
+    else
+    {
+        typename std::vector<skip>::iterator it = std::lower_bound(skips.begin(), skips.end(), 
+                position, [](const skip& entry, size_type value) { return entry.position < value; });
+
+        if (!inserted && it != skips.end() && it->position == position)
+        {
+            it = skips.erase(it);
+        }
+        for (; it != skips.end(); ++it)
+        {
+            if (inserted) { ++it->position; }
+            else { --it->position; }
+        }
+    }
+
+    if (index.finger == nullptr || index.finger_position < position) { return; }
+
+    if (inserted)
+    {
+        ++index.finger_position;
+    }
+    else if (index.finger_position == position)
+    {
+        index.finger = nullptr;
+    }
+    else
+    {
+        --index.finger_position;
+    }
+    return;
+}
+
+template <typename T>
+void LinkedList<T>::forget_tail() noexcept
+{
+    if (extras == nullptr) { return; }
+
+    position_index& index = extras->indexed;
+    if (index.finger == tail)
+    {
+        index.finger = nullptr;
+    }
+    if (!index.skips.empty() && index.skips.back().node == tail)
+    {
+        index.skips.pop_back();
+    }
+    return;
+}
+
+template <typename T>
+void LinkedList<T>::forget_positions() noexcept
+{
+    if (extras == nullptr) { return; }
+
+    position_index& index = extras->indexed;
+    index.finger = nullptr;
+    index.skips.clear();
+    return;
+}
 
 #endif // LINKED_LIST_TPP
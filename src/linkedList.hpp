@@ -15,15 +15,28 @@ https://github.com/AlexanderJDupree/LinkedListsCPP
 #ifndef LINKED_LIST_H
 #define LINKED_LIST_H
 
+#include <functional>
 #include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <stdexcept>
 #include <type_traits>
 #include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <unordered_set>
+#include <vector>
 #include "node.hpp"
+#include "nodeChain.hpp"
 #include "iterator.hpp"
+#include "execution.hpp"
+#include "listStats.hpp"
+#include "memoryFootprint.hpp"
+#include "prefetch.hpp"
 
 template<typename T>
-class LinkedList : public forward_iterator<T>
+class LinkedList
 {
 public:
 
@@ -40,6 +53,11 @@ public:
 
     /* Constructors */
 
+    // The fill, copy and initializer list constructors, and the range
+    // constructor over forward iterators, know the length up front and build
+    // the nodes in one block, like compact() does. Lists of fewer than
+    // batch_minimum elements allocate their nodes one by one.
+
     // Default
     LinkedList();
 
@@ -69,6 +87,16 @@ public:
     const_iterator end() const;
     iterator end();
 
+    /* Element Access */
+
+    // The element at position i, throws std::out_of_range past the end. The
+    // walk starts from the closest of the head, the position accessed last
+    // and a node recorded every skip_stride positions, so sequential or
+    // nearby accesses cost the distance moved. The const overload uses what
+    // earlier accesses recorded but records nothing itself.
+    reference at(size_type i);
+    const_reference at(size_type i) const;
+
     /* Modifiers */
     void push_front(const_reference data);
     void push_back(const_reference data);
@@ -80,21 +108,72 @@ public:
     
     void insert(const_iterator& position, const_reference data);
     void insert(const_iterator position, size_type n, const_reference data);
-    template <typename InputIterator>
+    template <typename InputIterator, typename ::std::enable_if< ::std::is_constructible
+             < T, decltype(*::std::declval<InputIterator>()) >::value >::type* = nullptr >
     void insert(const_iterator position, InputIterator begin, InputIterator end);
 
     iterator erase(iterator& position);
     iterator erase(iterator& first, iterator& last);
+
+    // Inserts data at position i, 0 <= i <= size(), and returns an iterator
+    // to it. Throws std::out_of_range past the end.
+    iterator insert_at(size_type i, const_reference data);
+
+    // Erases the element at position i and returns an iterator to the one
+    // that followed it. Throws std::out_of_range past the end.
+    iterator erase_at(size_type i);
     
     void clear();
 
+    // Replaces the contents, built in one block like the constructors. The
+    // list is unchanged if building the new contents throws.
+    template <typename InputIterator, typename ::std::enable_if< ::std::is_constructible
+             < T, decltype(*::std::declval<InputIterator>()) >::value >::type* = nullptr >
+    void assign(InputIterator first, InputIterator last);
+    void assign(size_type n, const_reference value);
+
+    // Erases the elements past the first n, or appends copies of value until
+    // there are n, the appended nodes in one block
+    void resize(size_type n);
+    void resize(size_type n, const_reference value);
+
     /* Capacity */
     bool empty() const;
     size_type size() const;
 
+    // Bytes held by the list: the list object, a heap block per node with the
+    // allocator's overhead or the compaction blocks holding them, and the
+    // memory the values own. Walks the list.
+    size_type memory_usage() const;
+
+    /* Compaction */
+
+    // Moves every node, with its value, into one block in list order, so a
+    // walk reads memory sequentially again after churn has scattered the
+    // nodes. Iterators, pointers and references to the elements are
+    // invalidated. Nodes inserted later are allocated one by one as before,
+    // and the slot of an erased node is given back with its block once the
+    // block's last node is erased or moved out.
+    void compact();
+
+    // The same in bounded steps: moves at most steps nodes, continuing where
+    // the previous call stopped, and returns true once the whole list has
+    // been moved. Inserting between steps is fine, erasing the node moved
+    // last, sorting or reversing the list starts the next step over from the
+    // front.
+    bool compact(size_type steps);
+
     /* Operations */
     void reverse() noexcept;
 
+    // Reverses the elements from first up to, not including, last. Walks to
+    // first, iterators keep pointing to the same elements.
+    void reverse(const_iterator first, const_iterator last) noexcept;
+
+    // Makes middle the first element and the elements before it the last,
+    // returns an iterator to the element that was first. Walks to middle.
+    iterator rotate(const_iterator middle) noexcept;
+
     void remove(const_reference target);
     template <class Predicate>
     void remove_if(Predicate pred);
@@ -103,12 +182,63 @@ public:
     template <class Predicate>
     iterator find_if(Predicate pred);
     
+    // Keeps the first occurrence of every value, T must be hashable. The
+    // overload with hash and equal works for any T they can handle.
     void unique();
+    template <class Hash, class Equal>
+    void unique(Hash hash, Equal equal);
+
+    // Erases every element for which pred(kept, element) holds, kept being
+    // the last element not erased, like std::unique
+    void unique_adjacent();
+    template <class BinaryPredicate>
+    void unique_adjacent(BinaryPredicate pred);
+
+    // The list must be sorted ascending, only operator< is used
+    void unique_sorted();
 
     template <class Comparator>
     void sort(Comparator compare);
     void sort();
 
+    /* Parallel Operations */
+    template <class Function>
+    void for_each(const execution::parallel_policy& policy, Function f);
+
+    // In place, every element is replaced by op(element)
+    template <class UnaryOperation>
+    void transform(const execution::parallel_policy& policy, UnaryOperation op);
+
+    // op must be associative, partial results are combined in list order
+    template <typename U, class BinaryOperation>
+    U reduce(const execution::parallel_policy& policy, U init, BinaryOperation op) const;
+    template <typename U, class BinaryOperation, class UnaryOperation>
+    U transform_reduce(const execution::parallel_policy& policy, U init,
+                       BinaryOperation combine, UnaryOperation convert) const;
+
+    template <class Predicate>
+    size_type count_if(const execution::parallel_policy& policy, Predicate pred) const;
+    template <class Predicate>
+    bool any_of(const execution::parallel_policy& policy, Predicate pred) const;
+    template <class Predicate>
+    bool all_of(const execution::parallel_policy& policy, Predicate pred) const;
+
+    // Always returns the first match by position, later segments are cancelled
+    iterator find(const execution::parallel_policy& policy, const_reference target);
+    template <class Predicate>
+    iterator find_if(const execution::parallel_policy& policy, Predicate pred);
+
+    void remove(const execution::parallel_policy& policy, const_reference target);
+    template <class Predicate>
+    void remove_if(const execution::parallel_policy& policy, Predicate pred);
+
+    // Keeps the first occurrence of every value, T must be hashable
+    void unique(const execution::parallel_policy& policy);
+
+    template <class Comparator>
+    void sort(const execution::parallel_policy& policy, Comparator compare);
+    void sort(const execution::parallel_policy& policy);
+
     /* Operator Overloads */
     inline bool operator==(const LinkedList<value_type>& rhs) const;
     inline bool operator!=(const LinkedList<value_type>& rhs) const;
@@ -121,19 +251,174 @@ public:
 
 private:
 
+    typedef typename std::aligned_storage<sizeof(Node<T>), alignof(Node<T>)>::type slot;
+
+    // Slots that compact() and the bulk constructors build nodes in, used in
+    // order. live counts the nodes built and not destroyed yet, the block is
+    // freed when it drops to zero. It is atomic because the workers of the
+    // parallel remove_if and unique destroy nodes of the same block.
+    struct node_block
+    {
+        node_block(slot* slots, size_type capacity) noexcept
+            : slots(slots), capacity(capacity), used(0), live(0) {}
+
+        node_block(const node_block& origin) noexcept
+            : slots(origin.slots), capacity(origin.capacity), used(origin.used),
+              live(origin.live.load(std::memory_order_relaxed)) {}
+
+        node_block& operator=(const node_block& origin) noexcept
+        {
+            slots = origin.slots;
+            capacity = origin.capacity;
+            used = origin.used;
+            live.store(origin.live.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            return *this;
+        }
+
+        slot* slots;
+        size_type capacity;
+        size_type used;
+        std::atomic<size_type> live;
+    };
+
+    // The blocks of compact() and the bulk constructors
+    struct compaction
+    {
+        // Oldest first, the blocks from pass_begin on belong to the running pass
+        std::vector<node_block> blocks;
+        size_type pass_begin;
+
+        // The node the running pass moved last, null before its first step
+        node_pointer cursor;
+        bool running;
+    };
+
+    struct skip
+    {
+        size_type position;
+        node_pointer node;
+    };
+
+    // Recorded by at(), insert_at() and erase_at(). Inserting or erasing
+    // renumbers the skips after the change, modifiers that relink or move
+    // nodes drop everything.
+    struct position_index
+    {
+        // The position accessed last and its node, null when unknown
+        size_type finger_position;
+        node_pointer finger;
+
+        // In position order, recorded by positional walks whenever they get
+        // skip_stride nodes past the last skip. The head needs none.
+        std::vector<skip> skips;
+    };
+
+    static const size_type skip_stride = 32;
+
+    // Created by the first compact(), block of nodes built in bulk or
+    // positional access of a non empty list, other lists only pay the
+    // pointer to it
+    struct side_state
+    {
+        compaction compacted;
+        position_index indexed;
+    };
+
     node_pointer head;
     node_pointer tail;
+    side_state* extras;
 
     /* Helper functions */
-    void reverse_links(node_pointer current, node_pointer previous) noexcept;
 
-    template <class Comparator>
-    void merge_sort(node_pointer& begin, Comparator compare);
+    // Creates the side state on first use
+    side_state& side();
+
+    // Reverses the nodes from first up to last, first then links to last.
+    // Returns the node that starts the reversed run.
+    node_pointer reverse_links(node_pointer first, node_pointer last) noexcept;
+
+    std::vector<node_pointer> segments(const execution::parallel_policy& policy) const;
+
+    // Links the nodes from first up to last that discard rejects, frees the
+    // others, concurrently like release()
+    template <class Predicate>
+    void filter(node_pointer first, node_pointer last, Predicate discard,
+                node_pointer& kept_first, node_pointer& kept_last, bool concurrently = false);
+
+    void stitch(const std::vector<node_pointer>& firsts, const std::vector<node_pointer>& lasts);
+
+    // Destroys a node and frees it. A node in a compaction block is destroyed
+    // in place and the block freed with its last node. Threads releasing
+    // nodes concurrently leave the emptied blocks to reclaim_blocks().
+    void release(node_pointer node, bool concurrently = false) noexcept;
+
+    // The index of the block holding node, the number of blocks if none does
+    size_type block_of(const Node<T>* node) const noexcept;
+    bool in_block(const Node<T>* node) const noexcept;
+
+    // Stops a running compaction pass, the next step starts a new one
+    void interrupt_compaction() noexcept;
+
+    // Frees the first n compaction blocks, their nodes have all been moved
+    // out or destroyed
+    void free_blocks(size_type n) noexcept;
+
+    // Frees block i, or every block without live nodes
+    void free_block(size_type i) noexcept;
+    void reclaim_blocks() noexcept;
+
+    // A block, its bookkeeping and the vector holding it cost about as much
+    // as the allocator's overhead on ten nodes, so shorter lists would take
+    // more memory from a block. Past block_limit blocks, which release()
+    // searches, nodes are allocated one by one again.
+    static const size_type batch_minimum = 12;
+    static const size_type block_limit = 16;
+
+    // Yields the same value forever, a source for append()
+    struct repeat
+    {
+        const T* value;
+
+        const T& operator*() const { return *value; }
+        repeat& operator++() { return *this; }
+    };
+
+    // Adds an empty block of n slots
+    node_block& open_block(size_type n);
+
+    // Appends n nodes built from the values source yields
+    template <class Source>
+    void append(Source source, size_type n);
+
+    // Copies the n nodes of origin into one block. A trivially copyable Node
+    // is its bytes and is copied in runs, other nodes one value at a time.
+    void copy_runs(const LinkedList<T>& origin, size_type n, std::true_type);
+    void copy_runs(const LinkedList<T>& origin, size_type n, std::false_type);
+
+    // The nodes from node on that follow each other in one block as they do
+    // in the list, at least 1 and at most limit. A node outside the blocks is
+    // a run of its own.
+    size_type run_length(const Node<T>* node, size_type limit) const noexcept;
+
+    // The longest run operator== compares before loading the next link
+    static const size_type run_chunk = 64;
+
+    template <typename InputIterator>
+    void append_range(InputIterator first, InputIterator last, std::input_iterator_tag);
+    template <typename ForwardIterator>
+    void append_range(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag);
+
+    // The node at position i or nullptr past the end. With record set the
+    // walk adds skips and moves the finger, extras must exist.
+    node_pointer seek(size_type i, bool record) const;
+
+    // An element was inserted at or erased from position
+    void shift_positions(size_type position, bool inserted) noexcept;
 
-    void split(node_pointer& left, node_pointer& right);
+    // The tail is about to be erased
+    void forget_tail() noexcept;
 
-    template <class Comparator> 
-    node_pointer merge(node_pointer left, node_pointer right, Comparator compare);
+    void forget_positions() noexcept;
 
 };
 
@@ -0,0 +1,210 @@
+/*
+
+File: listStats.hpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+/*
+Operation counters for LinkedList, compiled in only when LINKED_LIST_STATS is
+defined before the list is included:
+
+    #define LINKED_LIST_STATS
+    #include "linkedList.hpp"
+
+For every operation the counters record how often it was called and how
+many nodes it walked. A walk shared between operations counts under the one
+that does it, so the nodes unique() filters show up under remove. Node
+allocations and frees are counted, and max_length is the longest list a
+whole-list walk has seen.
+
+The counters are shared by every list in the process and are updated with
+relaxed atomics. Without LINKED_LIST_STATS the hooks expand to nothing and
+read() returns zeros. Define the macro the same way in every translation
+unit, or the list templates differ between them.
+
+    list_stats::write_json(std::cout);
+    list_stats::report([](const char* name, size_t value) { metrics.gauge(name, value); });
+*/
+
+#ifndef LIST_STATS_H
+#define LIST_STATS_H
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <string>
+
+namespace list_stats
+{
+
+enum class operation
+{
+    construct, copy, destroy, assign, push_front, push_back, pop_front, pop_back,
+    insert, erase, clear, size, equal, find, remove, unique, reverse, sort, parallel,
+    compact, at, rotate, resize, count
+};
+
+const size_t operation_count = static_cast<size_t>(operation::count);
+
+inline const char* name(operation op)
+{
+    static const char* names[operation_count] = {
+        "construct", "copy", "destroy", "assign", "push_front", "push_back", "pop_front",
+        "pop_back", "insert", "erase", "clear", "size", "equal", "find", "remove", "unique",
+        "reverse", "sort", "parallel", "compact", "at", "rotate", "resize"
+    };
+    return names[static_cast<size_t>(op)];
+}
+
+constexpr bool enabled()
+{
+#if defined(LINKED_LIST_STATS)
+    return true;
+#else
+    return false;
+#endif
+}
+
+struct snapshot
+{
+    size_t calls[operation_count];
+    size_t nodes[operation_count];
+    size_t allocations;
+    size_t frees;
+    size_t max_length;
+};
+
+// Static storage, so every counter starts at zero
+struct counters
+{
+    std::atomic<size_t> calls[operation_count];
+    std::atomic<size_t> nodes[operation_count];
+    std::atomic<size_t> allocations;
+    std::atomic<size_t> frees;
+    std::atomic<size_t> max_length;
+};
+
+inline counters& global()
+{
+    static counters totals;
+    return totals;
+}
+
+inline void record_call(operation op)
+{
+    global().calls[static_cast<size_t>(op)].fetch_add(1, std::memory_order_relaxed);
+}
+
+inline void record_nodes(operation op, size_t nodes)
+{
+    global().nodes[static_cast<size_t>(op)].fetch_add(nodes, std::memory_order_relaxed);
+}
+
+inline void record_allocations(size_t count)
+{
+    global().allocations.fetch_add(count, std::memory_order_relaxed);
+}
+
+inline void record_frees(size_t count)
+{
+    global().frees.fetch_add(count, std::memory_order_relaxed);
+}
+
+inline void record_length(size_t length)
+{
+    std::atomic<size_t>& longest = global().max_length;
+    size_t seen = longest.load(std::memory_order_relaxed);
+    while (length > seen && !longest.compare_exchange_weak(seen, length, std::memory_order_relaxed)) {}
+}
+
+// Counters at this moment. Taken without a lock, so a snapshot made while
+// lists are in use may mix counts from slightly different moments.
+inline snapshot read()
+{
+    counters& totals = global();
+    snapshot current;
+    for (size_t i = 0; i < operation_count; ++i)
+    {
+        current.calls[i] = totals.calls[i].load(std::memory_order_relaxed);
+        current.nodes[i] = totals.nodes[i].load(std::memory_order_relaxed);
+    }
+    current.allocations = totals.allocations.load(std::memory_order_relaxed);
+    current.frees = totals.frees.load(std::memory_order_relaxed);
+    current.max_length = totals.max_length.load(std::memory_order_relaxed);
+    return current;
+}
+
+inline void reset()
+{
+    counters& totals = global();
+    for (size_t i = 0; i < operation_count; ++i)
+    {
+        totals.calls[i].store(0, std::memory_order_relaxed);
+        totals.nodes[i].store(0, std::memory_order_relaxed);
+    }
+    totals.allocations.store(0, std::memory_order_relaxed);
+    totals.frees.store(0, std::memory_order_relaxed);
+    totals.max_length.store(0, std::memory_order_relaxed);
+}
+
+// Hands every counter to the callback by name, "<operation>.calls",
+// "<operation>.nodes", "allocations", "frees" and "max_length"
+inline void report(const std::function<void(const char* name, size_t value)>& callback)
+{
+    snapshot current = read();
+    for (size_t i = 0; i < operation_count; ++i)
+    {
+        std::string prefix = name(static_cast<operation>(i));
+        callback((prefix + ".calls").c_str(), current.calls[i]);
+        callback((prefix + ".nodes").c_str(), current.nodes[i]);
+    }
+    callback("allocations", current.allocations);
+    callback("frees", current.frees);
+    callback("max_length", current.max_length);
+}
+
+inline void write_json(std::ostream& out)
+{
+    snapshot current = read();
+    out << "{\"enabled\": " << (enabled() ? "true" : "false") << ", \"operations\": {";
+    for (size_t i = 0; i < operation_count; ++i)
+    {
+        out << (i == 0 ? "" : ", ") << '"' << name(static_cast<operation>(i))
+            << "\": {\"calls\": " << current.calls[i] << ", \"nodes\": " << current.nodes[i] << '}';
+    }
+    out << "}, \"allocations\": " << current.allocations << ", \"frees\": " << current.frees
+        << ", \"max_length\": " << current.max_length << "}\n";
+}
+
+} // namespace list_stats
+
+// Hooks used inside LinkedList. LIST_STATS_COUNTER declares a local counter
+// for walks that do not count their nodes already.
+#if defined(LINKED_LIST_STATS)
+#define LIST_STATS_CALL(op) ::list_stats::record_call(::list_stats::operation::op)
+#define LIST_STATS_NODES(op, n) ::list_stats::record_nodes(::list_stats::operation::op, (n))
+#define LIST_STATS_ALLOCATIONS(n) ::list_stats::record_allocations(n)
+#define LIST_STATS_FREES(n) ::list_stats::record_frees(n)
+#define LIST_STATS_LENGTH(n) ::list_stats::record_length(n)
+#define LIST_STATS_COUNTER(counter) size_t counter = 0
+#define LIST_STATS_STEP(counter) ++(counter)
+#else
+#define LIST_STATS_CALL(op) ((void)0)
+#define LIST_STATS_NODES(op, n) ((void)0)
+#define LIST_STATS_ALLOCATIONS(n) ((void)0)
+#define LIST_STATS_FREES(n) ((void)0)
+#define LIST_STATS_LENGTH(n) ((void)0)
+#define LIST_STATS_COUNTER(counter) ((void)0)
+#define LIST_STATS_STEP(counter) ((void)0)
+#endif
+
+#endif // LIST_STATS_H
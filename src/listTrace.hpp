@@ -0,0 +1,319 @@
+/*
+
+File: listTrace.hpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+/*
+Records the operations done on a list into a binary trace, so a real
+workload can be replayed later against other containers by
+benchmarks/traceReplay.cpp.
+
+RecordingList wraps a LinkedList and writes a record for every operation
+made through it. Recording is opt-in: code that should be traced uses a
+RecordingList in place of its LinkedList.
+
+    std::ofstream file("service.trace", std::ios::binary);
+    list_trace::Writer trace(file);
+    RecordingList<std::string> list(trace);
+
+A record holds the operation, a position and the size of the value. The
+position is the index of the element inserted or erased, and for find the
+number of elements looked at. Positions are counted from the front of the
+list, so an insert or erase through RecordingList walks to its iterator once
+more to find the index. The value size is sizeof(T), or the length of a
+std::string.
+
+The file starts with the magic bytes "LLTRACE" and a version byte, followed
+by the records. Each record is the operation byte and then the position and
+the value size as unsigned LEB128 varints, two to four bytes for most
+records. A Writer is not thread safe, give each thread its own trace.
+*/
+
+#ifndef LIST_TRACE_H
+#define LIST_TRACE_H
+
+#include <cstdint>
+#include <istream>
+#include <iterator>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "linkedList.hpp"
+
+namespace list_trace
+{
+
+enum class operation : std::uint8_t
+{
+    push_front, push_back, pop_front, pop_back, insert, erase, find, clear, sort, reverse,
+    unique, size,
+    count
+};
+
+const size_t operation_count = static_cast<size_t>(operation::count);
+
+inline const char* name(operation op)
+{
+    static const char* names[operation_count] = {
+        "push_front", "push_back", "pop_front", "pop_back", "insert", "erase", "find", "clear",
+        "sort", "reverse", "unique", "size"
+    };
+    return names[static_cast<size_t>(op)];
+}
+
+struct record
+{
+    operation op;
+    std::uint64_t position;
+    std::uint64_t value_size;
+};
+
+const char magic[] = "LLTRACE";
+const std::uint8_t version = 1;
+
+template <typename T>
+std::uint64_t value_size(const T&) { return sizeof(T); }
+
+inline std::uint64_t value_size(const std::string& value) { return value.size(); }
+
+class Writer
+{
+public:
+
+    explicit Writer(std::ostream& out) : out(out), written(0)
+    {
+        out.write(magic, sizeof(magic) - 1);
+        out.put(static_cast<char>(version));
+    }
+
+    void write(const record& entry)
+    {
+        out.put(static_cast<char>(entry.op));
+        put_varint(entry.position);
+        put_varint(entry.value_size);
+        ++written;
+    }
+
+    void write(operation op, std::uint64_t position = 0, std::uint64_t value_size = 0)
+    {
+        record entry = { op, position, value_size };
+        write(entry);
+    }
+
+    size_t records() const { return written; }
+
+private:
+
+    void put_varint(std::uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            out.put(static_cast<char>((value & 0x7f) | 0x80));
+            value >>= 7;
+        }
+        out.put(static_cast<char>(value));
+    }
+
+    std::ostream& out;
+    size_t written;
+};
+
+// Reads records back in order. valid() is false when the stream does not
+// start with a trace header, and next() returns false at the end of the
+// trace or at the first malformed record.
+class Reader
+{
+public:
+
+    explicit Reader(std::istream& in) : in(in), good(true)
+    {
+        char header[sizeof(magic)] = {};
+        in.read(header, sizeof(header));
+        good = in.gcount() == static_cast<std::streamsize>(sizeof(header))
+            && std::string(header, sizeof(magic) - 1) == magic
+            && static_cast<std::uint8_t>(header[sizeof(magic) - 1]) == version;
+    }
+
+    bool valid() const { return good; }
+
+    bool next(record& entry)
+    {
+        int op = good ? in.get() : std::istream::traits_type::eof();
+        if (op == std::istream::traits_type::eof() || op >= static_cast<int>(operation_count))
+        {
+            return false;
+        }
+
+        entry.op = static_cast<operation>(op);
+        return get_varint(entry.position) && get_varint(entry.value_size);
+    }
+
+private:
+
+    bool get_varint(std::uint64_t& value)
+    {
+        value = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7)
+        {
+            int byte = in.get();
+            if (byte == std::istream::traits_type::eof()) { return false; }
+
+            value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0) { return true; }
+        }
+        return false;
+    }
+
+    std::istream& in;
+    bool good;
+};
+
+inline std::vector<record> read_all(std::istream& in)
+{
+    std::vector<record> records;
+    Reader reader(in);
+    record entry;
+    while (reader.next(entry))
+    {
+        records.push_back(entry);
+    }
+    return records;
+}
+
+} // namespace list_trace
+
+/*****
+RECORDING LIST
+*****/
+
+// A LinkedList that writes every operation made through it to a trace. The
+// list itself is reachable through list() for anything not recorded, such
+// as iteration.
+template <typename T>
+class RecordingList
+{
+public:
+
+    typedef LinkedList<T> list_type;
+    typedef typename list_type::size_type size_type;
+    typedef typename list_type::value_type value_type;
+    typedef typename list_type::reference reference;
+    typedef typename list_type::const_reference const_reference;
+    typedef typename list_type::iterator iterator;
+    typedef typename list_type::const_iterator const_iterator;
+
+    explicit RecordingList(list_trace::Writer& trace) : trace(trace) {}
+
+    list_type& list() { return items; }
+    const list_type& list() const { return items; }
+
+    iterator begin() { return items.begin(); }
+    iterator end() { return items.end(); }
+    const_iterator begin() const { return items.begin(); }
+    const_iterator end() const { return items.end(); }
+
+    bool empty() const { return items.empty(); }
+
+    size_type size() const
+    {
+        trace.write(list_trace::operation::size);
+        return items.size();
+    }
+
+    void push_front(const_reference data)
+    {
+        trace.write(list_trace::operation::push_front, 0, list_trace::value_size(data));
+        items.push_front(data);
+    }
+
+    void push_back(const_reference data)
+    {
+        trace.write(list_trace::operation::push_back, 0, list_trace::value_size(data));
+        items.push_back(data);
+    }
+
+    void pop_front()
+    {
+        trace.write(list_trace::operation::pop_front);
+        items.pop_front();
+    }
+
+    void pop_back()
+    {
+        trace.write(list_trace::operation::pop_back);
+        items.pop_back();
+    }
+
+    // Inserts after position, as LinkedList::insert does
+    void insert(const_iterator& position, const_reference data)
+    {
+        std::uint64_t index = items.empty() ? 0 : index_of(position) + 1;
+        trace.write(list_trace::operation::insert, index, list_trace::value_size(data));
+        items.insert(position, data);
+    }
+
+    iterator erase(iterator& position)
+    {
+        trace.write(list_trace::operation::erase, index_of(position));
+        return items.erase(position);
+    }
+
+    void clear()
+    {
+        trace.write(list_trace::operation::clear);
+        items.clear();
+    }
+
+    iterator find(const_reference target)
+    {
+        return find_if([&target](const_reference data) { return data == target; });
+    }
+
+    template <class Predicate>
+    iterator find_if(Predicate pred)
+    {
+        std::uint64_t looked = 0;
+        iterator found = items.find_if([&](const_reference data) { ++looked; return pred(data); });
+        trace.write(list_trace::operation::find, looked);
+        return found;
+    }
+
+    void sort()
+    {
+        trace.write(list_trace::operation::sort);
+        items.sort();
+    }
+
+    void reverse()
+    {
+        trace.write(list_trace::operation::reverse);
+        items.reverse();
+    }
+
+    void unique()
+    {
+        trace.write(list_trace::operation::unique);
+        items.unique();
+    }
+
+private:
+
+    std::uint64_t index_of(const_iterator position)
+    {
+        return static_cast<std::uint64_t>(std::distance(const_iterator(items.begin()), position));
+    }
+
+    list_trace::Writer& trace;
+    list_type items;
+};
+
+#endif // LIST_TRACE_H
@@ -0,0 +1,79 @@
+/*
+
+File: memoryFootprint.hpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+/*
+Helpers behind the memory_usage() of the lists.
+
+allocated_size() is what the allocator takes for a request, including its
+header and rounding. It follows glibc malloc on 64 bit systems, which
+prefixes each block with a size word and rounds blocks to 16 bytes with a
+minimum of 32. Other allocators differ by a few bytes per block, so treat
+the result as an estimate there.
+
+owned_bytes() is the heap memory a value owns beyond its own object, the
+buffer of a long std::string for example. It is zero for any other type.
+Types that own memory can report it with an overload found by argument
+dependent lookup:
+
+    namespace service
+    {
+        size_t owned_bytes(const Record& record) { return footprint::allocated_size(record.size); }
+    }
+*/
+
+#ifndef MEMORY_FOOTPRINT_H
+#define MEMORY_FOOTPRINT_H
+
+#include <cstddef>
+#include <functional>
+#include <string>
+
+namespace footprint
+{
+
+inline size_t allocated_size(size_t requested)
+{
+    const size_t word = sizeof(size_t);
+    const size_t alignment = 2 * word;
+    const size_t minimum = 4 * word;
+
+    size_t block = (requested + word + alignment - 1) / alignment * alignment;
+    return (block < minimum) ? minimum : block;
+}
+
+template <typename T>
+size_t owned_bytes(const T&) { return 0; }
+
+// Short strings are stored inside the string object and own nothing
+template <typename Char, typename Traits, typename Allocator>
+size_t owned_bytes(const std::basic_string<Char, Traits, Allocator>& value)
+{
+    const char* object = reinterpret_cast<const char*>(&value);
+    const char* data = reinterpret_cast<const char*>(value.data());
+    std::less<const char*> before;
+
+    if (!before(data, object) && before(data, object + sizeof(value))) { return 0; }
+    return allocated_size((value.capacity() + 1) * sizeof(Char));
+}
+
+// The owned bytes of a value, with the user's overloads taken into account
+template <typename T>
+size_t value_bytes(const T& value)
+{
+    return owned_bytes(value);
+}
+
+} // namespace footprint
+
+#endif // MEMORY_FOOTPRINT_H
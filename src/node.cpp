@@ -17,29 +17,23 @@ https://github.com/AlexanderJDupree/LinkedListsCPP
 #ifndef NODE_TPP
 #define NODE_TPP
 
+#include <utility>
 #include "node.hpp"
 
 template <typename T>
-Node<T>::Node() : _data(new T()), _next(nullptr) {}
+Node<T>::Node() : _data(), _next(nullptr) {}
 
 template <typename T>
-Node<T>::Node(const Node& origin)
-    : _data(new T(*origin._data)), _next(origin._next) {}
+Node<T>::Node(const T& value) : _data(value), _next (nullptr) {}
 
 template <typename T>
-Node<T>::Node(const T& value) : _data(new T(value)), _next (nullptr) {}
-
-template <typename T>
-Node<T>::~Node()
-{
-    delete _data;
-}
+Node<T>::Node(T&& value) : _data(std::move(value)), _next (nullptr) {}
 
 // Inspectors
 template <typename T>
 T* Node<T>::data() const
 {
-    return _data;
+    return &_data;
 }
 
 template <typename T>
@@ -52,8 +46,7 @@ Node<T>* Node<T>::next() const
 template <typename T>
 Node<T>* Node<T>::data(const T& value)
 {
-    delete _data;
-    this->_data = new T(value);
+    _data = value;
     return this;
 }
 
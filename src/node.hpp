@@ -25,14 +25,15 @@ public:
     // Default
     Node();
 
-    // Copy
-    Node(const Node& origin);
+    // Copy, trivial for a trivially copyable T so the node is too
+    Node(const Node& origin) = default;
 
     // Value
     explicit Node(const T& value);
+    explicit Node(T&& value);
 
     // Destructor
-    ~Node();
+    ~Node() = default;
 
     /* Inspectors */
     T* data() const;
@@ -45,7 +46,9 @@ public:
 
 private:
 
-    T* _data;
+    // Held inline so a node is a single allocation, mutable because data()
+    // hands out a modifiable pointer from a const node
+    mutable T _data;
     Node* _next;
 };
 
@@ -0,0 +1,262 @@
+/*
+
+File: nodeChain.hpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+/*
+Algorithms on a chain of nodes, a run of Node<T> linked through next() and
+ended by a null pointer. The lists that keep their nodes in their own way,
+CompactLinkedList in a ring and SmallLinkedList partly inside the list
+object, open their nodes into a chain and share these. None of them
+recurses or allocates. If a comparison or predicate throws, the chain is
+left whole: a sort keeps every node, a filter the ones it had not decided on.
+*/
+
+#ifndef NODE_CHAIN_H
+#define NODE_CHAIN_H
+
+#include <cstddef>
+#include "node.hpp"
+
+namespace node_chain
+{
+
+// What a sort did, for lists that keep operation counters
+struct sort_counts
+{
+    size_t length;  // nodes in the chain
+    size_t merged;  // nodes the merges took one at a time
+};
+
+// Links chain, ended by a null pointer, after last and moves last to its end
+template <typename T>
+void append(Node<T>*& first, Node<T>*& last, Node<T>* chain) noexcept
+{
+    if (chain == nullptr) { return; }
+
+    if (last == nullptr) { first = chain; }
+    else { last->next(chain); }
+
+    for (last = chain; last->next() != nullptr; last = last->next()) {}
+    return;
+}
+
+// Merges two sorted chains into first up to last, ties take the left node
+// first so sorting stays stable. merged grows by the nodes taken before
+// either chain ran out. If compare throws, first up to last holds the nodes
+// merged so far followed by the rest of left and right.
+template <typename T, class Comparator>
+void merge_into(Node<T>*& first, Node<T>*& last, Node<T>* left, Node<T>* right,
+                Comparator& compare, size_t& merged)
+{
+    first = nullptr;
+    last = nullptr;
+
+    try
+    {
+        while (left != nullptr && right != nullptr)
+        {
+            Node<T>* next = nullptr;
+            if (compare(*right->data(), *left->data()))
+            {
+                next = right;
+                right = right->next();
+            }
+            else
+            {
+                next = left;
+                left = left->next();
+            }
+
+            if (last == nullptr) { first = next; }
+            else { last->next(next); }
+            last = next;
+            ++merged;
+        }
+    }
+    catch (...)
+    {
+        if (last != nullptr) { last->next(nullptr); }
+        append(first, last, left);
+        append(first, last, right);
+        throw;
+    }
+
+    append(first, last, (left != nullptr) ? left : right);
+    return;
+}
+
+// Merges two sorted chains and returns the first node, tail is set to the
+// last
+template <typename T, class Comparator>
+Node<T>* merge(Node<T>* left, Node<T>* right, Comparator& compare, Node<T>*& tail, size_t& merged)
+{
+    Node<T>* head = nullptr;
+    merge_into(head, tail, left, right, compare, merged);
+    return head;
+}
+
+template <typename T, class Comparator>
+Node<T>* merge(Node<T>* left, Node<T>* right, Comparator& compare, Node<T>*& tail)
+{
+    size_t merged = 0;
+    return merge(left, right, compare, tail, merged);
+}
+
+// Cuts the chain after its first count nodes and returns the rest
+template <typename T>
+Node<T>* split(Node<T>* head, size_t count)
+{
+    for (size_t i = 1; i < count && head != nullptr; ++i)
+    {
+        head = head->next();
+    }
+    if (head == nullptr) { return nullptr; }
+
+    Node<T>* rest = head->next();
+    head->next(nullptr);
+    return rest;
+}
+
+// Bottom up merge sort: runs of width 1, 2, 4, ... are merged in pairs until
+// one run is left. head is set to the new first node and tail to the last,
+// counts adds what the sort did. If compare throws, head up to tail still
+// holds every node, in no particular order.
+template <typename T, class Comparator>
+void sort(Node<T>*& head, Comparator compare, Node<T>*& tail, sort_counts& counts)
+{
+    tail = head;
+    if (head == nullptr || head->next() == nullptr)
+    {
+        counts.length += (head != nullptr) ? 1 : 0;
+        return;
+    }
+
+    for (size_t width = 1; ; width *= 2)
+    {
+        Node<T>* rest = head;
+        size_t runs = 0;
+        head = nullptr;
+        tail = nullptr;
+
+        while (rest != nullptr)
+        {
+            Node<T>* left = rest;
+            Node<T>* right = split(left, width);
+            rest = split(right, width);
+
+            Node<T>* run = nullptr;
+            Node<T>* run_tail = nullptr;
+            try
+            {
+                merge_into(run, run_tail, left, right, compare, counts.merged);
+            }
+            catch (...)
+            {
+                append(head, tail, run);
+                append(head, tail, rest);
+                throw;
+            }
+
+            if (tail == nullptr) { head = run; }
+            else { tail->next(run); }
+            tail = run_tail;
+            ++runs;
+
+            // The first pass pairs up single nodes, which counts the chain
+            if (width == 1) { counts.length += (right != nullptr) ? 2 : 1; }
+        }
+
+        if (runs == 1) { return; }
+    }
+}
+
+template <typename T, class Comparator>
+void sort(Node<T>*& head, Comparator compare, Node<T>*& tail)
+{
+    sort_counts counts = { 0, 0 };
+    sort(head, compare, tail, counts);
+}
+
+// Reverses the chain in place and returns its new first node, the old first
+// node is now the last
+template <typename T>
+Node<T>* reverse(Node<T>* head) noexcept
+{
+    Node<T>* previous = nullptr;
+    while (head != nullptr)
+    {
+        Node<T>* next = head->next();
+        head->next(previous);
+        previous = head;
+        head = next;
+    }
+    return previous;
+}
+
+// Unlinks every node whose value satisfies discard and hands it to dispose,
+// which frees it, once the walk is over. head is set to the first node kept
+// and tail to the last. If discard throws, the node it threw on and the ones
+// after it are kept.
+template <typename T, class Predicate, class Dispose>
+void filter(Node<T>*& head, Predicate& discard, Dispose dispose, Node<T>*& tail)
+{
+    Node<T>* current = head;
+    Node<T>* discarded = nullptr;
+    head = nullptr;
+    tail = nullptr;
+
+    try
+    {
+        while (current != nullptr)
+        {
+            Node<T>* next = current->next();
+            if (discard(*current->data()))
+            {
+                current->next(discarded);
+                discarded = current;
+            }
+            else
+            {
+                if (tail == nullptr) { head = current; }
+                else { tail->next(current); }
+                tail = current;
+            }
+            current = next;
+        }
+    }
+    catch (...)
+    {
+        if (tail != nullptr) { tail->next(nullptr); }
+        append(head, tail, current);
+
+        for (Node<T>* next = nullptr; discarded != nullptr; discarded = next)
+        {
+            next = discarded->next();
+            dispose(discarded);
+        }
+        throw;
+    }
+
+    if (tail != nullptr) { tail->next(nullptr); }
+
+    for (Node<T>* next = nullptr; discarded != nullptr; discarded = next)
+    {
+        next = discarded->next();
+        dispose(discarded);
+    }
+    return;
+}
+
+} // namespace node_chain
+
+#endif // NODE_CHAIN_H
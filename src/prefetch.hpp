@@ -0,0 +1,45 @@
+/*
+
+File: prefetch.hpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+/*
+Prefetch hints for the walks of LinkedList, compiled in only when
+LINKED_LIST_PREFETCH is defined before the list is included:
+
+    #define LINKED_LIST_PREFETCH
+    #include "linkedList.hpp"
+
+A walk asks for the next node as soon as it has read the link to it, so the
+miss on that node overlaps the work done on the current one: the predicate
+of find_if, the allocation and copy of the copy constructor, the free of
+clear. The load of each node still depends on the one before it, so the
+gain is largest when that work is heavy and the list is out of cache, and
+nothing at all for a compact list that is walked in order anyway.
+prefetchBenchmark shows the difference on large scattered lists.
+
+Without the macro, or on compilers other than GCC and Clang, the hints
+expand to nothing. Define the macro the same way in every translation unit,
+or the list templates differ between them.
+*/
+
+#ifndef LIST_PREFETCH_H
+#define LIST_PREFETCH_H
+
+// Hints that the memory at address is about to be read
+#if defined(LINKED_LIST_PREFETCH) && (defined(__GNUC__) || defined(__clang__))
+#define LIST_PREFETCH(address) __builtin_prefetch(address)
+#else
+#define LIST_PREFETCH(address) ((void)0)
+#endif
+
+#endif // LIST_PREFETCH_H
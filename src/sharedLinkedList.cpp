@@ -0,0 +1,514 @@
+/*
+
+File: sharedLinkedList.cpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#ifndef SHARED_LINKED_LIST_TPP
+#define SHARED_LINKED_LIST_TPP
+
+#include "sharedLinkedList.hpp"
+
+/*******************************************************************************
+CONSTRUCTORS
+*******************************************************************************/
+
+// Fill
+template <typename T>
+SharedLinkedList<T>::SharedLinkedList(size_type count, const_reference data) : SharedLinkedList()
+{
+    for (; count > 0; --count)
+    {
+        push_front(data);
+    }
+}
+
+// Range
+template <typename T>
+template <typename InputIterator, typename ::std::enable_if< ::std::is_constructible
+         < T, decltype(*::std::declval<InputIterator>()) >::value >::type* >
+SharedLinkedList<T>::SharedLinkedList(InputIterator begin, InputIterator end) : SharedLinkedList()
+{
+    for (; begin != end; ++begin)
+    {
+        push_back(*begin);
+    }
+}
+
+// Copy
+template <typename T>
+SharedLinkedList<T>::SharedLinkedList(const SharedLinkedList<value_type>& origin) noexcept
+    : head(origin.head), tail(origin.tail), shares(origin.head != nullptr)
+{
+    if (head == nullptr) { return; }
+
+    acquire(head);
+    origin.shares.store(true, std::memory_order_relaxed);
+}
+
+// Move
+template <typename T>
+SharedLinkedList<T>::SharedLinkedList(SharedLinkedList<value_type>&& origin) noexcept
+    : head(origin.head), tail(origin.tail), shares(origin.shares.load(std::memory_order_relaxed))
+{
+    origin.head = nullptr;
+    origin.tail = nullptr;
+    origin.shares.store(false, std::memory_order_relaxed);
+}
+
+// Initializer List
+template <typename T>
+SharedLinkedList<T>::SharedLinkedList(std::initializer_list<value_type> init)
+    : SharedLinkedList(init.begin(), init.end()) {}
+
+// Destructor
+template <typename T>
+SharedLinkedList<T>::~SharedLinkedList()
+{
+    clear();
+}
+
+/*******************************************************************************
+ITERATORS
+*******************************************************************************/
+
+template <typename T>
+typename SharedLinkedList<T>::const_iterator SharedLinkedList<T>::cbegin() const noexcept
+{
+    return const_iterator(head);
+}
+
+template <typename T>
+typename SharedLinkedList<T>::const_iterator SharedLinkedList<T>::begin() const noexcept
+{
+    return cbegin();
+}
+
+template <typename T>
+typename SharedLinkedList<T>::const_iterator SharedLinkedList<T>::cend() const noexcept
+{
+    return const_iterator(nullptr);
+}
+
+template <typename T>
+typename SharedLinkedList<T>::const_iterator SharedLinkedList<T>::end() const noexcept
+{
+    return cend();
+}
+
+/*******************************************************************************
+ELEMENT ACCESS
+*******************************************************************************/
+
+template <typename T>
+const T& SharedLinkedList<T>::front() const
+{
+    return head->value;
+}
+
+template <typename T>
+const T& SharedLinkedList<T>::back() const
+{
+    return tail->value;
+}
+
+/*******************************************************************************
+MODIFIERS
+*******************************************************************************/
+
+template <typename T>
+void SharedLinkedList<T>::push_front(const_reference data)
+{
+    // The new node takes over the list's reference to the old first node
+    head = new shared_node(data, head);
+
+    if (tail == nullptr)
+    {
+        tail = head;
+    }
+    return;
+}
+
+template <typename T>
+void SharedLinkedList<T>::push_back(const_reference data)
+{
+    if (empty())
+    {
+        push_front(data);
+        return;
+    }
+
+    if (shares.load(std::memory_order_relaxed))
+    {
+        own(tail, true);
+    }
+
+    node_pointer temp = new shared_node(data, nullptr);
+    tail->next = temp;
+    tail = temp;
+    return;
+}
+
+template <typename T>
+void SharedLinkedList<T>::pop_front()
+{
+    if (empty()) { return; }
+
+    node_pointer temp = head;
+    head = temp->next;
+
+    if (head == nullptr)
+    {
+        tail = nullptr;
+    }
+
+    if (!shares.load(std::memory_order_relaxed))
+    {
+        delete temp;
+        return;
+    }
+
+    // The list's reference moves from the old first node to the new one
+    if (head != nullptr)
+    {
+        acquire(head);
+    }
+    else
+    {
+        shares.store(false, std::memory_order_relaxed);
+    }
+    release(temp);
+    return;
+}
+
+template <typename T>
+T& SharedLinkedList<T>::pop_front(reference out_data)
+{
+    if (empty()) { return out_data; }
+
+    out_data = front();
+    pop_front();
+    return out_data;
+}
+
+template <typename T>
+void SharedLinkedList<T>::pop_back()
+{
+    if (empty()) { return; }
+
+    if (head == tail)
+    {
+        pop_front();
+        return;
+    }
+
+    node_pointer previous = own(tail, false);
+    node_pointer temp = tail;
+
+    previous->next = nullptr;
+    tail = previous;
+
+    // Every node left is the list's own now
+    if (shares.exchange(false, std::memory_order_relaxed))
+    {
+        release(temp);
+        return;
+    }
+    delete temp;
+    return;
+}
+
+template <typename T>
+T& SharedLinkedList<T>::pop_back(reference out_data)
+{
+    if (empty()) { return out_data; }
+
+    out_data = back();
+    pop_back();
+    return out_data;
+}
+
+template <typename T>
+typename SharedLinkedList<T>::iterator
+SharedLinkedList<T>::insert(const_iterator position, const_reference data)
+{
+    if (empty())
+    {
+        push_front(data);
+        return begin();
+    }
+
+    node_pointer target = position.node;
+    if (shares.load(std::memory_order_relaxed))
+    {
+        target = own(target, true);
+    }
+
+    // The new node takes over target's reference to the node after it
+    node_pointer temp = new shared_node(data, target->next);
+    target->next = temp;
+
+    if (target == tail)
+    {
+        tail = temp;
+    }
+    return iterator(temp);
+}
+
+template <typename T>
+typename SharedLinkedList<T>::iterator SharedLinkedList<T>::erase(const_iterator position)
+{
+    if (empty() || position.node == nullptr) { return end(); }
+
+    node_pointer temp = position.node;
+    node_pointer previous = own(temp, false);
+    node_pointer next = temp->next;
+
+    if (previous == nullptr) { head = next; }
+    else { previous->next = next; }
+
+    if (temp == tail)
+    {
+        tail = previous;
+    }
+
+    if (!shares.load(std::memory_order_relaxed))
+    {
+        delete temp;
+        return iterator(next);
+    }
+
+    // The list's reference moves from the erased node to the one after it
+    if (next != nullptr)
+    {
+        acquire(next);
+    }
+    release(temp);
+    return iterator(next);
+}
+
+template <typename T>
+typename SharedLinkedList<T>::iterator
+SharedLinkedList<T>::replace(const_iterator position, const_reference data)
+{
+    node_pointer target = position.node;
+    if (shares.load(std::memory_order_relaxed))
+    {
+        target = own(target, true);
+    }
+
+    target->value = data;
+    return iterator(target);
+}
+
+template <typename T>
+void SharedLinkedList<T>::clear() noexcept
+{
+    if (shares.load(std::memory_order_relaxed))
+    {
+        release(head);
+    }
+    else
+    {
+        while (head != nullptr)
+        {
+            node_pointer next = head->next;
+            delete head;
+            head = next;
+        }
+    }
+
+    head = nullptr;
+    tail = nullptr;
+    shares.store(false, std::memory_order_relaxed);
+    return;
+}
+
+/*******************************************************************************
+CAPACITY
+*******************************************************************************/
+
+template <typename T>
+bool SharedLinkedList<T>::empty() const noexcept
+{
+    return head == nullptr;
+}
+
+template <typename T>
+typename SharedLinkedList<T>::size_type SharedLinkedList<T>::size() const noexcept
+{
+    size_type count = 0;
+    for (node_pointer current = head; current != nullptr; current = current->next)
+    {
+        ++count;
+    }
+    return count;
+}
+
+template <typename T>
+bool SharedLinkedList<T>::shared() const noexcept
+{
+    return shares.load(std::memory_order_relaxed);
+}
+
+/*******************************************************************************
+OPERATIONS
+*******************************************************************************/
+
+template <typename T>
+typename SharedLinkedList<T>::const_iterator
+SharedLinkedList<T>::find(const_reference target) const
+{
+    return find_if([&target](const_reference value) { return value == target; });
+}
+
+template <typename T>
+template <class Predicate>
+typename SharedLinkedList<T>::const_iterator SharedLinkedList<T>::find_if(Predicate pred) const
+{
+    node_pointer current = head;
+    while (current != nullptr && !pred(current->value))
+    {
+        current = current->next;
+    }
+    return const_iterator(current);
+}
+
+/*******************************************************************************
+OPERATOR OVERLOADS
+*******************************************************************************/
+
+template <typename T>
+bool SharedLinkedList<T>::operator==(const SharedLinkedList<value_type>& rhs) const
+{
+    // Once both lists reach the same node the rest is shared, and equal
+    node_pointer left = head;
+    node_pointer right = rhs.head;
+
+    while (left != right)
+    {
+        if (left == nullptr || right == nullptr || left->value != right->value)
+        {
+            return false;
+        }
+        left = left->next;
+        right = right->next;
+    }
+    return true;
+}
+
+template <typename T>
+bool SharedLinkedList<T>::operator!=(const SharedLinkedList<value_type>& rhs) const
+{
+    return !(*this == rhs);
+}
+
+template <typename T>
+SharedLinkedList<T>& SharedLinkedList<T>::operator=(SharedLinkedList<value_type> list) noexcept
+{
+    swap(list);
+    return *this;
+}
+
+/*******************************************************************************
+SWAP
+*******************************************************************************/
+
+template <typename T>
+void SharedLinkedList<T>::swap(SharedLinkedList<value_type>& other) noexcept
+{
+    using std::swap;
+
+    swap(head, other.head);
+    swap(tail, other.tail);
+
+    bool temp = shares.load(std::memory_order_relaxed);
+    shares.store(other.shares.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    other.shares.store(temp, std::memory_order_relaxed);
+    return;
+}
+
+/*******************************************************************************
+SHARING
+*******************************************************************************/
+
+template <typename T>
+void SharedLinkedList<T>::acquire(node_pointer node) noexcept
+{
+    // A reference is only taken from another, ordering comes with releasing
+    node->references.fetch_add(1, std::memory_order_relaxed);
+    return;
+}
+
+template <typename T>
+void SharedLinkedList<T>::release(node_pointer node) noexcept
+{
+    // Whoever drops the last reference sees every write to the node first
+    while (node != nullptr && node->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        node_pointer next = node->next;
+        delete node;
+        node = next;
+    }
+    return;
+}
+
+template <typename T>
+typename SharedLinkedList<T>::node_pointer SharedLinkedList<T>::copy_node(node_pointer* link)
+{
+    node_pointer original = *link;
+    node_pointer copy = new shared_node(original->value, original->next);
+
+    if (copy->next != nullptr)
+    {
+        acquire(copy->next);
+    }
+    *link = copy;
+    release(original);
+    return copy;
+}
+
+template <typename T>
+typename SharedLinkedList<T>::node_pointer
+SharedLinkedList<T>::own(node_pointer target, bool including)
+{
+    const bool check = shares.load(std::memory_order_relaxed);
+    bool copying = false;
+
+    node_pointer previous = nullptr;
+    node_pointer* link = &head;
+
+    for (;;)
+    {
+        node_pointer current = *link;
+        const bool reached = current == target;
+        if (reached && !including) { return previous; }
+
+        // Other lists reach every node after one they reach
+        copying = copying || (check && current->references.load(std::memory_order_acquire) > 1);
+        if (copying)
+        {
+            current = copy_node(link);
+        }
+
+        if (current->next == nullptr)
+        {
+            tail = current;
+            shares.store(false, std::memory_order_relaxed);
+        }
+        if (reached) { return current; }
+
+        previous = current;
+        link = &current->next;
+    }
+}
+
+#endif // SHARED_LINKED_LIST_TPP
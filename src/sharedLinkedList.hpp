@@ -0,0 +1,223 @@
+/*
+
+File: sharedLinkedList.hpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+/*
+A singly linked list whose copies share their nodes, for handing snapshots
+of a list to other threads. Copying a SharedLinkedList takes one atomic
+increment whatever its length, and iterating a copy walks the same nodes
+as the original.
+
+Every node counts the references to it, from list objects and from the
+nodes linked to it, so lists can share a chain from any node on: a
+snapshot shares it all, and a list that changed since shares the part
+after the change. A modifier only writes nodes the list holds alone. Nodes
+before the point it changes that other lists can reach are copied first,
+and the copy links to the rest of the shared chain, so the rest stays
+shared. push_front and pop_front copy nothing; insert, erase and replace at
+a position copy the shared nodes up to it; push_back and pop_back copy the
+shared nodes of the whole list, once.
+
+Elements are only changed through the list, so its iterators are constant.
+As with std::shared_ptr, different lists can be used from different
+threads at the same time even when they share nodes, one list from
+several threads needs a lock.
+*/
+
+#ifndef SHARED_LINKED_LIST_H
+#define SHARED_LINKED_LIST_H
+
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+template<typename T>
+class SharedLinkedList
+{
+private:
+
+    struct shared_node
+    {
+        shared_node(const T& value, shared_node* next) : value(value), references(1), next(next) {}
+
+        T value;
+        std::atomic<size_t> references;
+        shared_node* next;
+    };
+
+public:
+
+    /* Type Defs */
+    typedef size_t size_type;
+    typedef T value_type;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef shared_node* node_pointer;
+
+    class const_iterator
+    {
+    public:
+
+        typedef const T value_type;
+        typedef const T& reference;
+        typedef const T* pointer;
+        typedef std::ptrdiff_t difference_type;
+        typedef std::forward_iterator_tag iterator_category;
+        typedef const_iterator self_type;
+
+        const_iterator() : node(nullptr) {}
+
+        self_type& operator++()
+        {
+            node = node->next;
+            return *this;
+        }
+
+        self_type operator++(int)
+        {
+            self_type previous = *this;
+            node = node->next;
+            return previous;
+        }
+
+        reference operator*() const { return node->value; }
+        pointer operator->() const { return &node->value; }
+
+        bool operator==(const self_type& rhs) const { return node == rhs.node; }
+        bool operator!=(const self_type& rhs) const { return node != rhs.node; }
+
+        friend class SharedLinkedList<T>;
+
+    private:
+
+        explicit const_iterator(node_pointer node) : node(node) {}
+
+        node_pointer node;
+    };
+
+    typedef const_iterator iterator;
+
+    /* Constructors */
+
+    // Default
+    SharedLinkedList() noexcept : head(nullptr), tail(nullptr), shares(false) {}
+
+    // Fill
+    SharedLinkedList(size_type count, const_reference data);
+
+    // Range
+    template <typename InputIterator, typename ::std::enable_if< ::std::is_constructible
+             < T, decltype(*::std::declval<InputIterator>()) >::value >::type* = nullptr >
+    SharedLinkedList(InputIterator begin, InputIterator end);
+
+    // Copy, shares the nodes of origin
+    SharedLinkedList(const SharedLinkedList<value_type>& origin) noexcept;
+
+    // Move, leaves origin empty
+    SharedLinkedList(SharedLinkedList<value_type>&& origin) noexcept;
+
+    // Initializer List
+    explicit SharedLinkedList(std::initializer_list<value_type> init);
+
+    // Destructor, frees the nodes no other list holds
+    ~SharedLinkedList();
+
+    /* Iterators */
+    const_iterator cbegin() const noexcept;
+    const_iterator begin() const noexcept;
+
+    const_iterator cend() const noexcept;
+    const_iterator end() const noexcept;
+
+    /* Element Access */
+    const_reference front() const;
+    const_reference back() const;
+
+    /* Modifiers */
+    void push_front(const_reference data);
+    void push_back(const_reference data);
+
+    void pop_front();
+    reference pop_front(reference out_data);
+    void pop_back();
+    reference pop_back(reference out_data);
+
+    // Inserts after position, or at the front of an empty list, and returns
+    // the new element
+    iterator insert(const_iterator position, const_reference data);
+
+    // Returns the element after the erased one
+    iterator erase(const_iterator position);
+
+    // Sets the element at position, which may move if the node was shared,
+    // and returns it
+    iterator replace(const_iterator position, const_reference data);
+
+    void clear() noexcept;
+
+    /* Capacity */
+    bool empty() const noexcept;
+    size_type size() const noexcept;
+
+    // True while another list may reach some of this list's nodes
+    bool shared() const noexcept;
+
+    /* Operations */
+    const_iterator find(const_reference target) const;
+    template <class Predicate>
+    const_iterator find_if(Predicate pred) const;
+
+    /* Operator Overloads */
+    bool operator==(const SharedLinkedList<value_type>& rhs) const;
+    bool operator!=(const SharedLinkedList<value_type>& rhs) const;
+    SharedLinkedList<value_type>& operator=(SharedLinkedList<value_type> list) noexcept;
+
+    /* Swap */
+    void swap(SharedLinkedList<value_type>& other) noexcept;
+
+private:
+
+    node_pointer head;
+    node_pointer tail;
+
+    // Set on both lists by a copy and cleared once a modifier has made every
+    // node the list's own, while it is clear the list writes its nodes
+    // without looking at their counts. Copying a const list sets it, so it
+    // is mutable and atomic for lists copied from several threads.
+    mutable std::atomic<bool> shares;
+
+    static void acquire(node_pointer node) noexcept;
+
+    // Drops one reference to node and frees it if that was the last, then
+    // does the same to the nodes after it
+    static void release(node_pointer node) noexcept;
+
+    // Copies the node link points to, links the copy in its place and
+    // returns it
+    node_pointer copy_node(node_pointer* link);
+
+    // Copies the shared nodes before target, and target too if including
+    // is set, so the list holds them alone. Returns the last node made the
+    // list's own: target or its copy, or with including unset the node
+    // before target, null for the first node.
+    node_pointer own(node_pointer target, bool including);
+};
+
+#include "sharedLinkedList.cpp"
+
+#endif // SHARED_LINKED_LIST_H
@@ -0,0 +1,543 @@
+/*
+
+File: smallLinkedList.cpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#ifndef SMALL_LINKED_LIST_TPP
+#define SMALL_LINKED_LIST_TPP
+
+#include <functional>
+#include <new>
+#include "smallLinkedList.hpp"
+
+/*******************************************************************************
+CONSTRUCTORS
+*******************************************************************************/
+
+// Fill
+template <typename T, size_t N>
+SmallLinkedList<T, N>::SmallLinkedList(size_type count, const_reference data) : SmallLinkedList()
+{
+    for (; count > 0; --count)
+    {
+        push_front(data);
+    }
+}
+
+// Range
+template <typename T, size_t N>
+template <typename InputIterator, typename ::std::enable_if< ::std::is_constructible
+         < T, decltype(*::std::declval<InputIterator>()) >::value >::type* >
+SmallLinkedList<T, N>::SmallLinkedList(InputIterator begin, InputIterator end) : SmallLinkedList()
+{
+    for (; begin != end; ++begin)
+    {
+        push_back(*begin);
+    }
+}
+
+// Copy
+template <typename T, size_t N>
+SmallLinkedList<T, N>::SmallLinkedList(const SmallLinkedList& origin)
+    : SmallLinkedList(origin.begin(), origin.end()) {}
+
+// Move
+template <typename T, size_t N>
+SmallLinkedList<T, N>::SmallLinkedList(SmallLinkedList&& origin)
+    noexcept(std::is_nothrow_move_constructible<T>::value) : SmallLinkedList()
+{
+    take(origin);
+}
+
+// Initializer List
+template <typename T, size_t N>
+SmallLinkedList<T, N>::SmallLinkedList(std::initializer_list<value_type> init)
+    : SmallLinkedList(init.begin(), init.end()) {}
+
+// Destructor
+template <typename T, size_t N>
+SmallLinkedList<T, N>::~SmallLinkedList()
+{
+    clear();
+}
+
+/*******************************************************************************
+ITERATORS
+*******************************************************************************/
+
+template <typename T, size_t N>
+typename SmallLinkedList<T, N>::const_iterator SmallLinkedList<T, N>::cbegin() const noexcept
+{
+    return const_iterator(head);
+}
+
+template <typename T, size_t N>
+typename SmallLinkedList<T, N>::const_iterator SmallLinkedList<T, N>::begin() const noexcept
+{
+    return cbegin();
+}
+
+template <typename T, size_t N>
+typename SmallLinkedList<T, N>::iterator SmallLinkedList<T, N>::begin() noexcept
+{
+    return iterator(head);
+}
+
+template <typename T, size_t N>
+typename SmallLinkedList<T, N>::const_iterator SmallLinkedList<T, N>::cend() const noexcept
+{
+    return const_iterator(nullptr);
+}
+
+template <typename T, size_t N>
+typename SmallLinkedList<T, N>::const_iterator SmallLinkedList<T, N>::end() const noexcept
+{
+    return cend();
+}
+
+template <typename T, size_t N>
+typename SmallLinkedList<T, N>::iterator SmallLinkedList<T, N>::end() noexcept
+{
+    return iterator(nullptr);
+}
+
+/*******************************************************************************
+ELEMENT ACCESS
+*******************************************************************************/
+
+template <typename T, size_t N>
+T& SmallLinkedList<T, N>::front()
+{
+    return *head->data();
+}
+
+template <typename T, size_t N>
+const T& SmallLinkedList<T, N>::front() const
+{
+    return *head->data();
+}
+
+template <typename T, size_t N>
+T& SmallLinkedList<T, N>::back()
+{
+    return *tail->data();
+}
+
+template <typename T, size_t N>
+const T& SmallLinkedList<T, N>::back() const
+{
+    return *tail->data();
+}
+
+/*******************************************************************************
+MODIFIERS
+*******************************************************************************/
+
+template <typename T, size_t N>
+void SmallLinkedList<T, N>::push_front(const_reference data)
+{
+    node_pointer temp = acquire(data);
+
+    temp->next(head);
+    head = temp;
+
+    if (tail == nullptr)
+    {
+        tail = head;
+    }
+    return;
+}
+
+template <typename T, size_t N>
+void SmallLinkedList<T, N>::push_back(const_reference data)
+{
+    if (empty())
+    {
+        push_front(data);
+        return;
+    }
+
+    node_pointer temp = acquire(data);
+
+    tail->next(temp);
+    tail = temp;
+    return;
+}
+
+template <typename T, size_t N>
+void SmallLinkedList<T, N>::pop_front()
+{
+    if (empty()) { return; }
+
+    node_pointer next = head->next();
+
+    release(head);
+    head = next;
+
+    if (head == nullptr)
+    {
+        tail = nullptr;
+    }
+    return;
+}
+
+template <typename T, size_t N>
+T& SmallLinkedList<T, N>::pop_front(reference out_data)
+{
+    if (empty()) { return out_data; }
+
+    out_data = front();
+    pop_front();
+    return out_data;
+}
+
+template <typename T, size_t N>
+void SmallLinkedList<T, N>::pop_back()
+{
+    if (empty()) { return; }
+
+    iterator position(tail);
+    erase(position);
+    return;
+}
+
+template <typename T, size_t N>
+T& SmallLinkedList<T, N>::pop_back(reference out_data)
+{
+    if (empty()) { return out_data; }
+
+    out_data = back();
+    pop_back();
+    return out_data;
+}
+
+template <typename T, size_t N>
+void SmallLinkedList<T, N>::insert(const_iterator& position, const_reference data)
+{
+    if (empty())
+    {
+        push_front(data);
+        position = cbegin();
+        return;
+    }
+
+    node_pointer temp = acquire(data);
+    temp->next(position.node->next());
+    position.node->next(temp);
+
+    if (position.node == tail)
+    {
+        tail = temp;
+    }
+    return;
+}
+
+template <typename T, size_t N>
+typename SmallLinkedList<T, N>::iterator SmallLinkedList<T, N>::erase(iterator& position)
+{
+    if (empty() || position.node == nullptr) { return position; }
+
+    node_pointer temp = position.node;
+    node_pointer previous = nullptr;
+
+    if (temp != head)
+    {
+        previous = head;
+        while (previous->next() != temp)
+        {
+            previous = previous->next();
+        }
+        previous->next(temp->next());
+    }
+    else
+    {
+        head = temp->next();
+    }
+
+    if (temp == tail)
+    {
+        tail = previous;
+    }
+
+    position = iterator(temp->next());
+
+    release(temp);
+    return position;
+}
+
+template <typename T, size_t N>
+typename SmallLinkedList<T, N>::iterator
+SmallLinkedList<T, N>::erase(iterator& first, iterator& last)
+{
+    while (first != last)
+    {
+        first = erase(first);
+    }
+
+    return first;
+}
+
+template <typename T, size_t N>
+void SmallLinkedList<T, N>::clear() noexcept
+{
+    while (head != nullptr)
+    {
+        node_pointer next = head->next();
+        release(head);
+        head = next;
+    }
+
+    tail = nullptr;
+    return;
+}
+
+/*******************************************************************************
+CAPACITY
+*******************************************************************************/
+
+template <typename T, size_t N>
+bool SmallLinkedList<T, N>::empty() const noexcept
+{
+    return head == nullptr;
+}
+
+template <typename T, size_t N>
+size_t SmallLinkedList<T, N>::size() const noexcept
+{
+    size_type count = 0;
+    for (const_iterator it = cbegin(); it != cend(); ++it)
+    {
+        ++count;
+    }
+    return count;
+}
+
+template <typename T, size_t N>
+size_t SmallLinkedList<T, N>::memory_usage() const
+{
+    size_type bytes = sizeof(*this);
+
+    for (node_pointer current = head; current != nullptr; current = current->next())
+    {
+        if (!is_inline(current))
+        {
+            bytes += footprint::allocated_size(sizeof(Node<T>));
+        }
+        bytes += footprint::value_bytes(*current->data());
+    }
+
+    return bytes;
+}
+
+/*******************************************************************************
+OPERATIONS
+*******************************************************************************/
+
+template <typename T, size_t N>
+void SmallLinkedList<T, N>::reverse() noexcept
+{
+    tail = head;
+    head = node_chain::reverse(head);
+    return;
+}
+
+template <typename T, size_t N>
+void SmallLinkedList<T, N>::remove(const_reference target)
+{
+    remove_if([&target] (const_reference value) { return value == target; });
+    return;
+}
+
+template <typename T, size_t N>
+template <class Predicate>
+void SmallLinkedList<T, N>::remove_if(Predicate pred)
+{
+    node_chain::filter(head, pred, [this](node_pointer node) { release(node); }, tail);
+    return;
+}
+
+template <typename T, size_t N>
+typename SmallLinkedList<T, N>::iterator SmallLinkedList<T, N>::find(const_reference target)
+{
+    return find_if([&target](const_reference value) { return value == target; });
+}
+
+template <typename T, size_t N>
+template <class Predicate>
+typename SmallLinkedList<T, N>::iterator SmallLinkedList<T, N>::find_if(Predicate pred)
+{
+    iterator it = begin();
+    while (it != end() && !pred(*it))
+    {
+        ++it;
+    }
+    return it;
+}
+
+template <typename T, size_t N>
+void SmallLinkedList<T, N>::unique()
+{
+    std::unordered_set<T> seen;
+    remove_if([&seen](const_reference value) { return !seen.insert(value).second; });
+    return;
+}
+
+template <typename T, size_t N>
+template <class Comparator>
+void SmallLinkedList<T, N>::sort(Comparator compare)
+{
+    node_chain::sort(head, compare, tail);
+    return;
+}
+
+template <typename T, size_t N>
+void SmallLinkedList<T, N>::sort()
+{
+    sort([](const_reference lhs, const_reference rhs) { return lhs < rhs; });
+}
+
+/*******************************************************************************
+OPERATOR OVERLOADS
+*******************************************************************************/
+
+template <typename T, size_t N>
+bool SmallLinkedList<T, N>::operator==(const SmallLinkedList& rhs) const
+{
+    const_iterator left = cbegin();
+    const_iterator right = rhs.cbegin();
+
+    while (left != cend() && right != rhs.cend())
+    {
+        if (*left != *right) { return false; }
+        ++left;
+        ++right;
+    }
+
+    return left == cend() && right == rhs.cend();
+}
+
+template <typename T, size_t N>
+bool SmallLinkedList<T, N>::operator!=(const SmallLinkedList& rhs) const
+{
+    return !(*this == rhs);
+}
+
+template <typename T, size_t N>
+SmallLinkedList<T, N>& SmallLinkedList<T, N>::operator=(const SmallLinkedList& rhs)
+{
+    if (this != &rhs)
+    {
+        SmallLinkedList copy(rhs);
+        clear();
+        take(copy);
+    }
+    return *this;
+}
+
+template <typename T, size_t N>
+SmallLinkedList<T, N>& SmallLinkedList<T, N>::operator=(SmallLinkedList&& rhs)
+    noexcept(std::is_nothrow_move_constructible<T>::value)
+{
+    if (this != &rhs)
+    {
+        clear();
+        take(rhs);
+    }
+    return *this;
+}
+
+template <typename T, size_t N>
+void SmallLinkedList<T, N>::swap(SmallLinkedList& other)
+    noexcept(std::is_nothrow_move_constructible<T>::value)
+{
+    if (this == &other) { return; }
+
+    SmallLinkedList temp(std::move(other));
+    other.take(*this);
+    take(temp);
+}
+
+/*******************************************************************************
+HELPER FUNCTIONS
+*******************************************************************************/
+
+template <typename T, size_t N>
+template <typename Value>
+Node<T>* SmallLinkedList<T, N>::acquire(Value&& value)
+{
+    for (size_t i = 0; i < N; ++i)
+    {
+        const std::uint64_t bit = std::uint64_t(1) << i;
+        if ((used & bit) == 0)
+        {
+            node_pointer node = new (&slots[i]) Node<T>(std::forward<Value>(value));
+            used |= bit;
+            return node;
+        }
+    }
+    return new Node<T>(std::forward<Value>(value));
+}
+
+template <typename T, size_t N>
+void SmallLinkedList<T, N>::release(node_pointer node) noexcept
+{
+    if (!is_inline(node))
+    {
+        delete node;
+        return;
+    }
+
+    const size_t index = reinterpret_cast<slot*>(node) - slots;
+    node->~Node<T>();
+    used &= ~(std::uint64_t(1) << index);
+}
+
+template <typename T, size_t N>
+bool SmallLinkedList<T, N>::is_inline(const Node<T>* node) const noexcept
+{
+    const char* address = reinterpret_cast<const char*>(node);
+    const char* first = reinterpret_cast<const char*>(slots);
+
+    return std::less_equal<const char*>()(first, address)
+        && std::less<const char*>()(address, first + sizeof(slots));
+}
+
+template <typename T, size_t N>
+void SmallLinkedList<T, N>::take(SmallLinkedList& origin)
+{
+    node_pointer current = origin.head;
+    origin.head = nullptr;
+    origin.tail = nullptr;
+
+    // This list is empty, so there is a free inline slot for every inline
+    // node of origin and acquire does not allocate for them
+    while (current != nullptr)
+    {
+        node_pointer next = current->next();
+        node_pointer node = current;
+
+        if (origin.is_inline(current))
+        {
+            node = acquire(std::move(*current->data()));
+            origin.release(current);
+        }
+
+        node->next(nullptr);
+        if (tail == nullptr) { head = node; }
+        else { tail->next(node); }
+        tail = node;
+
+        current = next;
+    }
+}
+
+#endif // SMALL_LINKED_LIST_TPP
@@ -0,0 +1,189 @@
+/*
+
+File: smallLinkedList.hpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+/*
+A singly linked list whose first N nodes live inside the list object, for
+programs whose lists mostly hold a handful of elements. Up to N elements
+the list never touches the heap; past that the extra nodes are allocated as
+in LinkedList and freed again as elements are removed. A slot freed by
+pop_front, erase or remove_if is taken again by the next insertion, so the
+list only allocates while more than N elements are held at once.
+
+Inline and heap nodes are linked into one chain, so iterators, insert and
+erase work the same as in LinkedList and use its iterator types. Moving a
+list steals its heap nodes and moves the values of its inline nodes, so
+iterators into a moved list are invalidated, as are iterators into both
+lists after swap.
+
+N is at most 64, one bit per inline slot records whether it is in use.
+*/
+
+#ifndef SMALL_LINKED_LIST_H
+#define SMALL_LINKED_LIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include "node.hpp"
+#include "nodeChain.hpp"
+#include "iterator.hpp"
+#include "memoryFootprint.hpp"
+
+template<typename T, size_t N = 4>
+class SmallLinkedList
+{
+    static_assert(N > 0 && N <= 64, "SmallLinkedList keeps between 1 and 64 nodes inline");
+
+public:
+
+    /* Type Defs */
+    typedef size_t size_type;
+    typedef T value_type;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef forward_iterator<T> iterator;
+    typedef const_forward_iterator<T> const_iterator;
+    typedef Node<T>* node_pointer;
+
+    /* Constructors */
+
+    // Default
+    SmallLinkedList() noexcept : head(nullptr), tail(nullptr), used(0) {}
+
+    // Fill
+    SmallLinkedList(size_type count, const_reference data);
+
+    // Range
+    template <typename InputIterator, typename ::std::enable_if< ::std::is_constructible
+             < T, decltype(*::std::declval<InputIterator>()) >::value >::type* = nullptr >
+    SmallLinkedList(InputIterator begin, InputIterator end);
+
+    // Copy
+    SmallLinkedList(const SmallLinkedList& origin);
+
+    // Move, leaves origin empty
+    SmallLinkedList(SmallLinkedList&& origin)
+        noexcept(std::is_nothrow_move_constructible<T>::value);
+
+    // Initializer List
+    explicit SmallLinkedList(std::initializer_list<value_type> init);
+
+    // Destructor
+    ~SmallLinkedList();
+
+    /* Iterators */
+    const_iterator cbegin() const noexcept;
+    const_iterator begin() const noexcept;
+    iterator begin() noexcept;
+
+    const_iterator cend() const noexcept;
+    const_iterator end() const noexcept;
+    iterator end() noexcept;
+
+    /* Element Access */
+    reference front();
+    const_reference front() const;
+    reference back();
+    const_reference back() const;
+
+    /* Modifiers */
+    void push_front(const_reference data);
+    void push_back(const_reference data);
+
+    void pop_front();
+    reference pop_front(reference out_data);
+    void pop_back();
+    reference pop_back(reference out_data);
+
+    void insert(const_iterator& position, const_reference data);
+
+    iterator erase(iterator& position);
+    iterator erase(iterator& first, iterator& last);
+
+    void clear() noexcept;
+
+    /* Capacity */
+    bool empty() const noexcept;
+    size_type size() const noexcept;
+
+    // The number of elements held without a heap allocation
+    static constexpr size_type inline_capacity() noexcept { return N; }
+
+    // Bytes held by the list: the list object with its inline slots, a heap
+    // block for every node past them and the memory the values own
+    size_type memory_usage() const;
+
+    /* Operations */
+    void reverse() noexcept;
+
+    void remove(const_reference target);
+    template <class Predicate>
+    void remove_if(Predicate pred);
+
+    iterator find(const_reference target);
+    template <class Predicate>
+    iterator find_if(Predicate pred);
+
+    // Keeps the first occurrence of every value, T must be hashable
+    void unique();
+
+    template <class Comparator>
+    void sort(Comparator compare);
+    void sort();
+
+    /* Operator Overloads */
+    bool operator==(const SmallLinkedList& rhs) const;
+    bool operator!=(const SmallLinkedList& rhs) const;
+    SmallLinkedList& operator=(const SmallLinkedList& rhs);
+    SmallLinkedList& operator=(SmallLinkedList&& rhs)
+        noexcept(std::is_nothrow_move_constructible<T>::value);
+
+    /* Swap */
+    void swap(SmallLinkedList& other)
+        noexcept(std::is_nothrow_move_constructible<T>::value);
+
+private:
+
+    typedef typename std::aligned_storage<sizeof(Node<T>), alignof(Node<T>)>::type slot;
+
+    node_pointer head;
+    node_pointer tail;
+
+    // Bit i is set while slots[i] holds a node
+    std::uint64_t used;
+    slot slots[N];
+
+    /* Helper functions */
+
+    // Builds a node in a free inline slot, or on the heap when all are taken
+    template <typename Value>
+    node_pointer acquire(Value&& value);
+
+    // Destroys a node and frees its slot or its heap block
+    void release(node_pointer node) noexcept;
+
+    bool is_inline(const Node<T>* node) const noexcept;
+
+    // Takes the elements of origin into this empty list, origin is left empty
+    void take(SmallLinkedList& origin);
+};
+
+#include "smallLinkedList.cpp"
+
+#endif // SMALL_LINKED_LIST_H
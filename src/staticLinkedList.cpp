@@ -0,0 +1,702 @@
+/*
+
+File: staticLinkedList.cpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#ifndef STATIC_LINKED_LIST_TPP
+#define STATIC_LINKED_LIST_TPP
+
+#include "staticLinkedList.hpp"
+
+/*******************************************************************************
+CONSTRUCTORS
+*******************************************************************************/
+
+// Fill
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR
+StaticLinkedList<T, Capacity>::StaticLinkedList(size_type count, const_reference data)
+    : StaticLinkedList()
+{
+    for (; count > 0 && push_front(data); --count) {}
+}
+
+// Range
+template <typename T, size_t Capacity>
+template <typename InputIterator, typename ::std::enable_if< ::std::is_constructible
+         < T, decltype(*::std::declval<InputIterator>()) >::value >::type* >
+STATIC_LIST_CONSTEXPR
+StaticLinkedList<T, Capacity>::StaticLinkedList(InputIterator begin, InputIterator end)
+    : StaticLinkedList()
+{
+    for (; begin != end && push_back(*begin); ++begin) {}
+}
+
+// Copy
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR
+StaticLinkedList<T, Capacity>::StaticLinkedList(const StaticLinkedList& origin)
+    : StaticLinkedList(origin.begin(), origin.end()) {}
+
+// Move
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR
+StaticLinkedList<T, Capacity>::StaticLinkedList(StaticLinkedList&& origin)
+    noexcept(std::is_nothrow_move_constructible<T>::value) : StaticLinkedList()
+{
+    take(origin);
+}
+
+// Initializer List
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR
+StaticLinkedList<T, Capacity>::StaticLinkedList(std::initializer_list<value_type> init)
+    : StaticLinkedList(init.begin(), init.end()) {}
+
+// Destructor
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR StaticLinkedList<T, Capacity>::~StaticLinkedList()
+{
+    clear();
+}
+
+/*******************************************************************************
+ITERATORS
+*******************************************************************************/
+
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR typename StaticLinkedList<T, Capacity>::const_iterator
+StaticLinkedList<T, Capacity>::cbegin() const noexcept
+{
+    return const_iterator(this, head);
+}
+
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR typename StaticLinkedList<T, Capacity>::const_iterator
+StaticLinkedList<T, Capacity>::begin() const noexcept
+{
+    return cbegin();
+}
+
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR typename StaticLinkedList<T, Capacity>::iterator
+StaticLinkedList<T, Capacity>::begin() noexcept
+{
+    return iterator(this, head);
+}
+
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR typename StaticLinkedList<T, Capacity>::const_iterator
+StaticLinkedList<T, Capacity>::cend() const noexcept
+{
+    return const_iterator(this, null_index());
+}
+
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR typename StaticLinkedList<T, Capacity>::const_iterator
+StaticLinkedList<T, Capacity>::end() const noexcept
+{
+    return cend();
+}
+
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR typename StaticLinkedList<T, Capacity>::iterator
+StaticLinkedList<T, Capacity>::end() noexcept
+{
+    return iterator(this, null_index());
+}
+
+/*******************************************************************************
+ELEMENT ACCESS
+*******************************************************************************/
+
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR T& StaticLinkedList<T, Capacity>::front()
+{
+    return slots[head].value;
+}
+
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR const T& StaticLinkedList<T, Capacity>::front() const
+{
+    return slots[head].value;
+}
+
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR T& StaticLinkedList<T, Capacity>::back()
+{
+    return slots[tail].value;
+}
+
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR const T& StaticLinkedList<T, Capacity>::back() const
+{
+    return slots[tail].value;
+}
+
+/*******************************************************************************
+MODIFIERS
+*******************************************************************************/
+
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR bool StaticLinkedList<T, Capacity>::push_front(const_reference data)
+{
+    index_type index = acquire(data);
+    if (index == null_index()) { return false; }
+
+    link_after(null_index(), index);
+    return true;
+}
+
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR bool StaticLinkedList<T, Capacity>::push_back(const_reference data)
+{
+    index_type index = acquire(data);
+    if (index == null_index()) { return false; }
+
+    link_after(tail, index);
+    return true;
+}
+
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR void StaticLinkedList<T, Capacity>::pop_front()
+{
+    if (empty()) { return; }
+
+    index_type first = head;
+    head = slots[first].next;
+
+    if (head == null_index())
+    {
+        tail = null_index();
+    }
+
+    release(first);
+    return;
+}
+
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR T& StaticLinkedList<T, Capacity>::pop_front(reference out_data)
+{
+    if (empty()) { return out_data; }
+
+    out_data = front();
+    pop_front();
+    return out_data;
+}
+
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR void StaticLinkedList<T, Capacity>::pop_back()
+{
+    if (empty()) { return; }
+
+    iterator position(this, tail);
+    erase(position);
+    return;
+}
+
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR T& StaticLinkedList<T, Capacity>::pop_back(reference out_data)
+{
+    if (empty()) { return out_data; }
+
+    out_data = back();
+    pop_back();
+    return out_data;
+}
+
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR bool
+StaticLinkedList<T, Capacity>::insert(const_iterator& position, const_reference data)
+{
+    // Into an empty list the element goes first and position comes to it
+    const index_type previous = empty() ? null_index() : position.index;
+
+    index_type index = acquire(data);
+    if (index == null_index()) { return false; }
+
+    link_after(previous, index);
+    if (previous == null_index())
+    {
+        position = cbegin();
+    }
+    return true;
+}
+
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR bool
+StaticLinkedList<T, Capacity>::insert(const_iterator position, size_type n, const_reference data)
+{
+    if (n > Capacity - count) { return false; }
+
+    for (; n > 0; --n)
+    {
+        insert(position, data);
+        ++position;
+    }
+    return true;
+}
+
+template <typename T, size_t Capacity>
+template <typename ForwardIterator, typename ::std::enable_if< ::std::is_constructible
+         < T, decltype(*::std::declval<ForwardIterator>()) >::value >::type* >
+STATIC_LIST_CONSTEXPR bool
+StaticLinkedList<T, Capacity>::insert(const_iterator position, ForwardIterator begin, ForwardIterator end)
+{
+    if (static_cast<size_type>(std::distance(begin, end)) > Capacity - count) { return false; }
+
+    for (; begin != end; ++begin)
+    {
+        insert(position, *begin);
+        ++position;
+    }
+    return true;
+}
+
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR typename StaticLinkedList<T, Capacity>::iterator
+StaticLinkedList<T, Capacity>::erase(iterator& position)
+{
+    if (empty() || position.index == null_index()) { return position; }
+
+    index_type target = position.index;
+    index_type previous = null_index();
+
+    if (target == head)
+    {
+        head = slots[target].next;
+    }
+    else
+    {
+        previous = head;
+        while (slots[previous].next != target)
+        {
+            previous = slots[previous].next;
+        }
+        slots[previous].next = slots[target].next;
+    }
+
+    if (target == tail)
+    {
+        tail = previous;
+    }
+
+    position = iterator(this, slots[target].next);
+
+    release(target);
+    return position;
+}
+
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR typename StaticLinkedList<T, Capacity>::iterator
+StaticLinkedList<T, Capacity>::erase(iterator& first, iterator& last)
+{
+    while (first != last)
+    {
+        first = erase(first);
+    }
+
+    return first;
+}
+
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR void StaticLinkedList<T, Capacity>::clear() noexcept
+{
+    // Values without a destructor to run are dropped without walking them
+    if (!std::is_trivially_destructible<T>::value)
+    {
+        for (index_type index = head; index != null_index(); index = slots[index].next)
+        {
+#if __cplusplus >= 202002L
+            std::destroy_at(&slots[index].value);
+#else
+            slots[index].value.~T();
+#endif
+        }
+    }
+
+    head = null_index();
+    tail = null_index();
+    free_list = null_index();
+    unused = 0;
+    count = 0;
+    return;
+}
+
+/*******************************************************************************
+CAPACITY
+*******************************************************************************/
+
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR bool StaticLinkedList<T, Capacity>::empty() const noexcept
+{
+    return count == 0;
+}
+
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR bool StaticLinkedList<T, Capacity>::full() const noexcept
+{
+    return count == Capacity;
+}
+
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR size_t StaticLinkedList<T, Capacity>::size() const noexcept
+{
+    return count;
+}
+
+template <typename T, size_t Capacity>
+size_t StaticLinkedList<T, Capacity>::memory_usage() const
+{
+    size_type bytes = sizeof(*this);
+
+    for (const_iterator it = cbegin(); it != cend(); ++it)
+    {
+        bytes += footprint::value_bytes(*it);
+    }
+
+    return bytes;
+}
+
+/*******************************************************************************
+OPERATIONS
+*******************************************************************************/
+
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR void StaticLinkedList<T, Capacity>::reverse() noexcept
+{
+    index_type previous = null_index();
+    index_type current = head;
+
+    while (current != null_index())
+    {
+        index_type next = slots[current].next;
+        slots[current].next = previous;
+        previous = current;
+        current = next;
+    }
+
+    tail = head;
+    head = previous;
+    return;
+}
+
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR void StaticLinkedList<T, Capacity>::remove(const_reference target)
+{
+    remove_if([&target] (const_reference value) { return value == target; });
+    return;
+}
+
+template <typename T, size_t Capacity>
+template <class Predicate>
+STATIC_LIST_CONSTEXPR void StaticLinkedList<T, Capacity>::remove_if(Predicate pred)
+{
+    index_type current = head;
+    head = null_index();
+    tail = null_index();
+
+    while (current != null_index())
+    {
+        index_type next = slots[current].next;
+        if (pred(slots[current].value))
+        {
+            release(current);
+        }
+        else
+        {
+            if (tail == null_index()) { head = current; }
+            else { slots[tail].next = current; }
+            tail = current;
+        }
+        current = next;
+    }
+
+    if (tail != null_index()) { slots[tail].next = null_index(); }
+    return;
+}
+
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR typename StaticLinkedList<T, Capacity>::iterator
+StaticLinkedList<T, Capacity>::find(const_reference target)
+{
+    return find_if([&target](const_reference value) { return value == target; });
+}
+
+template <typename T, size_t Capacity>
+template <class Predicate>
+STATIC_LIST_CONSTEXPR typename StaticLinkedList<T, Capacity>::iterator
+StaticLinkedList<T, Capacity>::find_if(Predicate pred)
+{
+    iterator it = begin();
+    while (it != end() && !pred(*it))
+    {
+        ++it;
+    }
+    return it;
+}
+
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR void StaticLinkedList<T, Capacity>::unique()
+{
+    for (index_type kept = head; kept != null_index(); kept = slots[kept].next)
+    {
+        index_type previous = kept;
+        while (slots[previous].next != null_index())
+        {
+            index_type current = slots[previous].next;
+            if (slots[current].value == slots[kept].value)
+            {
+                slots[previous].next = slots[current].next;
+                if (current == tail) { tail = previous; }
+                release(current);
+            }
+            else
+            {
+                previous = current;
+            }
+        }
+    }
+    return;
+}
+
+template <typename T, size_t Capacity>
+template <class Comparator>
+STATIC_LIST_CONSTEXPR void StaticLinkedList<T, Capacity>::sort(Comparator compare)
+{
+    if (count < 2) { return; }
+
+    // Bottom up merge sort: runs of width 1, 2, 4, ... are merged in pairs
+    for (size_type width = 1; width < count; width *= 2)
+    {
+        index_type rest = head;
+        head = null_index();
+        tail = null_index();
+
+        while (rest != null_index())
+        {
+            index_type left = rest;
+            index_type right = split(left, width);
+            rest = split(right, width);
+
+            index_type last = null_index();
+            index_type run = merge(left, right, compare, last);
+
+            if (tail == null_index()) { head = run; }
+            else { slots[tail].next = run; }
+            tail = last;
+        }
+    }
+    return;
+}
+
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR void StaticLinkedList<T, Capacity>::sort()
+{
+    sort([](const_reference lhs, const_reference rhs) { return lhs < rhs; });
+}
+
+/*******************************************************************************
+OPERATOR OVERLOADS
+*******************************************************************************/
+
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR bool StaticLinkedList<T, Capacity>::operator==(const StaticLinkedList& rhs) const
+{
+    if (count != rhs.count) { return false; }
+
+    const_iterator right = rhs.cbegin();
+    for (const_iterator left = cbegin(); left != cend(); ++left, ++right)
+    {
+        if (*left != *right) { return false; }
+    }
+    return true;
+}
+
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR bool StaticLinkedList<T, Capacity>::operator!=(const StaticLinkedList& rhs) const
+{
+    return !(*this == rhs);
+}
+
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR StaticLinkedList<T, Capacity>&
+StaticLinkedList<T, Capacity>::operator=(const StaticLinkedList& rhs)
+{
+    if (this != &rhs)
+    {
+        clear();
+        for (const_iterator it = rhs.cbegin(); it != rhs.cend(); ++it)
+        {
+            push_back(*it);
+        }
+    }
+    return *this;
+}
+
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR StaticLinkedList<T, Capacity>&
+StaticLinkedList<T, Capacity>::operator=(StaticLinkedList&& rhs)
+    noexcept(std::is_nothrow_move_constructible<T>::value)
+{
+    if (this != &rhs)
+    {
+        clear();
+        take(rhs);
+    }
+    return *this;
+}
+
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR void StaticLinkedList<T, Capacity>::swap(StaticLinkedList& other)
+    noexcept(std::is_nothrow_move_constructible<T>::value)
+{
+    if (this == &other) { return; }
+
+    StaticLinkedList temp(std::move(other));
+    other.take(*this);
+    take(temp);
+}
+
+/*******************************************************************************
+HELPER FUNCTIONS
+*******************************************************************************/
+
+template <typename T, size_t Capacity>
+template <typename Value>
+STATIC_LIST_CONSTEXPR typename StaticLinkedList<T, Capacity>::index_type
+StaticLinkedList<T, Capacity>::acquire(Value&& value)
+{
+    index_type index = free_list;
+
+    if (index != null_index())
+    {
+        free_list = slots[index].next;
+    }
+    else if (unused < Capacity)
+    {
+        index = unused++;
+    }
+    else
+    {
+        return null_index();
+    }
+
+#if __cplusplus >= 202002L
+    std::construct_at(&slots[index].value, std::forward<Value>(value));
+#else
+    ::new (static_cast<void*>(&slots[index].value)) T(std::forward<Value>(value));
+#endif
+    ++count;
+    return index;
+}
+
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR void StaticLinkedList<T, Capacity>::release(index_type index) noexcept
+{
+#if __cplusplus >= 202002L
+    std::destroy_at(&slots[index].value);
+#else
+    slots[index].value.~T();
+#endif
+    slots[index].next = free_list;
+    free_list = index;
+    --count;
+}
+
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR void
+StaticLinkedList<T, Capacity>::link_after(index_type previous, index_type index) noexcept
+{
+    if (previous == null_index())
+    {
+        slots[index].next = head;
+        head = index;
+    }
+    else
+    {
+        slots[index].next = slots[previous].next;
+        slots[previous].next = index;
+    }
+
+    if (slots[index].next == null_index())
+    {
+        tail = index;
+    }
+}
+
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR void StaticLinkedList<T, Capacity>::take(StaticLinkedList& origin)
+{
+    for (index_type index = origin.head; index != null_index(); index = origin.slots[index].next)
+    {
+        link_after(tail, acquire(std::move(origin.slots[index].value)));
+    }
+    origin.clear();
+}
+
+template <typename T, size_t Capacity>
+template <class Comparator>
+STATIC_LIST_CONSTEXPR typename StaticLinkedList<T, Capacity>::index_type
+StaticLinkedList<T, Capacity>::merge(index_type left, index_type right, Comparator& compare,
+                                     index_type& last)
+{
+    index_type first = null_index();
+    last = null_index();
+
+    // Ties take the left element first so sorting stays stable
+    while (left != null_index() && right != null_index())
+    {
+        index_type next = null_index();
+        if (compare(slots[right].value, slots[left].value))
+        {
+            next = right;
+            right = slots[right].next;
+        }
+        else
+        {
+            next = left;
+            left = slots[left].next;
+        }
+
+        if (last == null_index()) { first = next; }
+        else { slots[last].next = next; }
+        last = next;
+    }
+
+    index_type rest = (left != null_index()) ? left : right;
+    if (last == null_index()) { first = rest; last = rest; }
+    else { slots[last].next = rest; }
+
+    while (last != null_index() && slots[last].next != null_index())
+    {
+        last = slots[last].next;
+    }
+    return first;
+}
+
+template <typename T, size_t Capacity>
+STATIC_LIST_CONSTEXPR typename StaticLinkedList<T, Capacity>::index_type
+StaticLinkedList<T, Capacity>::split(index_type first, size_type length) noexcept
+{
+    for (size_type i = 1; i < length && first != null_index(); ++i)
+    {
+        first = slots[first].next;
+    }
+    if (first == null_index()) { return null_index(); }
+
+    index_type rest = slots[first].next;
+    slots[first].next = null_index();
+    return rest;
+}
+
+#endif // STATIC_LINKED_LIST_TPP
@@ -0,0 +1,295 @@
+/*
+
+File: staticLinkedList.hpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+/*
+A singly linked list of at most Capacity elements that never touches the
+heap, for threads that must not allocate. Its values live in an array
+inside the list object and are linked by indices of the smallest unsigned
+type that holds Capacity. Slots given up by pop, erase or remove_if go on a
+free list and are taken again first.
+
+The list has the modifiers and algorithms of LinkedList. Whatever adds an
+element returns false, and leaves the list as it was, when the list is
+full; nothing throws for lack of room. unique compares every value with
+the ones kept before it instead of hashing, so it does not allocate either.
+
+Compiled as C++20 or later every member but memory_usage is constexpr, so a
+list can be built and used in constant expressions. T must then be usable
+in constant expressions as well.
+
+Iterators refer to the list they came from, moving or swapping a list
+moves its values and invalidates them.
+*/
+
+#ifndef STATIC_LINKED_LIST_H
+#define STATIC_LINKED_LIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "memoryFootprint.hpp"
+
+#if __cplusplus >= 202002L
+#define STATIC_LIST_CONSTEXPR constexpr
+#else
+#define STATIC_LIST_CONSTEXPR
+#endif
+
+template<typename T, size_t Capacity>
+class StaticLinkedList
+{
+    static_assert(Capacity > 0 && Capacity < 0xFFFFFFFFu, "StaticLinkedList needs a capacity "
+                  "between 1 and 2^32 - 2");
+
+public:
+
+    /* Type Defs */
+    typedef size_t size_type;
+    typedef T value_type;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+
+    // The smallest unsigned type that holds every index and the null index
+    typedef typename std::conditional<(Capacity < 0xFFu), std::uint8_t,
+            typename std::conditional<(Capacity < 0xFFFFu), std::uint16_t,
+                                      std::uint32_t>::type>::type index_type;
+
+    // Value is T for iterator and const T for const_iterator
+    template <typename Value>
+    class basic_iterator
+    {
+    public:
+
+        typedef Value value_type;
+        typedef Value& reference;
+        typedef Value* pointer;
+        typedef std::ptrdiff_t difference_type;
+        typedef std::forward_iterator_tag iterator_category;
+        typedef basic_iterator self_type;
+
+        STATIC_LIST_CONSTEXPR basic_iterator() : list(nullptr), index(null_index()) {}
+
+        // An iterator converts to a const_iterator
+        template <typename Other, typename = typename std::enable_if
+                 < std::is_same<Value, const Other>::value >::type>
+        STATIC_LIST_CONSTEXPR basic_iterator(const basic_iterator<Other>& other)
+            : list(other.list), index(other.index) {}
+
+        STATIC_LIST_CONSTEXPR self_type& operator++()
+        {
+            index = list->slots[index].next;
+            return *this;
+        }
+
+        STATIC_LIST_CONSTEXPR self_type operator++(int)
+        {
+            self_type previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        STATIC_LIST_CONSTEXPR reference operator*() const { return list->slots[index].value; }
+        STATIC_LIST_CONSTEXPR pointer operator->() const { return &list->slots[index].value; }
+
+        STATIC_LIST_CONSTEXPR bool operator==(const self_type& rhs) const { return index == rhs.index; }
+        STATIC_LIST_CONSTEXPR bool operator!=(const self_type& rhs) const { return index != rhs.index; }
+
+        friend class StaticLinkedList;
+        template <typename> friend class basic_iterator;
+
+    private:
+
+        typedef typename std::conditional<std::is_const<Value>::value,
+                const StaticLinkedList, StaticLinkedList>::type list_type;
+
+        STATIC_LIST_CONSTEXPR basic_iterator(list_type* list, index_type index)
+            : list(list), index(index) {}
+
+        list_type* list;
+        index_type index;
+    };
+
+    typedef basic_iterator<T> iterator;
+    typedef basic_iterator<const T> const_iterator;
+
+    /* Constructors */
+
+    // Default
+    STATIC_LIST_CONSTEXPR StaticLinkedList() noexcept
+        : head(null_index()), tail(null_index()), free_list(null_index()), unused(0), count(0) {}
+
+    // Fill, takes as many as fit
+    STATIC_LIST_CONSTEXPR StaticLinkedList(size_type count, const_reference data);
+
+    // Range, takes as many as fit
+    template <typename InputIterator, typename ::std::enable_if< ::std::is_constructible
+             < T, decltype(*::std::declval<InputIterator>()) >::value >::type* = nullptr >
+    STATIC_LIST_CONSTEXPR StaticLinkedList(InputIterator begin, InputIterator end);
+
+    // Copy
+    STATIC_LIST_CONSTEXPR StaticLinkedList(const StaticLinkedList& origin);
+
+    // Move, moves the values and leaves origin empty
+    STATIC_LIST_CONSTEXPR StaticLinkedList(StaticLinkedList&& origin)
+        noexcept(std::is_nothrow_move_constructible<T>::value);
+
+    // Initializer List, takes as many as fit
+    STATIC_LIST_CONSTEXPR explicit StaticLinkedList(std::initializer_list<value_type> init);
+
+    // Destructor
+    STATIC_LIST_CONSTEXPR ~StaticLinkedList();
+
+    /* Iterators */
+    STATIC_LIST_CONSTEXPR const_iterator cbegin() const noexcept;
+    STATIC_LIST_CONSTEXPR const_iterator begin() const noexcept;
+    STATIC_LIST_CONSTEXPR iterator begin() noexcept;
+
+    STATIC_LIST_CONSTEXPR const_iterator cend() const noexcept;
+    STATIC_LIST_CONSTEXPR const_iterator end() const noexcept;
+    STATIC_LIST_CONSTEXPR iterator end() noexcept;
+
+    /* Element Access */
+    STATIC_LIST_CONSTEXPR reference front();
+    STATIC_LIST_CONSTEXPR const_reference front() const;
+    STATIC_LIST_CONSTEXPR reference back();
+    STATIC_LIST_CONSTEXPR const_reference back() const;
+
+    /* Modifiers, the ones that add return false when the list is full */
+    STATIC_LIST_CONSTEXPR bool push_front(const_reference data);
+    STATIC_LIST_CONSTEXPR bool push_back(const_reference data);
+
+    STATIC_LIST_CONSTEXPR void pop_front();
+    STATIC_LIST_CONSTEXPR reference pop_front(reference out_data);
+    STATIC_LIST_CONSTEXPR void pop_back();
+    STATIC_LIST_CONSTEXPR reference pop_back(reference out_data);
+
+    // Inserts after position. The n and range forms insert nothing unless
+    // all of the new elements fit.
+    STATIC_LIST_CONSTEXPR bool insert(const_iterator& position, const_reference data);
+    STATIC_LIST_CONSTEXPR bool insert(const_iterator position, size_type n, const_reference data);
+    template <typename ForwardIterator, typename ::std::enable_if< ::std::is_constructible
+             < T, decltype(*::std::declval<ForwardIterator>()) >::value >::type* = nullptr >
+    STATIC_LIST_CONSTEXPR bool insert(const_iterator position, ForwardIterator begin, ForwardIterator end);
+
+    STATIC_LIST_CONSTEXPR iterator erase(iterator& position);
+    STATIC_LIST_CONSTEXPR iterator erase(iterator& first, iterator& last);
+
+    STATIC_LIST_CONSTEXPR void clear() noexcept;
+
+    /* Capacity */
+    STATIC_LIST_CONSTEXPR bool empty() const noexcept;
+    STATIC_LIST_CONSTEXPR bool full() const noexcept;
+    STATIC_LIST_CONSTEXPR size_type size() const noexcept;
+    static constexpr size_type capacity() noexcept { return Capacity; }
+    static constexpr size_type max_size() noexcept { return Capacity; }
+
+    // Bytes held by the list: the list object with every slot, and the
+    // memory the values own
+    size_type memory_usage() const;
+
+    /* Operations */
+    STATIC_LIST_CONSTEXPR void reverse() noexcept;
+
+    STATIC_LIST_CONSTEXPR void remove(const_reference target);
+    template <class Predicate>
+    STATIC_LIST_CONSTEXPR void remove_if(Predicate pred);
+
+    STATIC_LIST_CONSTEXPR iterator find(const_reference target);
+    template <class Predicate>
+    STATIC_LIST_CONSTEXPR iterator find_if(Predicate pred);
+
+    // Keeps the first occurrence of every value, quadratic in the size
+    STATIC_LIST_CONSTEXPR void unique();
+
+    template <class Comparator>
+    STATIC_LIST_CONSTEXPR void sort(Comparator compare);
+    STATIC_LIST_CONSTEXPR void sort();
+
+    /* Operator Overloads */
+    STATIC_LIST_CONSTEXPR bool operator==(const StaticLinkedList& rhs) const;
+    STATIC_LIST_CONSTEXPR bool operator!=(const StaticLinkedList& rhs) const;
+    STATIC_LIST_CONSTEXPR StaticLinkedList& operator=(const StaticLinkedList& rhs);
+    STATIC_LIST_CONSTEXPR StaticLinkedList& operator=(StaticLinkedList&& rhs)
+        noexcept(std::is_nothrow_move_constructible<T>::value);
+
+    /* Swap */
+    STATIC_LIST_CONSTEXPR void swap(StaticLinkedList& other)
+        noexcept(std::is_nothrow_move_constructible<T>::value);
+
+private:
+
+    // Raw room for one value, constructed and destroyed by the list, next
+    // to the index of the slot that follows it
+    struct slot
+    {
+        STATIC_LIST_CONSTEXPR slot() noexcept {}
+        STATIC_LIST_CONSTEXPR ~slot() {}
+
+        union
+        {
+            T value;
+        };
+        index_type next;
+    };
+
+    static constexpr index_type null_index() noexcept { return index_type(-1); }
+
+    index_type head;
+    index_type tail;
+
+    // First slot of the free list, linked through next like the elements
+    index_type free_list;
+
+    // Slots from unused on have never been taken
+    index_type unused;
+
+    size_type count;
+
+    slot slots[Capacity];
+
+    /* Helper functions */
+
+    // Constructs value in a free slot and returns its index, the null index
+    // when the list is full
+    template <typename Value>
+    STATIC_LIST_CONSTEXPR index_type acquire(Value&& value);
+
+    // Destroys the value in a slot and puts the slot on the free list
+    STATIC_LIST_CONSTEXPR void release(index_type index) noexcept;
+
+    // Links an acquired slot in after previous, at the front when previous
+    // is the null index
+    STATIC_LIST_CONSTEXPR void link_after(index_type previous, index_type index) noexcept;
+
+    // Moves the values of origin into this empty list, origin is left empty
+    STATIC_LIST_CONSTEXPR void take(StaticLinkedList& origin);
+
+    template <class Comparator>
+    STATIC_LIST_CONSTEXPR index_type merge(index_type left, index_type right, Comparator& compare,
+                                           index_type& last);
+
+    // Cuts the chain at first after length elements and returns the rest
+    STATIC_LIST_CONSTEXPR index_type split(index_type first, size_type length) noexcept;
+};
+
+#include "staticLinkedList.cpp"
+
+#endif // STATIC_LINKED_LIST_H
@@ -0,0 +1,306 @@
+/*
+
+File: threadPool.cpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+// Implementation for ThreadPool, functions are inline to keep it header only
+
+#ifndef THREAD_POOL_TPP
+#define THREAD_POOL_TPP
+
+#include "threadPool.hpp"
+
+/*******************************************************************************
+CONSTRUCTORS
+*******************************************************************************/
+
+inline ThreadPool::ThreadPool(size_t workers) : pending(0), stopping(false)
+{
+    workers = (workers == 0) ? 1 : workers;
+
+    // Every deque exists before any worker can try to steal from it
+    for (size_t i = 0; i < workers; ++i)
+    {
+        this->workers.emplace_back(new worker);
+    }
+    for (size_t i = 0; i < workers; ++i)
+    {
+        this->workers[i]->thread = std::thread(&ThreadPool::work, this, i);
+    }
+}
+
+inline ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> guard(idle_lock);
+        stopping = true;
+    }
+    idle.notify_all();
+
+    for (std::unique_ptr<worker>& self : workers)
+    {
+        self->thread.join();
+    }
+}
+
+/*******************************************************************************
+INSPECTORS
+*******************************************************************************/
+
+inline size_t ThreadPool::size() const
+{
+    return workers.size();
+}
+
+inline std::vector<ThreadPool::worker_stats> ThreadPool::stats() const
+{
+    std::vector<worker_stats> result;
+    for (const std::unique_ptr<worker>& self : workers)
+    {
+        worker_stats entry = {
+            self->tasks_run.load(std::memory_order_relaxed),
+            self->steals.load(std::memory_order_relaxed),
+            std::chrono::nanoseconds(self->idle_nanoseconds.load(std::memory_order_relaxed))
+        };
+        result.push_back(entry);
+    }
+    return result;
+}
+
+inline void ThreadPool::reset_stats()
+{
+    for (std::unique_ptr<worker>& self : workers)
+    {
+        self->tasks_run.store(0, std::memory_order_relaxed);
+        self->steals.store(0, std::memory_order_relaxed);
+        self->idle_nanoseconds.store(0, std::memory_order_relaxed);
+    }
+    return;
+}
+
+/*******************************************************************************
+SCHEDULING
+*******************************************************************************/
+
+inline void ThreadPool::submit(task_type task)
+{
+    task_type* item = new task_type(std::move(task));
+
+    // Counted before it is visible, a worker may briefly find nothing to run
+    pending.fetch_add(1);
+
+    size_t index = 0;
+    worker* self = local_worker(index);
+    if (self != nullptr)
+    {
+        self->tasks.push(item);
+    }
+    else
+    {
+        std::lock_guard<std::mutex> guard(inbox_lock);
+        inbox.push_back(item);
+    }
+
+    // Taking the lock orders this wake up after a worker's check of pending
+    {
+        std::lock_guard<std::mutex> guard(idle_lock);
+    }
+    idle.notify_one();
+
+    return;
+}
+
+inline void ThreadPool::parallel_for(size_t count, const index_task& task)
+{
+    if (count == 0) { return; }
+
+    std::atomic<size_t> remaining(count);
+    std::mutex error_lock;
+    std::exception_ptr error;
+
+    auto run_index = [&task, &remaining, &error_lock, &error](size_t i)
+    {
+        try
+        {
+            task(i);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> guard(error_lock);
+            if (!error) { error = std::current_exception(); }
+        }
+        // Must be the last access, the caller's frame may be gone afterwards
+        remaining.fetch_sub(1, std::memory_order_release);
+    };
+
+    for (size_t i = 1; i < count; ++i)
+    {
+        submit([&run_index, i]() { run_index(i); });
+    }
+    run_index(0);
+
+    while (remaining.load(std::memory_order_acquire) != 0)
+    {
+        if (!try_run_one())
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    if (error) { std::rethrow_exception(error); }
+
+    return;
+}
+
+inline ThreadPool& ThreadPool::shared()
+{
+    static ThreadPool pool;
+    return pool;
+}
+
+inline size_t ThreadPool::default_workers()
+{
+    size_t cores = std::thread::hardware_concurrency();
+    return (cores == 0) ? 1 : cores;
+}
+
+/*******************************************************************************
+HELPER FUNCTIONS
+*******************************************************************************/
+
+inline void ThreadPool::work(size_t index)
+{
+    local_pool() = this;
+    local_index() = index;
+
+    worker* self = workers[index].get();
+
+    task_type* task = nullptr;
+    while (true)
+    {
+        if (find_task(self, index, task))
+        {
+            run(self, task);
+            continue;
+        }
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        {
+            std::unique_lock<std::mutex> guard(idle_lock);
+            idle.wait(guard, [this]() { return stopping || pending.load() != 0; });
+
+            if (stopping && pending.load() == 0) { return; }
+        }
+        self->idle_nanoseconds.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count(), std::memory_order_relaxed);
+    }
+}
+
+inline bool ThreadPool::try_run_one()
+{
+    size_t index = 0;
+    worker* self = local_worker(index);
+
+    task_type* task = nullptr;
+    if (find_task(self, index, task))
+    {
+        run(self, task);
+        return true;
+    }
+    return false;
+}
+
+inline bool ThreadPool::find_task(worker* self, size_t index, task_type*& task)
+{
+    // Own work first, newest first while its data is still in this core's cache
+    if (self != nullptr && self->tasks.pop(task))
+    {
+        pending.fetch_sub(1);
+        return true;
+    }
+    if (take_inbox(task))
+    {
+        return true;
+    }
+    if (steal(index, task))
+    {
+        if (self != nullptr)
+        {
+            self->steals.fetch_add(1, std::memory_order_relaxed);
+        }
+        return true;
+    }
+    return false;
+}
+
+inline bool ThreadPool::take_inbox(task_type*& task)
+{
+    std::lock_guard<std::mutex> guard(inbox_lock);
+
+    if (inbox.empty()) { return false; }
+
+    task = inbox.front();
+    inbox.pop_front();
+    pending.fetch_sub(1);
+
+    return true;
+}
+
+inline bool ThreadPool::steal(size_t thief, task_type*& task)
+{
+    for (size_t i = 1; i <= workers.size(); ++i)
+    {
+        worker& victim = *workers[(thief + i) % workers.size()];
+
+        // Oldest first, these tend to be the largest pieces of work
+        if (victim.tasks.steal(task))
+        {
+            pending.fetch_sub(1);
+            return true;
+        }
+    }
+    return false;
+}
+
+inline void ThreadPool::run(worker* self, task_type* task)
+{
+    (*task)();
+    delete task;
+
+    if (self != nullptr)
+    {
+        self->tasks_run.fetch_add(1, std::memory_order_relaxed);
+    }
+    return;
+}
+
+inline ThreadPool::worker* ThreadPool::local_worker(size_t& index) const
+{
+    if (local_pool() != this) { return nullptr; }
+
+    index = local_index();
+    return workers[index].get();
+}
+
+inline ThreadPool*& ThreadPool::local_pool()
+{
+    static thread_local ThreadPool* pool = nullptr;
+    return pool;
+}
+
+inline size_t& ThreadPool::local_index()
+{
+    static thread_local size_t index = 0;
+    return index;
+}
+
+#endif // THREAD_POOL_TPP
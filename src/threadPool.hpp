@@ -0,0 +1,129 @@
+/*
+
+File: threadPool.hpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+/*
+ThreadPool is the work-stealing executor shared by the parallel list
+algorithms. Every worker owns a lock-free Chase-Lev deque: it pushes and pops
+its own tasks at the bottom while idle workers steal from the top. Tasks
+submitted from threads outside the pool go through a locked inbox that every
+worker checks before it tries to steal.
+*/
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "executor.hpp"
+#include "workStealingDeque.hpp"
+
+class ThreadPool : public Executor
+{
+public:
+
+    typedef std::function<void()> task_type;
+
+    struct worker_stats
+    {
+        size_t tasks_run;
+        size_t steals;
+        std::chrono::nanoseconds idle;
+    };
+
+    /* Constructors */
+
+    // Starts the given number of workers, at least one
+    explicit ThreadPool(size_t workers = default_workers());
+
+    // Runs every task already submitted, then joins the workers
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /* Inspectors */
+    size_t size() const override;
+
+    // One entry per worker, counted since construction or the last reset
+    std::vector<worker_stats> stats() const;
+    void reset_stats();
+
+    /* Scheduling */
+
+    // Tasks given to submit must not throw
+    void submit(task_type task);
+
+    // The calling thread runs tasks while it waits, so parallel_for may be
+    // nested inside another task
+    void parallel_for(size_t count, const index_task& task) override;
+
+    // Pool used by the parallel algorithms when no other executor is given
+    static ThreadPool& shared();
+
+    static size_t default_workers();
+
+private:
+
+    struct worker
+    {
+        worker() : tasks_run(0), steals(0), idle_nanoseconds(0) {}
+
+        WorkStealingDeque<task_type*> tasks;
+
+        std::atomic<size_t> tasks_run;
+        std::atomic<size_t> steals;
+        std::atomic<int64_t> idle_nanoseconds;
+
+        std::thread thread;
+    };
+
+    std::vector<std::unique_ptr<worker> > workers;
+
+    std::mutex inbox_lock;
+    std::deque<task_type*> inbox;
+
+    std::atomic<size_t> pending;
+
+    std::mutex idle_lock;
+    std::condition_variable idle;
+    bool stopping;
+
+    /* Helper functions */
+    void work(size_t index);
+
+    bool try_run_one();
+    bool find_task(worker* self, size_t index, task_type*& task);
+    bool take_inbox(task_type*& task);
+    bool steal(size_t thief, task_type*& task);
+    void run(worker* self, task_type* task);
+
+    // The worker of this pool that the calling thread is, nullptr otherwise
+    worker* local_worker(size_t& index) const;
+
+    static ThreadPool*& local_pool();
+    static size_t& local_index();
+};
+
+#include "threadPool.cpp"
+
+#endif // THREAD_POOL_H
@@ -0,0 +1,770 @@
+/*
+
+File: vectorLinkedList.cpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#ifndef VECTOR_LINKED_LIST_TPP
+#define VECTOR_LINKED_LIST_TPP
+
+#include <stdexcept>
+#include "vectorLinkedList.hpp"
+
+/*******************************************************************************
+CONSTRUCTORS
+*******************************************************************************/
+
+// Default
+template <typename T>
+VectorLinkedList<T>::VectorLinkedList() noexcept
+    : slots(nullptr), head(null_index()), tail(null_index()), free_list(null_index()),
+      unused(0), slot_count(0), count(0) {}
+
+// Fill
+template <typename T>
+VectorLinkedList<T>::VectorLinkedList(size_type count, const_reference data)
+    : VectorLinkedList()
+{
+    reserve(count);
+    for (; count > 0; --count)
+    {
+        push_back(data);
+    }
+}
+
+// Range
+template <typename T>
+template <typename InputIterator, typename ::std::enable_if< ::std::is_constructible
+         < T, decltype(*::std::declval<InputIterator>()) >::value >::type* >
+VectorLinkedList<T>::VectorLinkedList(InputIterator begin, InputIterator end)
+    : VectorLinkedList()
+{
+    for (; begin != end; ++begin)
+    {
+        push_back(*begin);
+    }
+}
+
+// Copy
+template <typename T>
+VectorLinkedList<T>::VectorLinkedList(const VectorLinkedList& origin)
+    : VectorLinkedList()
+{
+    *this = origin;
+}
+
+// Move
+template <typename T>
+VectorLinkedList<T>::VectorLinkedList(VectorLinkedList&& origin) noexcept
+    : VectorLinkedList()
+{
+    swap(origin);
+}
+
+// Initializer List
+template <typename T>
+VectorLinkedList<T>::VectorLinkedList(std::initializer_list<value_type> init)
+    : VectorLinkedList()
+{
+    reserve(init.size());
+    for (const_reference value : init)
+    {
+        push_back(value);
+    }
+}
+
+// Destructor
+template <typename T>
+VectorLinkedList<T>::~VectorLinkedList()
+{
+    clear();
+    std::allocator<slot>().deallocate(slots, slot_count);
+}
+
+/*******************************************************************************
+ITERATORS
+*******************************************************************************/
+
+template <typename T>
+typename VectorLinkedList<T>::const_iterator VectorLinkedList<T>::cbegin() const noexcept
+{
+    return const_iterator(this, head);
+}
+
+template <typename T>
+typename VectorLinkedList<T>::const_iterator VectorLinkedList<T>::begin() const noexcept
+{
+    return cbegin();
+}
+
+template <typename T>
+typename VectorLinkedList<T>::iterator VectorLinkedList<T>::begin() noexcept
+{
+    return iterator(this, head);
+}
+
+template <typename T>
+typename VectorLinkedList<T>::const_iterator VectorLinkedList<T>::cend() const noexcept
+{
+    return const_iterator(this, null_index());
+}
+
+template <typename T>
+typename VectorLinkedList<T>::const_iterator VectorLinkedList<T>::end() const noexcept
+{
+    return cend();
+}
+
+template <typename T>
+typename VectorLinkedList<T>::iterator VectorLinkedList<T>::end() noexcept
+{
+    return iterator(this, null_index());
+}
+
+/*******************************************************************************
+ELEMENT ACCESS
+*******************************************************************************/
+
+template <typename T>
+T& VectorLinkedList<T>::front()
+{
+    return slots[head].value;
+}
+
+template <typename T>
+const T& VectorLinkedList<T>::front() const
+{
+    return slots[head].value;
+}
+
+template <typename T>
+T& VectorLinkedList<T>::back()
+{
+    return slots[tail].value;
+}
+
+template <typename T>
+const T& VectorLinkedList<T>::back() const
+{
+    return slots[tail].value;
+}
+
+/*******************************************************************************
+MODIFIERS
+*******************************************************************************/
+
+template <typename T>
+void VectorLinkedList<T>::push_front(const_reference data)
+{
+    link_after(null_index(), acquire(data));
+    return;
+}
+
+template <typename T>
+void VectorLinkedList<T>::push_back(const_reference data)
+{
+    link_after(tail, acquire(data));
+    return;
+}
+
+template <typename T>
+void VectorLinkedList<T>::pop_front()
+{
+    if (empty()) { return; }
+
+    index_type first = head;
+    head = slots[first].next;
+
+    if (head == null_index())
+    {
+        tail = null_index();
+    }
+
+    release(first);
+    return;
+}
+
+template <typename T>
+T& VectorLinkedList<T>::pop_front(reference out_data)
+{
+    if (empty()) { return out_data; }
+
+    out_data = front();
+    pop_front();
+    return out_data;
+}
+
+template <typename T>
+void VectorLinkedList<T>::pop_back()
+{
+    if (empty()) { return; }
+
+    iterator position(this, tail);
+    erase(position);
+    return;
+}
+
+template <typename T>
+T& VectorLinkedList<T>::pop_back(reference out_data)
+{
+    if (empty()) { return out_data; }
+
+    out_data = back();
+    pop_back();
+    return out_data;
+}
+
+template <typename T>
+void VectorLinkedList<T>::insert(const_iterator& position, const_reference data)
+{
+    // Into an empty list the element goes first and position comes to it
+    const index_type previous = empty() ? null_index() : position.index;
+
+    link_after(previous, acquire(data));
+    if (previous == null_index())
+    {
+        position = cbegin();
+    }
+    return;
+}
+
+template <typename T>
+void VectorLinkedList<T>::insert(const_iterator position, size_type n, const_reference data)
+{
+    reserve(count + n);
+    for (; n > 0; --n)
+    {
+        insert(position, data);
+        ++position;
+    }
+    return;
+}
+
+template <typename T>
+template <typename InputIterator, typename ::std::enable_if< ::std::is_constructible
+         < T, decltype(*::std::declval<InputIterator>()) >::value >::type* >
+void VectorLinkedList<T>::insert(const_iterator position, InputIterator begin, InputIterator end)
+{
+    for (; begin != end; ++begin)
+    {
+        insert(position, *begin);
+        ++position;
+    }
+    return;
+}
+
+template <typename T>
+typename VectorLinkedList<T>::iterator VectorLinkedList<T>::erase(iterator& position)
+{
+    if (empty() || position.index == null_index()) { return position; }
+
+    index_type target = position.index;
+    index_type previous = null_index();
+
+    if (target == head)
+    {
+        head = slots[target].next;
+    }
+    else
+    {
+        previous = head;
+        while (slots[previous].next != target)
+        {
+            previous = slots[previous].next;
+        }
+        slots[previous].next = slots[target].next;
+    }
+
+    if (target == tail)
+    {
+        tail = previous;
+    }
+
+    position = iterator(this, slots[target].next);
+
+    release(target);
+    return position;
+}
+
+template <typename T>
+typename VectorLinkedList<T>::iterator VectorLinkedList<T>::erase(iterator& first, iterator& last)
+{
+    while (first != last)
+    {
+        first = erase(first);
+    }
+
+    return first;
+}
+
+template <typename T>
+void VectorLinkedList<T>::clear() noexcept
+{
+    // Values without a destructor to run are dropped without walking them
+    if (!std::is_trivially_destructible<T>::value)
+    {
+        for (index_type index = head; index != null_index(); index = slots[index].next)
+        {
+            slots[index].value.~T();
+        }
+    }
+
+    head = null_index();
+    tail = null_index();
+    free_list = null_index();
+    unused = 0;
+    count = 0;
+    return;
+}
+
+/*******************************************************************************
+CAPACITY
+*******************************************************************************/
+
+template <typename T>
+bool VectorLinkedList<T>::empty() const noexcept
+{
+    return count == 0;
+}
+
+template <typename T>
+size_t VectorLinkedList<T>::size() const noexcept
+{
+    return count;
+}
+
+template <typename T>
+size_t VectorLinkedList<T>::capacity() const noexcept
+{
+    return slot_count;
+}
+
+template <typename T>
+void VectorLinkedList<T>::reserve(size_type n)
+{
+    if (n <= slot_count) { return; }
+    if (n > max_size())
+    {
+        throw std::length_error("VectorLinkedList holds at most 2^32 - 2 elements");
+    }
+
+    reallocate(static_cast<index_type>(n));
+    return;
+}
+
+template <typename T>
+size_t VectorLinkedList<T>::memory_usage() const
+{
+    size_type bytes = sizeof(*this);
+
+    if (slots != nullptr)
+    {
+        bytes += footprint::allocated_size(slot_count * sizeof(slot));
+    }
+
+    for (const_iterator it = cbegin(); it != cend(); ++it)
+    {
+        bytes += footprint::value_bytes(*it);
+    }
+
+    return bytes;
+}
+
+/*******************************************************************************
+OPERATIONS
+*******************************************************************************/
+
+template <typename T>
+void VectorLinkedList<T>::reverse() noexcept
+{
+    index_type previous = null_index();
+    index_type current = head;
+
+    while (current != null_index())
+    {
+        index_type next = slots[current].next;
+        slots[current].next = previous;
+        previous = current;
+        current = next;
+    }
+
+    tail = head;
+    head = previous;
+    return;
+}
+
+template <typename T>
+void VectorLinkedList<T>::remove(const_reference target)
+{
+    remove_if([&target] (const_reference value) { return value == target; });
+    return;
+}
+
+template <typename T>
+template <class Predicate>
+void VectorLinkedList<T>::remove_if(Predicate pred)
+{
+    index_type current = head;
+    head = null_index();
+    tail = null_index();
+
+    try
+    {
+        while (current != null_index())
+        {
+            index_type next = slots[current].next;
+            if (pred(slots[current].value))
+            {
+                release(current);
+            }
+            else
+            {
+                if (tail == null_index()) { head = current; }
+                else { slots[tail].next = current; }
+                tail = current;
+            }
+            current = next;
+        }
+    }
+    catch (...)
+    {
+        // The element pred threw on and the ones after it are kept
+        if (tail == null_index()) { head = current; }
+        else { slots[tail].next = current; }
+        for (tail = current; slots[tail].next != null_index(); tail = slots[tail].next) {}
+        throw;
+    }
+
+    if (tail != null_index()) { slots[tail].next = null_index(); }
+    return;
+}
+
+template <typename T>
+typename VectorLinkedList<T>::iterator VectorLinkedList<T>::find(const_reference target)
+{
+    return find_if([&target](const_reference value) { return value == target; });
+}
+
+template <typename T>
+template <class Predicate>
+typename VectorLinkedList<T>::iterator VectorLinkedList<T>::find_if(Predicate pred)
+{
+    iterator it = begin();
+    while (it != end() && !pred(*it))
+    {
+        ++it;
+    }
+    return it;
+}
+
+template <typename T>
+void VectorLinkedList<T>::unique()
+{
+    std::unordered_set<T> seen;
+    remove_if([&seen](const_reference value) { return !seen.insert(value).second; });
+    return;
+}
+
+template <typename T>
+template <class Comparator>
+void VectorLinkedList<T>::sort(Comparator compare)
+{
+    if (count < 2) { return; }
+
+    // Bottom up merge sort: runs of width 1, 2, 4, ... are merged in pairs
+    for (size_type width = 1; width < count; width *= 2)
+    {
+        index_type rest = head;
+        head = null_index();
+        tail = null_index();
+
+        while (rest != null_index())
+        {
+            index_type left = rest;
+            index_type right = split(left, width);
+            rest = split(right, width);
+
+            index_type last = null_index();
+            index_type run = merge(left, right, compare, last);
+
+            if (tail == null_index()) { head = run; }
+            else { slots[tail].next = run; }
+            tail = last;
+        }
+    }
+    return;
+}
+
+template <typename T>
+void VectorLinkedList<T>::sort()
+{
+    sort([](const_reference lhs, const_reference rhs) { return lhs < rhs; });
+}
+
+/*******************************************************************************
+OPERATOR OVERLOADS
+*******************************************************************************/
+
+template <typename T>
+bool VectorLinkedList<T>::operator==(const VectorLinkedList& rhs) const
+{
+    if (count != rhs.count) { return false; }
+
+    const_iterator right = rhs.cbegin();
+    for (const_iterator left = cbegin(); left != cend(); ++left, ++right)
+    {
+        if (*left != *right) { return false; }
+    }
+    return true;
+}
+
+template <typename T>
+bool VectorLinkedList<T>::operator!=(const VectorLinkedList& rhs) const
+{
+    return !(*this == rhs);
+}
+
+template <typename T>
+VectorLinkedList<T>& VectorLinkedList<T>::operator=(const VectorLinkedList& rhs)
+{
+    if (this == &rhs) { return *this; }
+
+    clear();
+    if (std::is_trivially_copyable<T>::value)
+    {
+        copy_slots(rhs);
+        return *this;
+    }
+
+    reserve(rhs.count);
+    for (const_iterator it = rhs.cbegin(); it != rhs.cend(); ++it)
+    {
+        push_back(*it);
+    }
+    return *this;
+}
+
+template <typename T>
+VectorLinkedList<T>& VectorLinkedList<T>::operator=(VectorLinkedList&& rhs) noexcept
+{
+    if (this != &rhs)
+    {
+        clear();
+        swap(rhs);
+    }
+    return *this;
+}
+
+template <typename T>
+void VectorLinkedList<T>::swap(VectorLinkedList& other) noexcept
+{
+    std::swap(slots, other.slots);
+    std::swap(head, other.head);
+    std::swap(tail, other.tail);
+    std::swap(free_list, other.free_list);
+    std::swap(unused, other.unused);
+    std::swap(slot_count, other.slot_count);
+    std::swap(count, other.count);
+}
+
+/*******************************************************************************
+HELPER FUNCTIONS
+*******************************************************************************/
+
+template <typename T>
+template <typename Value>
+typename VectorLinkedList<T>::index_type VectorLinkedList<T>::acquire(Value&& value)
+{
+    index_type index = free_list;
+
+    if (index == null_index() && unused == slot_count)
+    {
+        if (slot_count == max_size())
+        {
+            throw std::length_error("VectorLinkedList holds at most 2^32 - 2 elements");
+        }
+
+        // Doubles, without passing the largest index
+        size_type doubled = (slot_count == 0) ? 8 : size_type(slot_count) * 2;
+        index_type n = static_cast<index_type>((doubled < max_size()) ? doubled : max_size());
+
+        // value may be an element of this list, so it is constructed in the
+        // new array before the old one is moved out and freed
+        std::allocator<slot> allocator;
+        slot* grown = allocator.allocate(n);
+        try
+        {
+            ::new (static_cast<void*>(&grown[unused].value)) T(std::forward<Value>(value));
+        }
+        catch (...)
+        {
+            allocator.deallocate(grown, n);
+            throw;
+        }
+
+        move_slots(grown, n);
+        ++count;
+        return unused++;
+    }
+
+    if (index != null_index())
+    {
+        free_list = slots[index].next;
+    }
+    else
+    {
+        index = unused++;
+    }
+
+    ::new (static_cast<void*>(&slots[index].value)) T(std::forward<Value>(value));
+    ++count;
+    return index;
+}
+
+template <typename T>
+void VectorLinkedList<T>::release(index_type index) noexcept
+{
+    slots[index].value.~T();
+    slots[index].next = free_list;
+    free_list = index;
+    --count;
+}
+
+template <typename T>
+void VectorLinkedList<T>::link_after(index_type previous, index_type index) noexcept
+{
+    if (previous == null_index())
+    {
+        slots[index].next = head;
+        head = index;
+    }
+    else
+    {
+        slots[index].next = slots[previous].next;
+        slots[previous].next = index;
+    }
+
+    if (slots[index].next == null_index())
+    {
+        tail = index;
+    }
+}
+
+template <typename T>
+void VectorLinkedList<T>::reallocate(index_type n)
+{
+    move_slots(std::allocator<slot>().allocate(n), n);
+}
+
+template <typename T>
+void VectorLinkedList<T>::move_slots(slot* grown, index_type n)
+{
+    if (std::is_trivially_copyable<T>::value)
+    {
+        if (unused > 0) { std::memcpy(static_cast<void*>(grown), slots, unused * sizeof(slot)); }
+    }
+    else
+    {
+        // Free slots hold no value, only their links are carried over
+        for (index_type index = 0; index < unused; ++index)
+        {
+            grown[index].next = slots[index].next;
+        }
+        for (index_type index = head; index != null_index(); index = slots[index].next)
+        {
+            ::new (static_cast<void*>(&grown[index].value)) T(std::move(slots[index].value));
+            slots[index].value.~T();
+        }
+    }
+
+    std::allocator<slot>().deallocate(slots, slot_count);
+    slots = grown;
+    slot_count = n;
+}
+
+template <typename T>
+void VectorLinkedList<T>::copy_slots(const VectorLinkedList& origin)
+{
+    if (slot_count < origin.unused)
+    {
+        std::allocator<slot>().deallocate(slots, slot_count);
+        slots = nullptr;
+        slot_count = 0;
+        reallocate(origin.unused);
+    }
+
+    if (origin.unused > 0)
+    {
+        std::memcpy(static_cast<void*>(slots), origin.slots, origin.unused * sizeof(slot));
+    }
+
+    head = origin.head;
+    tail = origin.tail;
+    free_list = origin.free_list;
+    unused = origin.unused;
+    count = origin.count;
+}
+
+template <typename T>
+template <class Comparator>
+typename VectorLinkedList<T>::index_type
+VectorLinkedList<T>::merge(index_type left, index_type right, Comparator& compare, index_type& last)
+{
+    index_type first = null_index();
+    last = null_index();
+
+    // Ties take the left element first so sorting stays stable
+    while (left != null_index() && right != null_index())
+    {
+        index_type next = null_index();
+        if (compare(slots[right].value, slots[left].value))
+        {
+            next = right;
+            right = slots[right].next;
+        }
+        else
+        {
+            next = left;
+            left = slots[left].next;
+        }
+
+        if (last == null_index()) { first = next; }
+        else { slots[last].next = next; }
+        last = next;
+    }
+
+    index_type rest = (left != null_index()) ? left : right;
+    if (last == null_index()) { first = rest; last = rest; }
+    else { slots[last].next = rest; }
+
+    while (last != null_index() && slots[last].next != null_index())
+    {
+        last = slots[last].next;
+    }
+    return first;
+}
+
+template <typename T>
+typename VectorLinkedList<T>::index_type
+VectorLinkedList<T>::split(index_type first, size_type length) noexcept
+{
+    for (size_type i = 1; i < length && first != null_index(); ++i)
+    {
+        first = slots[first].next;
+    }
+    if (first == null_index()) { return null_index(); }
+
+    index_type rest = slots[first].next;
+    slots[first].next = null_index();
+    return rest;
+}
+
+#endif // VECTOR_LINKED_LIST_TPP
@@ -0,0 +1,295 @@
+/*
+
+File: vectorLinkedList.hpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+/*
+A singly linked list whose nodes share one contiguous array that grows like
+a std::vector. Each node is its value and a 32 bit index of the next one,
+where a Node<T> carries a 64 bit pointer, and elements pushed in order sit
+next to each other, so walking the list mostly reads memory sequentially.
+Slots given up by pop, erase or remove_if go on a free list and are taken
+again first.
+
+When the array is full it is reallocated at twice the size. The values are
+moved to the same indices in the new array, bytes are copied for trivially
+copyable T, and copying a list of trivially copyable T is a single memcpy
+of the array.
+
+Iterators hold the list and an index, so they stay valid when the array
+grows, as long as the element they refer to is not erased. References and
+pointers to the values do not survive growth, like those into a std::vector;
+reserve() ahead of time keeps them valid until the size passes capacity().
+Moving or swapping a list hands its array over and invalidates iterators.
+
+The list has the operations of LinkedList without the parallel ones, and
+insert(position, value) inserts after position in the same way. It holds at
+most 2^32 - 2 elements.
+*/
+
+#ifndef VECTOR_LINKED_LIST_H
+#define VECTOR_LINKED_LIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include "memoryFootprint.hpp"
+
+template<typename T>
+class VectorLinkedList
+{
+public:
+
+    /* Type Defs */
+    typedef size_t size_type;
+    typedef T value_type;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef std::uint32_t index_type;
+
+    // Value is T for iterator and const T for const_iterator
+    template <typename Value>
+    class basic_iterator
+    {
+    public:
+
+        typedef Value value_type;
+        typedef Value& reference;
+        typedef Value* pointer;
+        typedef std::ptrdiff_t difference_type;
+        typedef std::forward_iterator_tag iterator_category;
+        typedef basic_iterator self_type;
+
+        basic_iterator() : list(nullptr), index(null_index()) {}
+
+        // An iterator converts to a const_iterator
+        template <typename Other, typename = typename std::enable_if
+                 < std::is_same<Value, const Other>::value >::type>
+        basic_iterator(const basic_iterator<Other>& other)
+            : list(other.list), index(other.index) {}
+
+        self_type& operator++()
+        {
+            index = list->slots[index].next;
+            return *this;
+        }
+
+        self_type operator++(int)
+        {
+            self_type previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        reference operator*() const { return list->slots[index].value; }
+        pointer operator->() const { return &list->slots[index].value; }
+
+        bool operator==(const self_type& rhs) const { return index == rhs.index; }
+        bool operator!=(const self_type& rhs) const { return index != rhs.index; }
+
+        friend class VectorLinkedList;
+        template <typename> friend class basic_iterator;
+
+    private:
+
+        typedef typename std::conditional<std::is_const<Value>::value,
+                const VectorLinkedList, VectorLinkedList>::type list_type;
+
+        basic_iterator(list_type* list, index_type index) : list(list), index(index) {}
+
+        list_type* list;
+        index_type index;
+    };
+
+    typedef basic_iterator<T> iterator;
+    typedef basic_iterator<const T> const_iterator;
+
+    /* Constructors */
+
+    // Default, allocates nothing
+    VectorLinkedList() noexcept;
+
+    // Fill
+    VectorLinkedList(size_type count, const_reference data);
+
+    // Range
+    template <typename InputIterator, typename ::std::enable_if< ::std::is_constructible
+             < T, decltype(*::std::declval<InputIterator>()) >::value >::type* = nullptr >
+    VectorLinkedList(InputIterator begin, InputIterator end);
+
+    // Copy
+    VectorLinkedList(const VectorLinkedList& origin);
+
+    // Move, takes the array and leaves origin empty
+    VectorLinkedList(VectorLinkedList&& origin) noexcept;
+
+    // Initializer List
+    explicit VectorLinkedList(std::initializer_list<value_type> init);
+
+    // Destructor
+    ~VectorLinkedList();
+
+    /* Iterators */
+    const_iterator cbegin() const noexcept;
+    const_iterator begin() const noexcept;
+    iterator begin() noexcept;
+
+    const_iterator cend() const noexcept;
+    const_iterator end() const noexcept;
+    iterator end() noexcept;
+
+    /* Element Access */
+    reference front();
+    const_reference front() const;
+    reference back();
+    const_reference back() const;
+
+    /* Modifiers */
+    void push_front(const_reference data);
+    void push_back(const_reference data);
+
+    void pop_front();
+    reference pop_front(reference out_data);
+    void pop_back();
+    reference pop_back(reference out_data);
+
+    void insert(const_iterator& position, const_reference data);
+    void insert(const_iterator position, size_type n, const_reference data);
+    template <typename InputIterator, typename ::std::enable_if< ::std::is_constructible
+             < T, decltype(*::std::declval<InputIterator>()) >::value >::type* = nullptr >
+    void insert(const_iterator position, InputIterator begin, InputIterator end);
+
+    iterator erase(iterator& position);
+    iterator erase(iterator& first, iterator& last);
+
+    // Destroys the values and keeps the array for reuse
+    void clear() noexcept;
+
+    /* Capacity */
+    bool empty() const noexcept;
+    size_type size() const noexcept;
+
+    // Slots in the array, the size the list reaches before it reallocates
+    size_type capacity() const noexcept;
+
+    // Grows the array to at least n slots
+    void reserve(size_type n);
+
+    static constexpr size_type max_size() noexcept { return 0xFFFFFFFEu; }
+
+    // Bytes held by the list: the list object, the array with the
+    // allocator's overhead, and the memory the values own
+    size_type memory_usage() const;
+
+    /* Operations */
+    void reverse() noexcept;
+
+    void remove(const_reference target);
+    template <class Predicate>
+    void remove_if(Predicate pred);
+
+    iterator find(const_reference target);
+    template <class Predicate>
+    iterator find_if(Predicate pred);
+
+    // Keeps the first occurrence of every value, T must be hashable
+    void unique();
+
+    template <class Comparator>
+    void sort(Comparator compare);
+    void sort();
+
+    /* Operator Overloads */
+    bool operator==(const VectorLinkedList& rhs) const;
+    bool operator!=(const VectorLinkedList& rhs) const;
+    VectorLinkedList& operator=(const VectorLinkedList& rhs);
+    VectorLinkedList& operator=(VectorLinkedList&& rhs) noexcept;
+
+    /* Swap */
+    void swap(VectorLinkedList& other) noexcept;
+
+private:
+
+    // Raw room for one value, constructed and destroyed by the list, next
+    // to the index of the slot that follows it
+    struct slot
+    {
+        slot() noexcept {}
+        ~slot() {}
+
+        union
+        {
+            T value;
+        };
+        index_type next;
+    };
+
+    static constexpr index_type null_index() noexcept { return index_type(-1); }
+
+    slot* slots;
+
+    index_type head;
+    index_type tail;
+
+    // First slot of the free list, linked through next like the elements
+    index_type free_list;
+
+    // Slots from unused on have never been taken
+    index_type unused;
+
+    index_type slot_count;
+
+    size_type count;
+
+    /* Helper functions */
+
+    // Constructs value in a free slot, growing the array when there is none,
+    // and returns its index
+    template <typename Value>
+    index_type acquire(Value&& value);
+
+    // Destroys the value in a slot and puts the slot on the free list
+    void release(index_type index) noexcept;
+
+    // Links an acquired slot in after previous, at the front when previous
+    // is the null index
+    void link_after(index_type previous, index_type index) noexcept;
+
+    // Moves every slot into a new array of n slots at the same index
+    void reallocate(index_type n);
+
+    // Moves every slot into grown, an array of n slots, at the same index and
+    // frees the old array
+    void move_slots(slot* grown, index_type n);
+
+    // Copies origin's array as bytes into this empty list
+    void copy_slots(const VectorLinkedList& origin);
+
+    template <class Comparator>
+    index_type merge(index_type left, index_type right, Comparator& compare, index_type& last);
+
+    // Cuts the chain at first after length elements and returns the rest
+    index_type split(index_type first, size_type length) noexcept;
+};
+
+#include "vectorLinkedList.cpp"
+
+#endif // VECTOR_LINKED_LIST_H
@@ -0,0 +1,173 @@
+/*
+
+File: workStealingDeque.cpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+// Implementation for WorkStealingDeque
+
+#ifndef WORK_STEALING_DEQUE_TPP
+#define WORK_STEALING_DEQUE_TPP
+
+#include "workStealingDeque.hpp"
+
+/*******************************************************************************
+BUFFER
+*******************************************************************************/
+
+template <typename T>
+WorkStealingDeque<T>::buffer::buffer(size_t capacity)
+    : mask(capacity - 1), items(new std::atomic<T>[capacity]) {}
+
+template <typename T>
+size_t WorkStealingDeque<T>::buffer::capacity() const
+{
+    return mask + 1;
+}
+
+template <typename T>
+T WorkStealingDeque<T>::buffer::get(int64_t index) const
+{
+    return items[static_cast<size_t>(index) & mask].load(std::memory_order_relaxed);
+}
+
+template <typename T>
+void WorkStealingDeque<T>::buffer::put(int64_t index, T item)
+{
+    items[static_cast<size_t>(index) & mask].store(item, std::memory_order_relaxed);
+}
+
+template <typename T>
+typename WorkStealingDeque<T>::buffer*
+WorkStealingDeque<T>::buffer::grow(int64_t top, int64_t bottom) const
+{
+    buffer* larger = new buffer(capacity() * 2);
+    for (int64_t i = top; i < bottom; ++i)
+    {
+        larger->put(i, get(i));
+    }
+    return larger;
+}
+
+/*******************************************************************************
+CONSTRUCTORS
+*******************************************************************************/
+
+template <typename T>
+WorkStealingDeque<T>::WorkStealingDeque(size_t capacity) : top(0), bottom(0)
+{
+    // Indices wrap with a mask, the capacity has to be a power of two
+    size_t rounded = 1;
+    while (rounded < capacity)
+    {
+        rounded *= 2;
+    }
+
+    buffers.emplace_back(new buffer(rounded));
+    array.store(buffers.back().get());
+}
+
+/*******************************************************************************
+OWNER OPERATIONS
+*******************************************************************************/
+
+template <typename T>
+void WorkStealingDeque<T>::push(T item)
+{
+    int64_t b = bottom.load(std::memory_order_relaxed);
+    int64_t t = top.load(std::memory_order_acquire);
+    buffer* a = array.load(std::memory_order_relaxed);
+
+    if (b - t > static_cast<int64_t>(a->capacity()) - 1)
+    {
+        a = a->grow(t, b);
+        buffers.emplace_back(a);
+        array.store(a, std::memory_order_release);
+    }
+
+    a->put(b, item);
+
+    // Publishes the item to thieves
+    bottom.store(b + 1, std::memory_order_seq_cst);
+    return;
+}
+
+template <typename T>
+bool WorkStealingDeque<T>::pop(T& item)
+{
+    int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+    buffer* a = array.load(std::memory_order_relaxed);
+
+    // Claim the bottom slot before looking at top, both sequentially consistent
+    bottom.store(b, std::memory_order_seq_cst);
+    int64_t t = top.load(std::memory_order_seq_cst);
+
+    if (t > b)
+    {
+        bottom.store(b + 1, std::memory_order_relaxed);
+        return false;
+    }
+
+    item = a->get(b);
+    if (t < b) { return true; }
+
+    // Last item, race the thieves for it
+    bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                           std::memory_order_relaxed);
+    bottom.store(b + 1, std::memory_order_relaxed);
+    return won;
+}
+
+/*******************************************************************************
+THIEF OPERATIONS
+*******************************************************************************/
+
+template <typename T>
+bool WorkStealingDeque<T>::steal(T& item)
+{
+    int64_t t = top.load(std::memory_order_seq_cst);
+    int64_t b = bottom.load(std::memory_order_seq_cst);
+
+    if (t >= b) { return false; }
+
+    buffer* a = array.load(std::memory_order_acquire);
+    T stolen = a->get(t);
+
+    if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                     std::memory_order_relaxed))
+    {
+        // Lost to the owner or another thief
+        return false;
+    }
+
+    item = stolen;
+    return true;
+}
+
+/*******************************************************************************
+CAPACITY
+*******************************************************************************/
+
+template <typename T>
+bool WorkStealingDeque<T>::empty() const
+{
+    return size() == 0;
+}
+
+template <typename T>
+size_t WorkStealingDeque<T>::size() const
+{
+    int64_t b = bottom.load(std::memory_order_relaxed);
+    int64_t t = top.load(std::memory_order_relaxed);
+    return (b > t) ? static_cast<size_t>(b - t) : 0;
+}
+
+#endif // WORK_STEALING_DEQUE_TPP
@@ -0,0 +1,86 @@
+/*
+
+File: workStealingDeque.hpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+/*
+WorkStealingDeque is the lock-free deque of Chase and Lev ("Dynamic Circular
+Work-Stealing Deque", SPAA 2005). A single owner thread pushes and pops at the
+bottom, any number of thieves steal from the top. T is meant to be a pointer or
+another small trivially copyable type.
+
+The buffer grows when full. Retired buffers are kept until the deque is
+destroyed because a thief may still be reading from one.
+*/
+
+#ifndef WORK_STEALING_DEQUE_H
+#define WORK_STEALING_DEQUE_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+template <typename T>
+class WorkStealingDeque
+{
+public:
+
+    /* Constructors */
+    explicit WorkStealingDeque(size_t capacity = 64);
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    /* Owner operations */
+    void push(T item);
+    bool pop(T& item);
+
+    /* Thief operations */
+    bool steal(T& item);
+
+    /* Capacity */
+    bool empty() const;
+    size_t size() const;
+
+private:
+
+    class buffer
+    {
+    public:
+
+        explicit buffer(size_t capacity);
+
+        size_t capacity() const;
+
+        T get(int64_t index) const;
+        void put(int64_t index, T item);
+
+        // Copies [top, bottom) into a buffer twice the size
+        buffer* grow(int64_t top, int64_t bottom) const;
+
+    private:
+
+        size_t mask;
+        std::unique_ptr<std::atomic<T>[]> items;
+    };
+
+    std::atomic<int64_t> top;
+    std::atomic<int64_t> bottom;
+    std::atomic<buffer*> array;
+
+    std::vector<std::unique_ptr<buffer> > buffers;
+};
+
+#include "workStealingDeque.cpp"
+
+#endif // WORK_STEALING_DEQUE_H
@@ -0,0 +1,42 @@
+/*
+
+File: allocationAssertions.hpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+// Catch assertions on the heap allocations an expression makes, the counts
+// come from the hooks of allocationCounter.hpp installed by allocationTest.cpp
+
+#ifndef ALLOCATION_ASSERTIONS_H
+#define ALLOCATION_ASSERTIONS_H
+
+#include "allocationCounter.hpp"
+#include "catch.hpp"
+
+#define REQUIRE_ALLOCATION_COUNT(operation, field, n)                                        \
+    do                                                                                       \
+    {                                                                                        \
+        REQUIRE(allocation::hooks_installed());                                              \
+        allocation::counts counted_ = allocation::count([&]() { operation; });               \
+        INFO(#operation << " made " << counted_.allocations << " allocations of "            \
+             << counted_.bytes << " bytes and " << counted_.frees << " frees");              \
+        REQUIRE(counted_.field == static_cast<size_t>(n));                                   \
+    } while (false)
+
+// The operation allocates exactly n times
+#define REQUIRE_ALLOCATIONS(operation, n) REQUIRE_ALLOCATION_COUNT(operation, allocations, n)
+
+// The operation frees exactly n times
+#define REQUIRE_FREES(operation, n) REQUIRE_ALLOCATION_COUNT(operation, frees, n)
+
+#define REQUIRE_NO_ALLOCATIONS(operation) REQUIRE_ALLOCATIONS(operation, 0)
+
+#endif // ALLOCATION_ASSERTIONS_H
@@ -0,0 +1,160 @@
+/*
+
+File: allocationTest.cpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+// Installs the allocation counting hooks for the whole runTests binary
+#define ALLOCATION_COUNTER_HOOKS
+
+#include <functional>
+#include <new>
+#include <vector>
+#include "allocationAssertions.hpp"
+#include "catch.hpp"
+#include "linkedList.hpp"
+
+TEST_CASE("Counting allocations", "[allocations]")
+{
+    SECTION("Counts are kept for the calling thread")
+    {
+        allocation::counts counted = allocation::count([]() { delete new int(1); });
+
+        REQUIRE(counted.allocations == 1);
+        REQUIRE(counted.frees == 1);
+        REQUIRE(counted.bytes == sizeof(int));
+    }
+    SECTION("The nothrow forms are counted and freed by the matching delete")
+    {
+        allocation::counts counted = allocation::count([]()
+        {
+            int* single = new (std::nothrow) int(1);
+            int* array = new (std::nothrow) int[4];
+            delete single;
+            delete[] array;
+        });
+
+        REQUIRE(counted.allocations == 2);
+        REQUIRE(counted.frees == 2);
+        REQUIRE(counted.bytes >= 5 * sizeof(int));
+    }
+    SECTION("A node holds its data without a second allocation")
+    {
+        REQUIRE_NO_ALLOCATIONS(Node<int> node(1));
+        REQUIRE_ALLOCATIONS(delete new Node<int>(1), 1);
+    }
+}
+
+TEST_CASE("Constructing a list allocates its nodes in one block", "[allocations], [constructors]")
+{
+    std::vector<int> values(20, 5);
+    LinkedList<int> origin(values.begin(), values.end());
+
+    // The block, its bookkeeping and the vector holding it
+    REQUIRE_NO_ALLOCATIONS(LinkedList<int> list);
+    REQUIRE_ALLOCATIONS(LinkedList<int> list(20, 7), 3);
+    REQUIRE_ALLOCATIONS(LinkedList<int> list(1000, 7), 3);
+    REQUIRE_ALLOCATIONS(LinkedList<int> list(values.begin(), values.end()), 3);
+    REQUIRE_ALLOCATIONS((LinkedList<int> { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 }), 3);
+    REQUIRE_ALLOCATIONS(LinkedList<int> list(origin), 3);
+    REQUIRE_FREES(LinkedList<int> list(origin), 3);
+
+    // A short list is not worth a block
+    REQUIRE_ALLOCATIONS((LinkedList<int> { 1, 2, 3 }), 3);
+    REQUIRE_ALLOCATIONS(LinkedList<int> list(11, 7), 11);
+}
+
+TEST_CASE("Assigning and resizing a list allocate in blocks", "[allocations], [modifiers]")
+{
+    std::vector<int> values(100, 3);
+    LinkedList<int> list { 1, 2 };
+
+    REQUIRE_ALLOCATIONS(list.assign(values.begin(), values.end()), 3);
+    REQUIRE_FREES(list.assign(50, 4), 3);
+    REQUIRE_ALLOCATIONS(list.resize(150), 2);
+    REQUIRE_NO_ALLOCATIONS(list.resize(10));
+    REQUIRE_ALLOCATIONS(list.resize(12), 2);
+    REQUIRE(list.size() == 12);
+}
+
+TEST_CASE("Modifiers allocate once per inserted element", "[allocations], [modifiers]")
+{
+    LinkedList<int> list { 1, 2, 3, 4 };
+    LinkedList<int>::iterator position = list.begin();
+    ++position;
+
+    REQUIRE_ALLOCATIONS(list.push_front(0), 1);
+    REQUIRE_ALLOCATIONS(list.push_back(5), 1);
+    REQUIRE_ALLOCATIONS(list.insert(position, 9), 1);
+    REQUIRE_ALLOCATIONS(list.insert(position, 3, 8), 3);
+    REQUIRE_FREES(list.insert(position, 3, 8), 0);
+
+    std::vector<int> values { 6, 7 };
+    REQUIRE_ALLOCATIONS(list.insert(position, values.begin(), values.end()), 2);
+    REQUIRE_NO_ALLOCATIONS(list.insert(position, values.end(), values.end()));
+
+    LinkedList<int> empty;
+    REQUIRE_ALLOCATIONS(empty.insert(empty.cbegin(), 4, 1), 4);
+    REQUIRE(empty == LinkedList<int> { 1, 1, 1, 1 });
+}
+
+TEST_CASE("Removing elements frees without allocating", "[allocations], [modifiers]")
+{
+    // Nodes pushed one at a time are freed one at a time
+    LinkedList<int> list;
+    for (int i = 1; i <= 8; ++i)
+    {
+        list.push_back(i);
+    }
+    int out = 0;
+
+    REQUIRE_FREES(list.pop_front(), 1);
+    REQUIRE_FREES(list.pop_back(), 1);
+    REQUIRE_NO_ALLOCATIONS(list.pop_front(out));
+    REQUIRE_NO_ALLOCATIONS(list.pop_back(out));
+
+    LinkedList<int>::iterator position = list.begin();
+    REQUIRE_FREES(list.erase(position), 1);
+    REQUIRE_NO_ALLOCATIONS(list.remove(5));
+    REQUIRE_FREES(list.clear(), 2);
+    REQUIRE(list.empty());
+
+    // Nodes in a block are freed with it
+    LinkedList<int> block(16, 1);
+    REQUIRE_NO_ALLOCATIONS(block.pop_front());
+    REQUIRE_FREES(block.pop_front(), 0);
+    REQUIRE_FREES(block.clear(), 3);
+}
+
+TEST_CASE("Operations on a list do not allocate", "[allocations], [operations]")
+{
+    LinkedList<int> list { 5, 3, 1, 4, 2 };
+    LinkedList<int> other { 5, 3, 1, 4, 2 };
+
+    REQUIRE_NO_ALLOCATIONS(list.size());
+    REQUIRE_NO_ALLOCATIONS(list.find(4));
+    REQUIRE_NO_ALLOCATIONS(list == other);
+    REQUIRE_NO_ALLOCATIONS(for (int& value : list) { value += 1; });
+    REQUIRE_NO_ALLOCATIONS(list.sort());
+    REQUIRE_NO_ALLOCATIONS(list.sort(std::greater<int>()));
+    REQUIRE_NO_ALLOCATIONS(list.reverse());
+    REQUIRE_NO_ALLOCATIONS(list.remove_if([](int value) { return value % 2 == 0; }));
+}
+
+TEST_CASE("Assigning a list copies it once", "[allocations], [operators]")
+{
+    LinkedList<int> list { 1, 2, 3 };
+    LinkedList<int> origin(12, 4);
+
+    REQUIRE_ALLOCATIONS(list = origin, 3);
+    REQUIRE_FREES(list = origin, 3);
+    REQUIRE(list == origin);
+}
@@ -0,0 +1,290 @@
+/*
+
+File: compactLinkedListTest.cpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#include <functional>
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "catch.hpp"
+#include "compactLinkedList.hpp"
+#include "linkedList.hpp"
+
+TEST_CASE("A compact list is a single pointer", "[compactLists], [memory]")
+{
+    REQUIRE(sizeof(CompactLinkedList<int>) == sizeof(void*));
+    REQUIRE(sizeof(CompactLinkedList<std::string>) == sizeof(void*));
+    REQUIRE(sizeof(LinkedList<int>) == 3 * sizeof(void*));
+
+    CompactLinkedList<int> list;
+    REQUIRE(list.memory_usage() == sizeof(void*));
+
+    list.push_back(1);
+    REQUIRE(list.memory_usage() == sizeof(void*) + footprint::allocated_size(sizeof(Node<int>)));
+}
+
+TEST_CASE("Constructing compact lists", "[compactLists], [constructors]")
+{
+    SECTION("Default construction")
+    {
+        CompactLinkedList<int> list;
+
+        REQUIRE(list.empty());
+        REQUIRE(list.begin() == list.end());
+        REQUIRE(list.size() == 0);
+    }
+    SECTION("Fill, range and initializer list construction")
+    {
+        std::vector<int> values { 1, 2, 3 };
+
+        CompactLinkedList<int> filled(3, 7);
+        CompactLinkedList<int> ranged(values.begin(), values.end());
+        CompactLinkedList<int> listed { 1, 2, 3 };
+
+        REQUIRE(filled == CompactLinkedList<int> { 7, 7, 7 });
+        REQUIRE(ranged == listed);
+        REQUIRE(listed.front() == 1);
+        REQUIRE(listed.back() == 3);
+    }
+    SECTION("Copies are deep, moves take the nodes")
+    {
+        CompactLinkedList<std::string> origin { "a", "b", "c" };
+        CompactLinkedList<std::string> copy(origin);
+
+        copy.front() = "z";
+        REQUIRE(origin.front() == "a");
+
+        CompactLinkedList<std::string> moved(std::move(origin));
+        REQUIRE(origin.empty());
+        REQUIRE(moved == CompactLinkedList<std::string> { "a", "b", "c" });
+
+        origin = moved;
+        REQUIRE(origin == moved);
+    }
+}
+
+TEST_CASE("Modifying both ends of a compact list", "[compactLists], [modifiers]")
+{
+    CompactLinkedList<int> list;
+
+    SECTION("Pushing to either end")
+    {
+        list.push_back(2);
+        list.push_front(1);
+        list.push_back(3);
+
+        REQUIRE(list == CompactLinkedList<int> { 1, 2, 3 });
+        REQUIRE(list.front() == 1);
+        REQUIRE(list.back() == 3);
+    }
+    SECTION("Popping until empty, then pushing again")
+    {
+        list = CompactLinkedList<int> { 1, 2, 3 };
+        int out = 0;
+
+        list.pop_front();
+        REQUIRE(list.pop_back(out) == 3);
+        list.pop_back();
+        REQUIRE(list.empty());
+
+        list.pop_front();
+        list.pop_back();
+        list.push_back(4);
+        list.push_front(5);
+
+        REQUIRE(list == CompactLinkedList<int> { 5, 4 });
+    }
+}
+
+TEST_CASE("Inserting into and erasing from a compact list", "[compactLists], [modifiers], [iterators]")
+{
+    CompactLinkedList<char> list { 'A', 'B', 'D' };
+
+    SECTION("Insert after a position")
+    {
+        CompactLinkedList<char>::const_iterator position = list.cbegin();
+        ++position;
+
+        list.insert(position, 'C');
+        REQUIRE(list == CompactLinkedList<char> { 'A', 'B', 'C', 'D' });
+    }
+    SECTION("Inserting after the last element moves the back")
+    {
+        CompactLinkedList<char>::const_iterator position = list.begin();
+        ++position;
+        ++position;
+
+        list.insert(position, 'E');
+        list.push_back('F');
+
+        REQUIRE(list.back() == 'F');
+        REQUIRE(list == CompactLinkedList<char> { 'A', 'B', 'D', 'E', 'F' });
+    }
+    SECTION("Inserting into an empty list")
+    {
+        CompactLinkedList<char> empty;
+        CompactLinkedList<char>::const_iterator position = empty.begin();
+
+        empty.insert(position, 'A');
+
+        REQUIRE(*position == 'A');
+        REQUIRE(empty.size() == 1);
+    }
+    SECTION("Erase the first, the last and the only element")
+    {
+        CompactLinkedList<char>::iterator position = list.begin();
+        position = list.erase(position);
+        REQUIRE(*position == 'B');
+
+        ++position;
+        position = list.erase(position);
+        REQUIRE(position == list.end());
+        REQUIRE(list.back() == 'B');
+
+        position = list.begin();
+        list.erase(position);
+        REQUIRE(list.empty());
+
+        list.push_back('X');
+        REQUIRE(list == CompactLinkedList<char> { 'X' });
+    }
+    SECTION("Clearing a list")
+    {
+        list.clear();
+
+        REQUIRE(list.empty());
+        REQUIRE(list.memory_usage() == sizeof(list));
+    }
+}
+
+TEST_CASE("Compact list operations", "[compactLists], [operations]")
+{
+    SECTION("Reverse")
+    {
+        CompactLinkedList<int> list { 1, 2, 3, 4 };
+        CompactLinkedList<int> single { 1 };
+
+        list.reverse();
+        single.reverse();
+
+        REQUIRE(list == CompactLinkedList<int> { 4, 3, 2, 1 });
+        REQUIRE(list.back() == 1);
+        REQUIRE(single == CompactLinkedList<int> { 1 });
+    }
+    SECTION("Remove and remove_if")
+    {
+        CompactLinkedList<int> list { 2, 1, 2, 3, 2 };
+
+        list.remove(2);
+        REQUIRE(list == CompactLinkedList<int> { 1, 3 });
+
+        list.remove_if([](int value) { return value > 0; });
+        REQUIRE(list.empty());
+    }
+    SECTION("Find")
+    {
+        CompactLinkedList<int> list { 1, 2, 3 };
+
+        REQUIRE(*list.find(2) == 2);
+        REQUIRE(list.find(4) == list.end());
+        REQUIRE(*list.find_if([](int value) { return value > 1; }) == 2);
+    }
+    SECTION("Unique keeps the first of each value")
+    {
+        CompactLinkedList<int> list { 3, 1, 3, 2, 1 };
+
+        list.unique();
+
+        REQUIRE(list == CompactLinkedList<int> { 3, 1, 2 });
+        REQUIRE(list.back() == 2);
+    }
+    SECTION("A throwing predicate keeps the elements it did not reach")
+    {
+        CompactLinkedList<int> list { 1, 2, 3, 4, 5, 6 };
+        int calls = 0;
+
+        REQUIRE_THROWS_AS(list.remove_if([&calls](int value)
+        {
+            if (++calls == 4) { throw std::runtime_error("predicate"); }
+            return value % 2 == 0;
+        }), std::runtime_error);
+
+        REQUIRE(list == CompactLinkedList<int> { 1, 3, 4, 5, 6 });
+        REQUIRE(list.back() == 6);
+
+        list.push_back(7);
+        list.remove_if([](int value) { return value % 2 == 0; });
+        REQUIRE(list == CompactLinkedList<int> { 1, 3, 5, 7 });
+    }
+    SECTION("A throwing comparator keeps every element")
+    {
+        CompactLinkedList<int> list { 6, 2, 5, 1, 4, 3 };
+        int calls = 0;
+
+        REQUIRE_THROWS_AS(list.sort([&calls](int lhs, int rhs)
+        {
+            if (++calls == 5) { throw std::runtime_error("compare"); }
+            return lhs < rhs;
+        }), std::runtime_error);
+
+        REQUIRE(list.size() == 6);
+        list.push_front(0);
+        list.sort();
+        REQUIRE(list == CompactLinkedList<int> { 0, 1, 2, 3, 4, 5, 6 });
+        REQUIRE(list.back() == 6);
+    }
+    SECTION("Sort, with and without a comparator")
+    {
+        CompactLinkedList<int> list { 5, 3, 4, 1, 2 };
+
+        list.sort();
+        REQUIRE(list == CompactLinkedList<int> { 1, 2, 3, 4, 5 });
+        REQUIRE(list.back() == 5);
+
+        list.sort(std::greater<int>());
+        REQUIRE(list == CompactLinkedList<int> { 5, 4, 3, 2, 1 });
+    }
+    SECTION("Sorting is stable")
+    {
+        typedef std::pair<int, int> item;
+        CompactLinkedList<item> list { { 2, 0 }, { 1, 1 }, { 2, 2 }, { 1, 3 }, { 0, 4 } };
+
+        list.sort([](const item& lhs, const item& rhs) { return lhs.first < rhs.first; });
+
+        REQUIRE(list == CompactLinkedList<item> { { 0, 4 }, { 1, 1 }, { 1, 3 }, { 2, 0 }, { 2, 2 } });
+    }
+    SECTION("Sort matches std::list on random input")
+    {
+        std::mt19937 random(3);
+        for (int n : { 0, 1, 2, 3, 7, 64, 1000 })
+        {
+            std::list<int> expected;
+            CompactLinkedList<int> list;
+            for (int i = 0; i < n; ++i)
+            {
+                int value = static_cast<int>(random() % 100);
+                expected.push_back(value);
+                list.push_back(value);
+            }
+
+            expected.sort();
+            list.sort();
+
+            REQUIRE(std::equal(expected.begin(), expected.end(), list.begin()));
+            REQUIRE(list.size() == expected.size());
+        }
+    }
+}
@@ -0,0 +1,192 @@
+/*
+
+File: concurrentLinkedListTest.cpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#include <thread>
+#include <vector>
+#include "catch.hpp"
+#include "concurrentLinkedList.hpp"
+
+TEST_CASE("Constructing concurrent lists", "[concurrentLists], [constructors]")
+{
+    SECTION("Default Construction")
+    {
+        ConcurrentLinkedList<int> list;
+
+        REQUIRE(list.empty());
+        REQUIRE(list.begin() == list.end());
+    }
+    SECTION("Initializer List construction")
+    {
+        ConcurrentLinkedList<int> list {1, 2, 3, 4, 5};
+
+        int i = 1;
+        for (auto& element : list)
+        {
+            REQUIRE(element == i);
+            ++i;
+        }
+        REQUIRE(list.size() == 5);
+    }
+    SECTION("Range based construction")
+    {
+        std::vector<int> nums = { 1, 2, 3 };
+        ConcurrentLinkedList<int> list(nums.begin(), nums.end());
+
+        REQUIRE(list.size() == 3);
+        REQUIRE(*list.begin() == 1);
+    }
+    SECTION("Memory held grows with every element")
+    {
+        ConcurrentLinkedList<int> empty;
+        ConcurrentLinkedList<int> list { 1, 2, 3 };
+
+        REQUIRE(empty.memory_usage() == sizeof(ConcurrentLinkedList<int>));
+        REQUIRE(list.memory_usage() > empty.memory_usage() + 3 * sizeof(int));
+        REQUIRE((list.memory_usage() - empty.memory_usage()) % 3 == 0);
+    }
+}
+
+TEST_CASE("Modifying a concurrent list from one thread", "[concurrentLists], [modifiers]")
+{
+    SECTION("push front and push back")
+    {
+        ConcurrentLinkedList<int> list;
+
+        list.push_back(2);
+        list.push_front(1);
+        list.push_back(3);
+
+        int i = 1;
+        for (auto& element : list)
+        {
+            REQUIRE(element == i);
+            ++i;
+        }
+        REQUIRE(list.size() == 3);
+    }
+    SECTION("pop front with and without argument")
+    {
+        ConcurrentLinkedList<int> list {1, 2};
+
+        int x = 0;
+        REQUIRE(list.pop_front(x));
+        REQUIRE(x == 1);
+        REQUIRE(list.pop_front());
+        REQUIRE_FALSE(list.pop_front(x));
+        REQUIRE(list.empty());
+    }
+    SECTION("Insert after a found element")
+    {
+        ConcurrentLinkedList<int> list {1, 2, 4};
+
+        {
+            ConcurrentLinkedList<int>::iterator it = list.find(2);
+            list.insert(it, 3);
+        }
+
+        int i = 1;
+        for (auto& element : list)
+        {
+            REQUIRE(element == i);
+            ++i;
+        }
+        REQUIRE(list.size() == 4);
+    }
+    SECTION("Erase the middle and last elements")
+    {
+        ConcurrentLinkedList<int> list {1, 2, 3};
+
+        {
+            ConcurrentLinkedList<int>::iterator it = list.find(2);
+            list.erase(it);
+            REQUIRE(*it == 3);
+            list.erase(it);
+            REQUIRE(it == list.end());
+        }
+
+        REQUIRE(list.size() == 1);
+        REQUIRE(*list.begin() == 1);
+    }
+    SECTION("remove_if and clear")
+    {
+        ConcurrentLinkedList<int> list {1, 2, 3, 4, 5, 6};
+
+        list.remove_if([](int value) { return value % 2 == 0; });
+
+        int i = 1;
+        for (auto& element : list)
+        {
+            REQUIRE(element == i);
+            i += 2;
+        }
+
+        list.clear();
+        REQUIRE(list.empty());
+        REQUIRE(list.begin() == list.end());
+    }
+    SECTION("find_if on a missing element")
+    {
+        ConcurrentLinkedList<int> list {1, 2, 3};
+
+        REQUIRE(list.find_if([](int value) { return value > 3; }) == list.end());
+    }
+}
+
+TEST_CASE("Modifying a concurrent list from several threads", "[concurrentLists], [threads]")
+{
+    const int threads = 4;
+    const int per_thread = 200;
+
+    ConcurrentLinkedList<int> list {-1, -2};
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([&list, t, per_thread]()
+        {
+            for (int i = 0; i < per_thread; ++i)
+            {
+                int value = t * per_thread + i;
+                if (i % 2 == 0)
+                {
+                    list.push_back(value);
+                }
+                else
+                {
+                    ConcurrentLinkedList<int>::iterator it = list.find(-1);
+                    list.insert(it, value);
+                }
+            }
+            // Every thread removes its own odd values again
+            list.remove_if([t, per_thread](int value)
+            {
+                return value >= 0 && value / per_thread == t && value % 2 != 0;
+            });
+        });
+    }
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    REQUIRE(list.size() == threads * per_thread / 2 + 2);
+
+    size_t counted = 0;
+    for (auto& element : list)
+    {
+        REQUIRE((element < 0 || element % 2 == 0));
+        ++counted;
+    }
+    REQUIRE(counted == list.size());
+}
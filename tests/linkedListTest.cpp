@@ -12,6 +12,16 @@ https://github.com/AlexanderJDupree/LinkedListsCPP
 
 */
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 #include "catch.hpp"
 #include "linkedList.hpp"
@@ -253,6 +263,20 @@ TEST_CASE("Popping front elements")
         REQUIRE(list.empty());
         REQUIRE(x == 2);
     }
+    SECTION("Pop front until the list is empty, then append again")
+    {
+        LinkedList<int> list {1, 2};
+
+        list.pop_front();
+        list.pop_front();
+
+        REQUIRE(list.empty());
+
+        list.push_back(3);
+        list.push_back(4);
+
+        REQUIRE(list == LinkedList<int> {3, 4});
+    }
 }
 
 TEST_CASE("Popping back elements")
@@ -305,6 +329,23 @@ TEST_CASE("Popping back elements")
         REQUIRE(list.empty());
         REQUIRE(x == 2);
     }
+    SECTION("Pop back until the list is empty, then append again")
+    {
+        LinkedList<int> list {1, 2, 3};
+
+        int x = 0;
+        list.pop_back();
+        list.pop_back();
+        list.pop_back(x);
+
+        REQUIRE(x == 1);
+        REQUIRE(list.empty());
+
+        list.push_back(5);
+        list.push_front(4);
+
+        REQUIRE(list == LinkedList<int> {4, 5});
+    }
 }
 
 TEST_CASE("Inserting an element in the list", "[linkedLists], [modifiers], [iterators]")
@@ -447,6 +488,28 @@ TEST_CASE("Erasing portions of a list", "[linkedLists], [modifiers], [iterators]
         REQUIRE(list.empty());
         REQUIRE(It == list.end());
     }
+    SECTION("Append after erasing the last element")
+    {
+        LinkedList<char> list { 'A', 'B', 'C'};
+        LinkedList<char>::iterator It = list.begin();
+        ++It;
+        ++It;
+
+        list.erase(It);
+        list.push_back('D');
+
+        REQUIRE(list == LinkedList<char> { 'A', 'B', 'D' });
+    }
+    SECTION("Append after erasing the only element")
+    {
+        LinkedList<char> list { 'A' };
+        LinkedList<char>::iterator It = list.begin();
+
+        list.erase(It);
+        list.push_back('B');
+
+        REQUIRE(list == LinkedList<char> { 'B' });
+    }
     SECTION("Erase an empty list")
     {
         LinkedList<char> list;
@@ -544,6 +607,295 @@ TEST_CASE("Clearing the list", "[linkedLists], [modifiers]")
         list.clear();
         REQUIRE(list.empty());
     }
+    SECTION("Appending to a cleared list")
+    {
+        LinkedList<int> list {1, 2, 3};
+
+        list.clear();
+        list.push_back(4);
+        list.push_back(5);
+
+        REQUIRE(list == LinkedList<int> {4, 5});
+    }
+}
+
+TEST_CASE("Assigning and resizing a list", "[linkedLists], [modifiers]")
+{
+    SECTION("Assigning a range replaces the contents")
+    {
+        LinkedList<int> list { 9, 9 };
+        std::vector<int> nums = { 1, 2, 3, 4, 5 };
+
+        list.assign(nums.begin(), nums.end());
+        REQUIRE(list == LinkedList<int> { 1, 2, 3, 4, 5 });
+
+        list.assign(nums.end(), nums.end());
+        REQUIRE(list.empty());
+    }
+    SECTION("Assigning copies of a value")
+    {
+        LinkedList<int> list { 1, 2, 3 };
+
+        list.assign(6, 7);
+        REQUIRE(list == LinkedList<int>(6, 7));
+
+        list.assign(0, 7);
+        REQUIRE(list.empty());
+    }
+    SECTION("Assigning from an input iterator")
+    {
+        std::istringstream in("1 2 3 4 5 6");
+        LinkedList<int> list;
+
+        list.assign(std::istream_iterator<int>(in), std::istream_iterator<int>());
+        REQUIRE(list == LinkedList<int> { 1, 2, 3, 4, 5, 6 });
+    }
+    SECTION("Growing and shrinking")
+    {
+        LinkedList<int> list { 1, 2, 3 };
+
+        list.resize(6);
+        REQUIRE(list == LinkedList<int> { 1, 2, 3, 0, 0, 0 });
+
+        list.resize(8, 4);
+        REQUIRE(list == LinkedList<int> { 1, 2, 3, 0, 0, 0, 4, 4 });
+
+        list.resize(2);
+        REQUIRE(list == LinkedList<int> { 1, 2 });
+        list.push_back(5);
+        REQUIRE(list == LinkedList<int> { 1, 2, 5 });
+
+        list.resize(3);
+        REQUIRE(list == LinkedList<int> { 1, 2, 5 });
+
+        list.resize(0);
+        REQUIRE(list.empty());
+        list.resize(5, 1);
+        REQUIRE(list == LinkedList<int>(5, 1));
+    }
+    SECTION("Positions stay right after resizing")
+    {
+        LinkedList<int> list;
+        for (int i = 0; i < 200; ++i)
+        {
+            list.push_back(i);
+        }
+
+        REQUIRE(list.at(150) == 150);
+        list.resize(100);
+        REQUIRE(list.at(99) == 99);
+        REQUIRE_THROWS_AS(list.at(100), std::out_of_range);
+        list.resize(300, -1);
+        REQUIRE(list.at(299) == -1);
+    }
+}
+
+TEST_CASE("Lists built in one block", "[linkedLists], [constructors], [modifiers]")
+{
+    std::vector<std::string> words;
+    for (int i = 0; i < 100; ++i)
+    {
+        words.push_back(std::to_string(i) + std::string(20, 'x'));
+    }
+
+    SECTION("The nodes are laid out in list order")
+    {
+        LinkedList<std::string> list(words.begin(), words.end());
+        LinkedList<std::string> copy(list);
+
+        // Adjacent nodes of a block are one Node apart, the value comes first
+        for (const LinkedList<std::string>* built : { &list, &copy })
+        {
+            const char* previous = nullptr;
+            for (const std::string& word : *built)
+            {
+                const char* address = reinterpret_cast<const char*>(&word);
+                if (previous != nullptr) { REQUIRE(address - previous == sizeof(Node<std::string>)); }
+                previous = address;
+            }
+        }
+    }
+    SECTION("Every modifier works on nodes in a block")
+    {
+        LinkedList<std::string> list(words.begin(), words.end());
+        LinkedList<std::string> copy(list);
+
+        list.pop_front();
+        list.pop_back();
+        list.erase_at(10);
+        list.remove_if([](const std::string& word) { return word[0] == '5'; });
+        list.push_back("last");
+        list.sort();
+        list.reverse();
+        REQUIRE(list.size() == 87);
+
+        list.compact();
+        REQUIRE(list.size() == 87);
+        REQUIRE(list.find("last") != list.end());
+
+        REQUIRE(std::equal(copy.begin(), copy.end(), words.begin()));
+    }
+    SECTION("Copying and comparing lists whose blocks sit next to other nodes")
+    {
+        // Two blocks with nodes of their own in between, so runs that reach
+        // the end of a block must stop there
+        LinkedList<int> list(20, 1);
+        list.push_back(0);
+        list.resize(41, 2);
+        list.push_front(3);
+        list.push_back(4);
+
+        LinkedList<int> copy(list);
+        REQUIRE(copy == list);
+        REQUIRE(copy.size() == 43);
+        REQUIRE(*copy.begin() == 3);
+        REQUIRE(copy.at(42) == 4);
+
+        copy.erase_at(21);
+        REQUIRE(copy != list);
+        REQUIRE(std::count(copy.begin(), copy.end(), 0) == 0);
+    }
+    SECTION("A block is freed with its last node")
+    {
+        const size_t block = footprint::allocated_size(1000 * sizeof(Node<int>));
+
+        LinkedList<int> list(1000, 1);
+        const size_t built = list.memory_usage();
+        while (list.size() > 1)
+        {
+            list.pop_front();
+        }
+        REQUIRE(list.memory_usage() > block);
+        list.pop_front();
+        REQUIRE(list.memory_usage() <= built - block);
+
+        // Repeated growing and shrinking keeps one block, not one per cycle
+        list.resize(1);
+        list.resize(1000);
+        list.resize(1);
+        const size_t cycled = list.memory_usage();
+        for (int i = 0; i < 20; ++i)
+        {
+            list.resize(1000);
+            list.resize(1);
+        }
+        REQUIRE(list.memory_usage() == cycled);
+
+        // Parallel workers leave emptied blocks to the caller
+        ThreadPool pool(3);
+        LinkedList<int> removed(1000, 1);
+        removed.remove_if(execution::par.on(pool).grain(4), [](int) { return true; });
+        REQUIRE(removed.empty());
+        REQUIRE(removed.memory_usage() <= built - block);
+    }
+    SECTION("Building stops cleanly when an element throws")
+    {
+        struct fragile
+        {
+            fragile(int value) : value(value) {}
+            fragile(const fragile& other) : value(other.value)
+            {
+                if (value == 5) { throw std::runtime_error("copy"); }
+            }
+            bool operator==(const fragile& rhs) const { return value == rhs.value; }
+            bool operator!=(const fragile& rhs) const { return value != rhs.value; }
+
+            int value;
+        };
+
+        // Setting the value does not copy construct, so the vector can hold a 5
+        std::vector<fragile> values;
+        for (int i = 0; i < 10; ++i)
+        {
+            values.push_back(fragile(i == 5 ? 0 : i));
+        }
+        values[5].value = 5;
+
+        LinkedList<fragile> list(values.begin(), values.begin() + 4);
+        REQUIRE_THROWS_AS(list.assign(values.begin(), values.end()), std::runtime_error);
+        REQUIRE(list.size() == 4);
+        REQUIRE_THROWS_AS(list.resize(9, fragile(5)), std::runtime_error);
+        REQUIRE_THROWS_AS((LinkedList<fragile>(values.begin(), values.end())), std::runtime_error);
+    }
+}
+
+TEST_CASE("Copying and comparing lists of trivially copyable values", "[linkedLists], [constructors], [comparison]")
+{
+    struct point
+    {
+        int x;
+        double y;
+
+        bool operator==(const point& rhs) const { return x == rhs.x && y == rhs.y; }
+        bool operator!=(const point& rhs) const { return !(*this == rhs); }
+    };
+
+    // Runs of nodes in a block broken up by nodes allocated on their own
+    std::vector<point> points;
+    for (int i = 0; i < 300; ++i)
+    {
+        points.push_back(point { i, i / 2.0 });
+    }
+    LinkedList<point> list(points.begin(), points.end());
+    LinkedList<point>::iterator position = list.begin();
+    for (int i = 0; i < 300; i += 7)
+    {
+        list.insert(position, point { -i, 0.0 });
+        position += 7;
+    }
+    list.push_front(point { 1000, 1.0 });
+    list.push_back(point { 2000, 2.0 });
+    list.erase_at(150);
+
+    // Only nodes that are their bytes are copied whole
+    REQUIRE(std::is_trivially_copyable<Node<point> >::value);
+    REQUIRE_FALSE(std::is_trivially_copyable<Node<std::string> >::value);
+
+    SECTION("A copy holds the same values in list order")
+    {
+        LinkedList<point> copy(list);
+
+        REQUIRE(copy.size() == list.size());
+        REQUIRE(std::equal(copy.begin(), copy.end(), list.begin()));
+        REQUIRE(copy.at(copy.size() - 1) == (point { 2000, 2.0 }));
+
+        copy.push_back(point { 3000, 3.0 });
+        copy.pop_front();
+        REQUIRE(copy.size() == list.size());
+        REQUIRE((*list.begin()).x == 1000);
+    }
+    SECTION("Lists laid out differently compare by their values")
+    {
+        LinkedList<point> scattered;
+        for (const point& value : list)
+        {
+            scattered.push_back(value);
+        }
+        LinkedList<point> copy(scattered);
+
+        REQUIRE(list == scattered);
+        REQUIRE(scattered == copy);
+        REQUIRE(copy == list);
+
+        copy.at(200).y = -1.0;
+        REQUIRE(copy != list);
+        REQUIRE(list != copy);
+        copy.at(200) = list.at(200);
+        REQUIRE(copy == list);
+
+        copy.pop_back();
+        REQUIRE(copy != list);
+        REQUIRE(list != copy);
+    }
+    SECTION("Sorting relinks the nodes of a block out of order")
+    {
+        list.sort([](const point& lhs, const point& rhs) { return lhs.y > rhs.y; });
+        LinkedList<point> copy(list);
+
+        REQUIRE(copy == list);
+        REQUIRE(std::is_sorted(copy.begin(), copy.end(),
+                               [](const point& lhs, const point& rhs) { return lhs.y > rhs.y; }));
+    }
 }
 
 TEST_CASE("Using iterators for iteration", "[linkedLists], [iterators]")
@@ -650,6 +1002,235 @@ TEST_CASE("Test size() function", "[linkedLists], [size], [capacity]")
    
 }
 
+TEST_CASE("Accessing elements by position", "[linkedLists], [access], [modifiers]")
+{
+    LinkedList<int> list;
+    std::vector<int> expected;
+    for (int i = 0; i < 200; ++i)
+    {
+        list.push_back(i);
+        expected.push_back(i);
+    }
+
+    // Every element must match the model, read through the const overload so
+    // the check itself moves nothing
+    auto matches = [](const LinkedList<int>& list, const std::vector<int>& expected)
+    {
+        for (size_t i = 0; i < expected.size(); ++i)
+        {
+            if (list.at(i) != expected[i]) { return false; }
+        }
+        return list.size() == expected.size();
+    };
+
+    SECTION("Reading and writing through at()")
+    {
+        for (size_t i = 0; i < expected.size(); ++i)
+        {
+            REQUIRE(list.at(i) == expected[i]);
+        }
+        for (size_t i = 0; i < expected.size(); i += 7)
+        {
+            list.at(i) = -1;
+            expected[i] = -1;
+        }
+        REQUIRE(matches(list, expected));
+
+        const LinkedList<int>& view = list;
+        REQUIRE(view.at(150) == expected[150]);
+    }
+    SECTION("Positions past the end throw")
+    {
+        LinkedList<int> empty;
+        REQUIRE_THROWS_AS(empty.at(0), std::out_of_range);
+        REQUIRE_THROWS_AS(empty.erase_at(0), std::out_of_range);
+        REQUIRE_THROWS_AS(empty.insert_at(1, 0), std::out_of_range);
+
+        REQUIRE_THROWS_AS(list.at(200), std::out_of_range);
+        REQUIRE_THROWS_AS(list.erase_at(200), std::out_of_range);
+        REQUIRE_THROWS_AS(list.insert_at(201, 0), std::out_of_range);
+        REQUIRE(matches(list, expected));
+    }
+    SECTION("Inserting and erasing by position")
+    {
+        REQUIRE(*list.insert_at(0, -1) == -1);
+        REQUIRE(*list.insert_at(100, -2) == -2);
+        REQUIRE(*list.insert_at(202, -3) == -3);
+        expected.insert(expected.begin(), -1);
+        expected.insert(expected.begin() + 100, -2);
+        expected.push_back(-3);
+        REQUIRE(matches(list, expected));
+
+        REQUIRE(list.erase_at(202) == list.end());
+        REQUIRE(*list.erase_at(50) == expected[51]);
+        REQUIRE(*list.erase_at(0) == expected[1]);
+        expected.pop_back();
+        expected.erase(expected.begin() + 50);
+        expected.erase(expected.begin());
+        REQUIRE(matches(list, expected));
+
+        // The tail moved, appending still lands at the end
+        list.push_back(-4);
+        expected.push_back(-4);
+        REQUIRE(matches(list, expected));
+    }
+    SECTION("Positions stay right under every modifier")
+    {
+        std::mt19937 random(11);
+        for (int round = 0; round < 2000; ++round)
+        {
+            // Touch a random position first so the finger and skips are in use
+            if (!expected.empty())
+            {
+                size_t i = random() % expected.size();
+                REQUIRE(list.at(i) == expected[i]);
+            }
+
+            const int value = static_cast<int>(random() % 1000);
+            switch (random() % 12)
+            {
+            case 0:
+                list.push_front(value);
+                expected.insert(expected.begin(), value);
+                break;
+            case 1:
+                list.push_back(value);
+                expected.push_back(value);
+                break;
+            case 2:
+                list.pop_front();
+                if (!expected.empty()) { expected.erase(expected.begin()); }
+                break;
+            case 3:
+                list.pop_back();
+                if (!expected.empty()) { expected.pop_back(); }
+                break;
+            case 4:
+            case 5:
+            {
+                size_t i = random() % (expected.size() + 1);
+                list.insert_at(i, value);
+                expected.insert(expected.begin() + i, value);
+                break;
+            }
+            case 6:
+            case 7:
+                if (!expected.empty())
+                {
+                    size_t i = random() % expected.size();
+                    list.erase_at(i);
+                    expected.erase(expected.begin() + i);
+                }
+                break;
+            case 8:
+                if (!expected.empty())
+                {
+                    size_t i = random() % expected.size();
+                    LinkedList<int>::const_iterator position = list.cbegin();
+                    position += i;
+                    list.insert(position, value);
+                    expected.insert(expected.begin() + i + 1, value);
+                }
+                break;
+            case 9:
+                if (!expected.empty())
+                {
+                    size_t i = random() % expected.size();
+                    LinkedList<int>::iterator position = list.begin();
+                    std::advance(position, i);
+                    list.erase(position);
+                    expected.erase(expected.begin() + i);
+                }
+                break;
+            case 10:
+                if (round % 4 == 0)
+                {
+                    list.reverse();
+                    std::reverse(expected.begin(), expected.end());
+                }
+                else if (round % 4 == 1)
+                {
+                    list.remove_if([value](int item) { return item % 10 == value % 10; });
+                    expected.erase(std::remove_if(expected.begin(), expected.end(),
+                        [value](int item) { return item % 10 == value % 10; }), expected.end());
+                }
+                else
+                {
+                    list.sort();
+                    std::stable_sort(expected.begin(), expected.end());
+                }
+                break;
+            default:
+                if (round % 2 == 0) { list.compact(); }
+                else { list.compact(16); }
+                break;
+            }
+        }
+        REQUIRE(matches(list, expected));
+
+        LinkedList<int> other { 1, 2, 3 };
+        other.at(2);
+        other = list;
+        REQUIRE(matches(other, expected));
+
+        list.clear();
+        REQUIRE_THROWS_AS(list.at(0), std::out_of_range);
+        list.push_back(5);
+        REQUIRE(list.at(0) == 5);
+    }
+}
+
+TEST_CASE("Measuring the memory a list holds", "[linkedLists], [memory], [capacity]")
+{
+    const size_t node = footprint::allocated_size(sizeof(Node<int>));
+
+    SECTION("An empty list is the list object alone")
+    {
+        LinkedList<int> list;
+
+        REQUIRE(list.memory_usage() == sizeof(LinkedList<int>));
+    }
+    SECTION("Every element adds a heap block")
+    {
+        LinkedList<int> list { 1, 2, 3 };
+
+        REQUIRE(list.memory_usage() == sizeof(LinkedList<int>) + 3 * node);
+        REQUIRE(node >= sizeof(Node<int>) + sizeof(size_t));
+    }
+    SECTION("A short list takes the same memory however it is built")
+    {
+        LinkedList<int> pushed;
+        for (int i = 1; i <= 4; ++i)
+        {
+            pushed.push_back(i);
+        }
+        std::vector<int> values { 1, 2, 3, 4 };
+
+        const size_t expected = sizeof(LinkedList<int>) + 4 * node;
+        REQUIRE(pushed.memory_usage() == expected);
+        REQUIRE((LinkedList<int> { 1, 2, 3, 4 }).memory_usage() == expected);
+        REQUIRE(LinkedList<int>(values.begin(), values.end()).memory_usage() == expected);
+        REQUIRE(LinkedList<int>(4, 1).memory_usage() == expected);
+        REQUIRE(LinkedList<int>(pushed).memory_usage() == expected);
+    }
+    SECTION("Long strings add their buffer, short ones do not")
+    {
+        LinkedList<std::string> short_strings { "a", "b" };
+        LinkedList<std::string> long_strings { std::string(100, 'a'), std::string(100, 'b') };
+
+        REQUIRE(short_strings.memory_usage()
+                == sizeof(LinkedList<std::string>) + 2 * footprint::allocated_size(sizeof(Node<std::string>)));
+        REQUIRE(long_strings.memory_usage()
+                >= short_strings.memory_usage() + 2 * footprint::allocated_size(101));
+    }
+    SECTION("Allocator blocks are rounded up")
+    {
+        REQUIRE(footprint::allocated_size(1) == 4 * sizeof(size_t));
+        REQUIRE(footprint::allocated_size(100) % (2 * sizeof(size_t)) == 0);
+        REQUIRE(footprint::allocated_size(100) >= 100 + sizeof(size_t));
+    }
+}
+
 TEST_CASE("Test comparison operators", "[linkedLists], [comparison], [operators]")
 {
     SECTION("Two identical linked lists")
@@ -666,6 +1247,14 @@ TEST_CASE("Test comparison operators", "[linkedLists], [comparison], [operators]
 
         REQUIRE(left != right);
     }
+    SECTION("A list and a longer list that starts with it")
+    {
+        LinkedList<int> shorter { 1, 2, 3 };
+        LinkedList<int> longer { 1, 2, 3, 4 };
+
+        REQUIRE(shorter != longer);
+        REQUIRE(longer != shorter);
+    }
 }
 
 TEST_CASE("Test assignment operator", "[linkedLists], [comparison], [operators]")
@@ -727,6 +1316,110 @@ TEST_CASE("Reversing the order of a list", "[linkedLists], [operations], [revers
     }
 }
 
+TEST_CASE("Reversing part of a list and rotating it", "[linkedLists], [operations], [reverse]")
+{
+    LinkedList<int> list { 1, 2, 3, 4, 5, 6 };
+
+    LinkedList<int>::const_iterator second = list.cbegin();
+    ++second;
+    LinkedList<int>::const_iterator fifth = second;
+    fifth += 3;
+
+    SECTION("A range in the middle")
+    {
+        list.reverse(second, fifth);
+
+        REQUIRE(list == LinkedList<int>({ 1, 4, 3, 2, 5, 6 }));
+        REQUIRE(*second == 2);
+        REQUIRE(*fifth == 5);
+    }
+    SECTION("Ranges touching either end")
+    {
+        list.reverse(list.cbegin(), second);
+        REQUIRE(list == LinkedList<int>({ 1, 2, 3, 4, 5, 6 }));
+
+        list.reverse(list.cbegin(), fifth);
+        REQUIRE(list == LinkedList<int>({ 4, 3, 2, 1, 5, 6 }));
+
+        list.reverse(second, list.cend());
+        REQUIRE(list == LinkedList<int>({ 4, 3, 6, 5, 1, 2 }));
+
+        // The tail moved, appending still lands at the end
+        list.push_back(7);
+        REQUIRE(list == LinkedList<int>({ 4, 3, 6, 5, 1, 2, 7 }));
+    }
+    SECTION("Empty ranges change nothing")
+    {
+        list.reverse(second, second);
+        list.reverse(list.cend(), list.cend());
+
+        REQUIRE(list == LinkedList<int>({ 1, 2, 3, 4, 5, 6 }));
+    }
+    SECTION("Rotating around a middle element")
+    {
+        LinkedList<int>::iterator first = list.rotate(fifth);
+
+        REQUIRE(list == LinkedList<int>({ 5, 6, 1, 2, 3, 4 }));
+        REQUIRE(*first == 1);
+
+        list.push_back(7);
+        REQUIRE(list == LinkedList<int>({ 5, 6, 1, 2, 3, 4, 7 }));
+    }
+    SECTION("Rotating around either end changes nothing")
+    {
+        REQUIRE(list.rotate(list.cbegin()) == list.end());
+        REQUIRE(list.rotate(list.cend()) == list.begin());
+
+        REQUIRE(list == LinkedList<int>({ 1, 2, 3, 4, 5, 6 }));
+    }
+}
+
+// Hidden, run them with runTests "[stress]". A recursive walk would overflow
+// the stack long before these lengths, 100M ints take about 3 GB.
+TEST_CASE("Operations on very long lists use no stack per element", "[.][stress]")
+{
+    auto exercise = [](size_t length)
+    {
+        LinkedList<int> list;
+        for (size_t i = 0; i < length; ++i)
+        {
+            list.push_back(static_cast<int>(i));
+        }
+
+        list.reverse();
+        REQUIRE(*list.begin() == static_cast<int>(length - 1));
+
+        list.reverse(list.cbegin(), list.cend());
+        REQUIRE(*list.begin() == 0);
+
+        LinkedList<int>::const_iterator middle = list.cbegin();
+        middle += length / 2;
+        list.rotate(middle);
+        REQUIRE(*list.begin() == static_cast<int>(length / 2));
+
+        list.sort();
+        REQUIRE(list.at(length - 1) == static_cast<int>(length - 1));
+
+        list.sort(std::greater<int>());
+        REQUIRE(list.at(0) == static_cast<int>(length - 1));
+
+        list.remove_if([](int value) { return value % 2 == 0; });
+        REQUIRE(list.size() == length / 2);
+
+        list.clear();
+        REQUIRE(list.empty());
+    };
+
+    SECTION("10 million elements")
+    {
+        exercise(10000000);
+    }
+    SECTION("100 million elements")
+    {
+        exercise(100000000);
+    }
+}
+
 TEST_CASE("Using unique() to remove duplicate elements", "[linkedLists], [operations], [unique]")
 {
     SECTION("A populated list")
@@ -750,6 +1443,99 @@ TEST_CASE("Using unique() to remove duplicate elements", "[linkedLists], [operat
 
         REQUIRE(list.empty());
     }
+    SECTION("With a hash and an equality of its own")
+    {
+        LinkedList<std::string> list { "a", "B", "b", "A", "c", "C", "a" };
+
+        // Case insensitive, every value hashes by its lower case letter
+        auto lower = [](const std::string& value) { return static_cast<char>(value[0] | 0x20); };
+        list.unique([&lower](const std::string& value) { return std::hash<char>()(lower(value)); },
+                    [&lower](const std::string& lhs, const std::string& rhs)
+                    {
+                        return lower(lhs) == lower(rhs);
+                    });
+
+        REQUIRE(list == LinkedList<std::string>({ "a", "B", "c" }));
+
+        list.push_back("d");
+        REQUIRE(list.size() == 4);
+    }
+    SECTION("Many values that collide in the table")
+    {
+        LinkedList<int> list;
+        std::vector<int> expected;
+        for (int i = 0; i < 3000; ++i)
+        {
+            list.push_back((i % 1000) * 1024);
+            if (i < 1000) { expected.push_back(i * 1024); }
+        }
+
+        list.unique([](int value) { return static_cast<size_t>(value) & ~size_t(1023); },
+                    std::equal_to<int>());
+
+        REQUIRE(std::equal(expected.begin(), expected.end(), list.begin()));
+        REQUIRE(list.size() == expected.size());
+    }
+    SECTION("A throwing hash keeps the elements it did not reach")
+    {
+        LinkedList<int> list { 1, 1, 2, 2, 3, 3 };
+        int calls = 0;
+
+        REQUIRE_THROWS_AS(list.unique([&calls](int value)
+        {
+            if (++calls == 4) { throw std::runtime_error("hash"); }
+            return std::hash<int>()(value);
+        }, std::equal_to<int>()), std::runtime_error);
+        REQUIRE(list == LinkedList<int>({ 1, 2, 2, 3, 3 }));
+
+        list.push_back(4);
+        list.unique();
+        REQUIRE(list == LinkedList<int>({ 1, 2, 3, 4 }));
+    }
+}
+
+TEST_CASE("Removing adjacent duplicates", "[linkedLists], [operations], [unique]")
+{
+    SECTION("Runs of equal values")
+    {
+        LinkedList<int> list { 1, 1, 2, 1, 3, 3, 3, 4, 4 };
+
+        list.unique_adjacent();
+
+        REQUIRE(list == LinkedList<int>({ 1, 2, 1, 3, 4 }));
+
+        list.push_back(5);
+        REQUIRE(list == LinkedList<int>({ 1, 2, 1, 3, 4, 5 }));
+    }
+    SECTION("The predicate compares with the element kept last")
+    {
+        LinkedList<int> list { 1, 2, 3, 4, 10, 11, 12, 20 };
+
+        list.unique_adjacent([](int kept, int value) { return value - kept < 3; });
+
+        REQUIRE(list == LinkedList<int>({ 1, 4, 10, 20 }));
+    }
+    SECTION("A sorted list")
+    {
+        LinkedList<int> list { 5, 1, 3, 1, 5, 2, 3, 3 };
+        list.sort();
+
+        list.unique_sorted();
+
+        REQUIRE(list == LinkedList<int>({ 1, 2, 3, 5 }));
+    }
+    SECTION("Empty lists and lists of one element")
+    {
+        LinkedList<int> empty;
+        LinkedList<int> single { 7 };
+
+        empty.unique_adjacent();
+        empty.unique_sorted();
+        single.unique_sorted();
+
+        REQUIRE(empty.empty());
+        REQUIRE(single == LinkedList<int>({ 7 }));
+    }
 }
 
 TEST_CASE("Using remove to erase specific elements", "[linkedLists], [operations], [remove]")
@@ -801,6 +1587,30 @@ TEST_CASE("Using remove_if to erase elements fulfilling a predicate", "[linkedLi
 
         REQUIRE(list.empty());
     }
+    SECTION("Removing the last element keeps the list appendable")
+    {
+        LinkedList<int> list { 1, 2, 9 };
+
+        list.remove_if([](const int& value) { return value > 5; });
+        list.push_back(3);
+
+        REQUIRE(list == LinkedList<int>({ 1, 2, 3 }));
+    }
+    SECTION("A throwing predicate keeps the elements it did not reach")
+    {
+        LinkedList<int> list { 1, 2, 3, 4, 5, 6 };
+        int calls = 0;
+
+        REQUIRE_THROWS_AS(list.remove_if([&calls](const int& value)
+        {
+            if (++calls == 4) { throw std::runtime_error("predicate"); }
+            return value % 2 == 0;
+        }), std::runtime_error);
+        REQUIRE(list == LinkedList<int>({ 1, 3, 4, 5, 6 }));
+
+        list.push_back(7);
+        REQUIRE(list == LinkedList<int>({ 1, 3, 4, 5, 6, 7 }));
+    }
 }
 
 TEST_CASE("Using find to locate a specific element", "[linkedLists], [operations], [find]")
@@ -890,4 +1700,423 @@ TEST_CASE("Sorting a list with a special comparator", "[linkedLists], [operation
 
         REQUIRE(list.empty());
     }
+    SECTION("Appending after a sort")
+    {
+        LinkedList<int> list {3, 1, 2};
+
+        list.sort();
+        list.push_back(4);
+
+        REQUIRE(list == LinkedList<int>({ 1, 2, 3, 4 }));
+    }
+}
+
+TEST_CASE("Compacting a list into one block", "[linkedLists], [operations], [compact]")
+{
+    // Adjacent nodes of a block are one Node apart, the value comes first.
+    // Checks the first n nodes.
+    auto contiguous = [](const LinkedList<int>& list, size_t n)
+    {
+        const char* previous = nullptr;
+        for (LinkedList<int>::const_iterator it = list.cbegin(); it != list.cend() && n > 0; ++it, --n)
+        {
+            const char* address = reinterpret_cast<const char*>(&*it);
+            if (previous != nullptr && address - previous != sizeof(Node<int>)) { return false; }
+            previous = address;
+        }
+        return true;
+    };
+
+    // Sorting by a scrambled key relinks the nodes out of allocation order
+    LinkedList<int> list;
+    for (int i = 0; i < 1000; ++i)
+    {
+        list.push_back(i);
+    }
+    list.sort([](int lhs, int rhs) { return (lhs * 7919) % 1000 < (rhs * 7919) % 1000; });
+
+    std::vector<int> expected(list.begin(), list.end());
+
+    SECTION("All at once")
+    {
+        const size_t scattered = list.memory_usage();
+
+        list.compact();
+
+        REQUIRE(contiguous(list, list.size()));
+        REQUIRE(std::equal(expected.begin(), expected.end(), list.begin()));
+        REQUIRE(list.memory_usage() < scattered);
+
+        list.push_back(-1);
+        list.pop_front();
+        list.remove_if([](int value) { return value % 2 == 0; });
+        expected.push_back(-1);
+        expected.erase(expected.begin());
+        expected.erase(std::remove_if(expected.begin(), expected.end(),
+                                      [](int value) { return value % 2 == 0; }), expected.end());
+        REQUIRE(std::equal(expected.begin(), expected.end(), list.begin()));
+
+        list.compact();
+        REQUIRE(contiguous(list, list.size()));
+        REQUIRE(std::equal(expected.begin(), expected.end(), list.begin()));
+        REQUIRE(list.size() == expected.size());
+    }
+    SECTION("In bounded steps")
+    {
+        int steps = 0;
+        while (!list.compact(64))
+        {
+            ++steps;
+        }
+
+        REQUIRE(steps == 15);
+        REQUIRE(std::equal(expected.begin(), expected.end(), list.begin()));
+
+        // Blocks double from 16 nodes, so the list is a few contiguous runs
+        REQUIRE(contiguous(list, 16));
+        REQUIRE_FALSE(contiguous(list, 17));
+    }
+    SECTION("Steps survive inserts and restart after erasing or reordering")
+    {
+        REQUIRE_FALSE(list.compact(100));
+
+        LinkedList<int>::const_iterator position = list.cbegin();
+        list.insert(position, -1);
+        list.push_back(-2);
+        REQUIRE_FALSE(list.compact(100));
+
+        // The node moved last is the 200th, erasing it restarts the pass
+        LinkedList<int>::iterator moved_last = list.begin();
+        std::advance(moved_last, 199);
+        list.erase(moved_last);
+        REQUIRE_FALSE(list.compact(100));
+
+        list.reverse();
+        list.reverse();
+        while (!list.compact(100)) {}
+
+        expected.insert(expected.begin() + 1, -1);
+        expected.erase(expected.begin() + 199);
+        expected.push_back(-2);
+        REQUIRE(std::equal(expected.begin(), expected.end(), list.begin()));
+        REQUIRE(list.size() == expected.size());
+    }
+    SECTION("Copies, assignment and clear")
+    {
+        list.compact();
+
+        LinkedList<int> copy(list);
+        REQUIRE(copy == list);
+
+        LinkedList<int> other { 1, 2, 3 };
+        other.compact();
+        other = list;
+        REQUIRE(other == list);
+
+        list.clear();
+        REQUIRE(list.empty());
+        REQUIRE(list.memory_usage() == sizeof(LinkedList<int>));
+
+        list.compact();
+        REQUIRE(list.compact(1));
+        REQUIRE(list.memory_usage() == sizeof(LinkedList<int>));
+    }
+    SECTION("Values with their own memory are moved")
+    {
+        LinkedList<std::string> strings;
+        for (int i = 0; i < 100; ++i)
+        {
+            strings.push_front(std::string(40, char('a' + i % 26)));
+        }
+
+        strings.compact();
+
+        REQUIRE(strings.size() == 100);
+        REQUIRE(*strings.begin() == std::string(40, char('a' + 99 % 26)));
+        strings.sort();
+        while (!strings.compact(7)) {}
+        REQUIRE(*strings.begin() == std::string(40, 'a'));
+    }
+}
+
+TEST_CASE("Parallel algorithms over list segments", "[linkedLists], [operations], [parallel]")
+{
+    ThreadPool pool(3);
+    const execution::parallel_policy policy = execution::par.on(pool).grain(4);
+
+    std::vector<int> nums;
+    for (int i = 1; i <= 1000; ++i)
+    {
+        nums.push_back(i);
+    }
+    LinkedList<int> list(nums.begin(), nums.end());
+
+    SECTION("for_each visits every element once")
+    {
+        std::atomic<long> sum(0);
+
+        list.for_each(policy, [&sum](int value) { sum += value; });
+
+        REQUIRE(sum == 500500);
+    }
+    SECTION("transform replaces every element in place")
+    {
+        list.transform(policy, [](int value) { return value * 2; });
+
+        int i = 2;
+        for (auto& element : list)
+        {
+            REQUIRE(element == i);
+            i += 2;
+        }
+    }
+    SECTION("reduce and transform_reduce")
+    {
+        REQUIRE(list.reduce(policy, 0L, std::plus<long>()) == 500500);
+        REQUIRE(list.transform_reduce(policy, 0L, std::plus<long>(), 
+                [](int value) { return long(value) * value; }) == 333833500);
+
+        // Every segment's bool result is its own object, not a shared bit
+        REQUIRE(list.transform_reduce(policy, true, std::logical_and<bool>(),
+                [](int value) { return value > 0; }));
+        REQUIRE_FALSE(list.transform_reduce(policy, true, std::logical_and<bool>(),
+                [](int value) { return value != 999; }));
+    }
+    SECTION("reduce keeps the order of a non commutative operation")
+    {
+        LinkedList<std::string> words(200, "ab");
+        words.push_front("start");
+
+        std::string joined = words.reduce(policy, std::string(), std::plus<std::string>());
+
+        REQUIRE(joined.size() == 405);
+        REQUIRE(joined.compare(0, 7, "startab") == 0);
+    }
+    SECTION("count_if, any_of and all_of")
+    {
+        REQUIRE(list.count_if(policy, [](int value) { return value % 3 == 0; }) == 333);
+        REQUIRE(list.any_of(policy, [](int value) { return value == 999; }));
+        REQUIRE_FALSE(list.any_of(policy, [](int value) { return value > 1000; }));
+        REQUIRE(list.all_of(policy, [](int value) { return value > 0; }));
+        REQUIRE_FALSE(list.all_of(policy, [](int value) { return value < 1000; }));
+    }
+    SECTION("An empty list")
+    {
+        LinkedList<int> empty;
+
+        REQUIRE(empty.reduce(policy, 7, std::plus<int>()) == 7);
+        REQUIRE(empty.count_if(policy, [](int) { return true; }) == 0);
+        REQUIRE(empty.all_of(policy, [](int) { return false; }));
+    }
+    SECTION("The default policy on a short list")
+    {
+        REQUIRE(list.reduce(execution::par, 0L, std::plus<long>()) == 500500);
+    }
+}
+
+TEST_CASE("Using a parallel find to locate elements", "[linkedLists], [operations], [find], [parallel]")
+{
+    ThreadPool pool(3);
+    const execution::parallel_policy policy = execution::par.on(pool).grain(4);
+
+    std::vector<int> nums;
+    for (int i = 0; i < 1000; ++i)
+    {
+        nums.push_back(i % 100);
+    }
+    LinkedList<int> list(nums.begin(), nums.end());
+
+    SECTION("The earliest of several matches is returned")
+    {
+        LinkedList<int>::iterator it = list.find(policy, 42);
+
+        REQUIRE(it == (list.begin() += 42));
+    }
+    SECTION("A match in the last segment")
+    {
+        list.push_back(1000);
+
+        LinkedList<int>::iterator it = list.find_if(policy, [](int value) { return value >= 1000; });
+
+        REQUIRE(it != list.end());
+        REQUIRE(*it == 1000);
+    }
+    SECTION("A match at the head of the list")
+    {
+        REQUIRE(list.find(policy, 0) == list.begin());
+    }
+    SECTION("No match")
+    {
+        REQUIRE(list.find(policy, -1) == list.end());
+    }
+    SECTION("An empty list")
+    {
+        LinkedList<int> empty;
+
+        REQUIRE(empty.find(policy, 1) == empty.end());
+    }
+}
+
+TEST_CASE("Parallel remove_if and unique relink each segment", "[linkedLists], [operations], [remove], [unique], [parallel]")
+{
+    ThreadPool pool(3);
+    const execution::parallel_policy policy = execution::par.on(pool).grain(4);
+
+    std::vector<int> nums;
+    for (int i = 0; i < 1000; ++i)
+    {
+        nums.push_back(i);
+    }
+    LinkedList<int> list(nums.begin(), nums.end());
+
+    SECTION("Removing every other element")
+    {
+        list.remove_if(policy, [](int value) { return value % 2 != 0; });
+
+        int i = 0;
+        for (auto& element : list)
+        {
+            REQUIRE(element == i);
+            i += 2;
+        }
+        REQUIRE(i == 1000);
+    }
+    SECTION("Removing the head, the tail and a single value")
+    {
+        list.remove_if(policy, [](int value) { return value == 0 || value == 999; });
+        list.remove(policy, 500);
+        list.push_back(1000);
+
+        REQUIRE(list.size() == 998);
+        REQUIRE(*list.begin() == 1);
+        REQUIRE(list.find(500) == list.end());
+        REQUIRE(*(list.begin() += 997) == 1000);
+    }
+    SECTION("Removing every element")
+    {
+        list.remove_if(policy, [](int) { return true; });
+
+        REQUIRE(list.empty());
+        list.push_back(1);
+        REQUIRE(*list.begin() == 1);
+    }
+    SECTION("A throwing predicate leaves every segment linked")
+    {
+        REQUIRE_THROWS_AS(list.remove_if(policy, [](int value)
+        {
+            if (value == 500) { throw std::runtime_error("predicate"); }
+            return value % 2 != 0;
+        }), std::runtime_error);
+
+        // Whatever the other segments removed, the rest is in order and whole
+        std::vector<int> left(list.begin(), list.end());
+        REQUIRE(std::is_sorted(left.begin(), left.end()));
+        REQUIRE(left.size() == list.size());
+        REQUIRE(std::count(left.begin(), left.end(), 500) == 1);
+        for (int i = 0; i < 1000; i += 2)
+        {
+            REQUIRE(std::binary_search(left.begin(), left.end(), i));
+        }
+
+        list.push_back(1000);
+        REQUIRE(*(list.begin() += left.size()) == 1000);
+    }
+    SECTION("unique keeps the first occurrence of each value")
+    {
+        LinkedList<int> repeated;
+        for (int i = 0; i < 1000; ++i)
+        {
+            repeated.push_back((i * 7) % 50);
+        }
+
+        repeated.unique(policy);
+
+        REQUIRE(repeated.size() == 50);
+
+        int i = 0;
+        for (auto& element : repeated)
+        {
+            REQUIRE(element == (i * 7) % 50);
+            ++i;
+        }
+        repeated.push_back(-1);
+        REQUIRE(*(repeated.begin() += 50) == -1);
+    }
+    SECTION("unique on a list without duplicates and on an empty list")
+    {
+        LinkedList<int> empty;
+
+        list.unique(policy);
+        empty.unique(policy);
+
+        REQUIRE(list.size() == 1000);
+        REQUIRE(empty.empty());
+    }
+}
+
+TEST_CASE("Sorting a list in parallel", "[linkedLists], [operations], [sort], [parallel]")
+{
+    ThreadPool pool(3);
+    const execution::parallel_policy policy = execution::par.on(pool).grain(4);
+
+    std::vector<int> nums;
+    for (int i = 0; i < 1000; ++i)
+    {
+        nums.push_back((i * 389) % 1000);
+    }
+    LinkedList<int> list(nums.begin(), nums.end());
+
+    SECTION("An unsorted list")
+    {
+        list.sort(policy);
+
+        int i = 0;
+        for (auto& element : list)
+        {
+            REQUIRE(element == i);
+            ++i;
+        }
+        list.push_back(1000);
+        REQUIRE(*(list.begin() += 1000) == 1000);
+    }
+    SECTION("A reverse comparator")
+    {
+        list.sort(policy, [](const int& val1, const int& val2){return val1 > val2;});
+
+        int i = 999;
+        for (auto& element : list)
+        {
+            REQUIRE(element == i);
+            --i;
+        }
+    }
+    SECTION("Equal elements keep their order")
+    {
+        LinkedList<std::pair<int, int> > pairs;
+        for (int i = 0; i < 500; ++i)
+        {
+            pairs.push_back(std::make_pair(i % 5, i));
+        }
+
+        pairs.sort(policy, [](const std::pair<int, int>& lhs, const std::pair<int, int>& rhs)
+        {
+            return lhs.first < rhs.first;
+        });
+
+        std::pair<int, int> previous(-1, -1);
+        for (auto& element : pairs)
+        {
+            REQUIRE(previous.first <= element.first);
+            REQUIRE((previous.first < element.first || previous.second < element.second));
+            previous = element;
+        }
+    }
+    SECTION("An empty list")
+    {
+        LinkedList<int> empty;
+
+        empty.sort(policy);
+
+        REQUIRE(empty.empty());
+    }
 }
@@ -0,0 +1,221 @@
+/*
+
+File: listStatsTest.cpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+// Compiles the list with its operation counters. The other test files build
+// it without them, so this file only instantiates lists of its own type.
+#define LINKED_LIST_STATS
+
+#include <functional>
+#include <map>
+#include <sstream>
+#include <string>
+#include "catch.hpp"
+#include "linkedList.hpp"
+
+namespace
+{
+    struct counted
+    {
+        counted(int value = 0) : value(value) {}
+
+        bool operator==(const counted& rhs) const { return value == rhs.value; }
+        bool operator!=(const counted& rhs) const { return value != rhs.value; }
+        bool operator<(const counted& rhs) const { return value < rhs.value; }
+
+        int value;
+    };
+
+    size_t calls(list_stats::operation op)
+    {
+        return list_stats::read().calls[static_cast<size_t>(op)];
+    }
+
+    size_t nodes(list_stats::operation op)
+    {
+        return list_stats::read().nodes[static_cast<size_t>(op)];
+    }
+}
+
+namespace std
+{
+    template <>
+    struct hash<counted>
+    {
+        size_t operator()(const counted& item) const { return std::hash<int>()(item.value); }
+    };
+}
+
+using list_stats::operation;
+
+TEST_CASE("Counting list operations", "[linkedLists], [stats]")
+{
+    REQUIRE(list_stats::enabled());
+    list_stats::reset();
+
+    SECTION("Calls and allocations")
+    {
+        LinkedList<counted> list;
+        list.push_back(1);
+        list.push_back(2);
+        list.push_front(0);
+
+        REQUIRE(calls(operation::push_back) == 2);
+        REQUIRE(calls(operation::push_front) == 2);
+        REQUIRE(list_stats::read().allocations == 3);
+
+        list.pop_front();
+        REQUIRE(calls(operation::pop_front) == 1);
+        REQUIRE(list_stats::read().frees == 1);
+    }
+    SECTION("Hidden walks show up as nodes traversed")
+    {
+        LinkedList<counted> list { 1, 2, 3, 4, 5 };
+        LinkedList<counted> same { 1, 2, 3, 4, 5 };
+
+        REQUIRE(list.size() == 5);
+        REQUIRE(nodes(operation::size) == 5);
+
+        list.pop_back();
+        REQUIRE(nodes(operation::pop_back) == 3);
+
+        // Comparing walks the two lists side by side once, without size()
+        list_stats::reset();
+        same.pop_back();
+        REQUIRE(list == same);
+        REQUIRE(calls(operation::size) == 0);
+        REQUIRE(nodes(operation::equal) == 4);
+
+        same.push_back(5);
+        REQUIRE(list != same);
+        REQUIRE(nodes(operation::equal) == 8);
+    }
+    SECTION("Duplicates are unlinked in one pass, not erased one at a time")
+    {
+        LinkedList<counted> list { 1, 1, 2, 2, 3 };
+
+        list.unique();
+        REQUIRE(calls(operation::unique) == 1);
+        REQUIRE(calls(operation::erase) == 0);
+        REQUIRE(nodes(operation::remove) == 5);
+        REQUIRE(list_stats::read().frees == 2);
+
+        list.push_back(3);
+        list.unique_sorted();
+        REQUIRE(calls(operation::unique) == 2);
+        REQUIRE(nodes(operation::remove) == 9);
+        REQUIRE(list_stats::read().frees == 3);
+    }
+    SECTION("Resizing walks to the last node that stays")
+    {
+        LinkedList<counted> list { 1, 2, 3, 4, 5 };
+        list_stats::reset();
+
+        list.resize(3);
+        REQUIRE(calls(operation::resize) == 1);
+        REQUIRE(nodes(operation::resize) == 3);
+        REQUIRE(list_stats::read().frees == 2);
+
+        // Already the right length, nothing is freed or allocated
+        list.resize(3);
+        REQUIRE(calls(operation::resize) == 2);
+        REQUIRE(list_stats::read().frees == 2);
+        REQUIRE(list_stats::read().allocations == 0);
+    }
+    SECTION("Positional access walks from the closest known node")
+    {
+        LinkedList<counted> list;
+        for (int i = 0; i < 1000; ++i)
+        {
+            list.push_back(i);
+        }
+
+        list.at(900);
+        REQUIRE(nodes(operation::at) == 900);
+
+        list_stats::reset();
+        list.at(901);
+        list.at(903);
+        REQUIRE(nodes(operation::at) == 3);
+
+        // The first walk recorded a node every 32 positions on its way
+        list_stats::reset();
+        list.at(100);
+        REQUIRE(nodes(operation::at) == 4);
+
+        // 19 nodes from the skip at 480, then none from the inserted node
+        list_stats::reset();
+        list.insert_at(500, counted(-1));
+        list.erase_at(501);
+        REQUIRE(calls(operation::insert) == 1);
+        REQUIRE(calls(operation::erase) == 1);
+        REQUIRE(nodes(operation::at) == 19);
+    }
+    SECTION("The longest list walked is kept")
+    {
+        LinkedList<counted> list(100, counted(7));
+
+        list.size();
+        list.clear();
+        list.push_back(1);
+        list.size();
+
+        REQUIRE(list_stats::read().max_length == 100);
+        REQUIRE(list_stats::read().frees == 100);
+    }
+    SECTION("Reset clears every counter")
+    {
+        LinkedList<counted> list { 1, 2, 3 };
+        list.sort();
+        list_stats::reset();
+
+        list_stats::snapshot current = list_stats::read();
+        for (size_t i = 0; i < list_stats::operation_count; ++i)
+        {
+            REQUIRE(current.calls[i] == 0);
+            REQUIRE(current.nodes[i] == 0);
+        }
+        REQUIRE(current.allocations == 0);
+        REQUIRE(current.max_length == 0);
+    }
+}
+
+TEST_CASE("Dumping the list counters", "[linkedLists], [stats]")
+{
+    list_stats::reset();
+    {
+        LinkedList<counted> list { 3, 1, 2 };
+        list.find(2);
+    }
+
+    SECTION("As JSON")
+    {
+        std::ostringstream out;
+        list_stats::write_json(out);
+
+        REQUIRE(out.str().find("\"enabled\": true") != std::string::npos);
+        REQUIRE(out.str().find("\"find\": {\"calls\": 1, \"nodes\": 3}") != std::string::npos);
+        REQUIRE(out.str().find("\"allocations\": 3, \"frees\": 3") != std::string::npos);
+    }
+    SECTION("To a callback")
+    {
+        std::map<std::string, size_t> values;
+        list_stats::report([&values](const char* name, size_t value) { values[name] = value; });
+
+        REQUIRE(values.size() == 2 * list_stats::operation_count + 3);
+        REQUIRE(values["find.calls"] == 1);
+        REQUIRE(values["destroy.calls"] == 1);
+        REQUIRE(values["clear.nodes"] == 3);
+        REQUIRE(values["max_length"] == 3);
+    }
+}
@@ -0,0 +1,120 @@
+/*
+
+File: listTraceTest.cpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#include <sstream>
+#include <string>
+#include <vector>
+#include "catch.hpp"
+#include "listTrace.hpp"
+
+using list_trace::operation;
+
+TEST_CASE("Writing and reading a trace", "[trace]")
+{
+    std::stringstream buffer;
+    list_trace::Writer writer(buffer);
+
+    SECTION("Records read back as written")
+    {
+        writer.write(operation::push_back, 0, 12);
+        writer.write(operation::erase, 300);
+        writer.write(operation::find, 1ull << 40, 7);
+        REQUIRE(writer.records() == 3);
+
+        std::vector<list_trace::record> records = list_trace::read_all(buffer);
+
+        REQUIRE(records.size() == 3);
+        REQUIRE(records[0].op == operation::push_back);
+        REQUIRE(records[0].value_size == 12);
+        REQUIRE(records[1].op == operation::erase);
+        REQUIRE(records[1].position == 300);
+        REQUIRE(records[2].position == (1ull << 40));
+        REQUIRE(records[2].value_size == 7);
+    }
+    SECTION("Small records take three bytes")
+    {
+        size_t header = buffer.str().size();
+        writer.write(operation::insert, 5, 4);
+
+        REQUIRE(buffer.str().size() - header == 3);
+    }
+    SECTION("A stream without the header is rejected")
+    {
+        std::stringstream other("not a trace");
+        list_trace::Reader reader(other);
+        list_trace::record entry;
+
+        REQUIRE_FALSE(reader.valid());
+        REQUIRE_FALSE(reader.next(entry));
+    }
+    SECTION("A truncated record ends the trace")
+    {
+        writer.write(operation::push_back, 0, 4);
+        writer.write(operation::insert, 1000, 4);
+        std::string bytes = buffer.str();
+        std::stringstream truncated(bytes.substr(0, bytes.size() - 2));
+
+        REQUIRE(list_trace::read_all(truncated).size() == 1);
+    }
+}
+
+TEST_CASE("Recording the operations on a list", "[trace], [linkedLists]")
+{
+    std::stringstream buffer;
+    list_trace::Writer writer(buffer);
+    RecordingList<std::string> list(writer);
+
+    list.push_back("one");
+    list.push_back("three");
+    list.push_front("zero");
+
+    RecordingList<std::string>::const_iterator position = list.begin();
+    ++position;
+    list.insert(position, "two");
+
+    RecordingList<std::string>::iterator found = list.find("three");
+    list.erase(found);
+    list.pop_front();
+    list.sort();
+
+    REQUIRE(list.list() == LinkedList<std::string> { "one", "two" });
+
+    std::vector<list_trace::record> records = list_trace::read_all(buffer);
+    REQUIRE(records.size() == 8);
+
+    REQUIRE(records[0].op == operation::push_back);
+    REQUIRE(records[0].value_size == 3);
+    REQUIRE(records[2].op == operation::push_front);
+
+    SECTION("Inserts record the index of the new element")
+    {
+        REQUIRE(records[3].op == operation::insert);
+        REQUIRE(records[3].position == 2);
+    }
+    SECTION("Finds record the elements looked at")
+    {
+        REQUIRE(records[4].op == operation::find);
+        REQUIRE(records[4].position == 4);
+    }
+    SECTION("Erases record the index of the element")
+    {
+        REQUIRE(records[5].op == operation::erase);
+        REQUIRE(records[5].position == 3);
+    }
+    SECTION("Operations without a position")
+    {
+        REQUIRE(records[6].op == operation::pop_front);
+        REQUIRE(records[7].op == operation::sort);
+    }
+}
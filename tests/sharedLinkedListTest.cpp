@@ -0,0 +1,256 @@
+/*
+
+File: sharedLinkedListTest.cpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+#include "allocationAssertions.hpp"
+#include "catch.hpp"
+#include "sharedLinkedList.hpp"
+
+typedef SharedLinkedList<int> shared_list;
+
+namespace
+{
+    // The node holding the element at position i
+    const int* address(const shared_list& list, size_t i)
+    {
+        shared_list::const_iterator it = list.begin();
+        for (; i > 0; --i) { ++it; }
+        return &*it;
+    }
+}
+
+TEST_CASE("Constructing shared lists", "[sharedLists], [constructors]")
+{
+    SECTION("Default construction")
+    {
+        shared_list list;
+
+        REQUIRE(list.empty());
+        REQUIRE(list.begin() == list.end());
+        REQUIRE(list.size() == 0);
+        REQUIRE_FALSE(list.shared());
+    }
+    SECTION("Fill, range and initializer list construction")
+    {
+        std::vector<int> values { 1, 2, 3 };
+
+        shared_list filled(3, 7);
+        shared_list ranged(values.begin(), values.end());
+        shared_list listed { 1, 2, 3 };
+
+        REQUIRE(filled == shared_list { 7, 7, 7 });
+        REQUIRE(ranged == listed);
+        REQUIRE(listed.front() == 1);
+        REQUIRE(listed.back() == 3);
+        REQUIRE(listed.size() == 3);
+    }
+    SECTION("Moving leaves the origin empty")
+    {
+        shared_list origin { 1, 2, 3 };
+        shared_list moved(std::move(origin));
+
+        REQUIRE(origin.empty());
+        REQUIRE(moved == shared_list { 1, 2, 3 });
+    }
+}
+
+TEST_CASE("Copies share their nodes", "[sharedLists], [allocations]")
+{
+    shared_list list { 1, 2, 3, 4, 5 };
+
+    SECTION("Copying allocates and frees nothing")
+    {
+        REQUIRE_NO_ALLOCATIONS(shared_list copy(list));
+        REQUIRE_FREES(shared_list copy(list), 0);
+        REQUIRE_NO_ALLOCATIONS(shared_list copy = list);
+
+        shared_list copy(list);
+        REQUIRE(copy == list);
+        REQUIRE(address(copy, 0) == address(list, 0));
+        REQUIRE(copy.shared());
+        REQUIRE(list.shared());
+    }
+    SECTION("The last list holding the nodes frees them")
+    {
+        shared_list* copy = new shared_list(list);
+        REQUIRE_FREES(list.clear(), 0);
+        REQUIRE(*copy == shared_list { 1, 2, 3, 4, 5 });
+        REQUIRE_FREES(copy->clear(), 5);
+        delete copy;
+    }
+    SECTION("Assigning shares and lets go of the old nodes")
+    {
+        shared_list other { 9, 9 };
+
+        REQUIRE_FREES(other = list, 2);
+        REQUIRE(other == list);
+        REQUIRE_NO_ALLOCATIONS(other = list);
+    }
+}
+
+TEST_CASE("Modifying a list leaves its copies alone", "[sharedLists], [modifiers]")
+{
+    shared_list list { 1, 2, 3, 4, 5 };
+    shared_list snapshot(list);
+
+    SECTION("Pushing and popping the front copies nothing")
+    {
+        REQUIRE_ALLOCATIONS(list.push_front(0), 1);
+        REQUIRE_NO_ALLOCATIONS(list.pop_front());
+        REQUIRE_NO_ALLOCATIONS(list.pop_front());
+        REQUIRE_FREES(list.pop_front(), 0);
+
+        REQUIRE(list == shared_list { 3, 4, 5 });
+        REQUIRE(snapshot == shared_list { 1, 2, 3, 4, 5 });
+        REQUIRE(address(list, 0) == address(snapshot, 2));
+    }
+    SECTION("Changing a position copies the nodes up to it")
+    {
+        shared_list::iterator third = list.find(3);
+
+        REQUIRE_ALLOCATIONS(third = list.replace(third, 30), 3);
+        REQUIRE(*third == 30);
+        REQUIRE(list == shared_list { 1, 2, 30, 4, 5 });
+        REQUIRE(snapshot == shared_list { 1, 2, 3, 4, 5 });
+
+        // The nodes after it stay shared, the copied ones are the list's own
+        REQUIRE(address(list, 3) == address(snapshot, 3));
+        REQUIRE(address(list, 2) != address(snapshot, 2));
+        REQUIRE_NO_ALLOCATIONS(list.replace(list.begin(), 10));
+        REQUIRE(snapshot.front() == 1);
+    }
+    SECTION("Inserting and erasing")
+    {
+        REQUIRE_ALLOCATIONS(list.insert(list.find(2), 8), 3);
+        REQUIRE(list == shared_list { 1, 2, 8, 3, 4, 5 });
+        REQUIRE(address(list, 3) == address(snapshot, 2));
+
+        REQUIRE_NO_ALLOCATIONS(list.erase(list.find(8)));
+        REQUIRE(list == snapshot);
+
+        shared_list::iterator next = list.erase(list.find(4));
+        REQUIRE(*next == 5);
+        REQUIRE(list == shared_list { 1, 2, 3, 5 });
+
+        list.erase(list.begin());
+        REQUIRE(list.front() == 2);
+        REQUIRE(snapshot == shared_list { 1, 2, 3, 4, 5 });
+    }
+    SECTION("The back copies every shared node once")
+    {
+        REQUIRE_ALLOCATIONS(list.push_back(6), 6);
+        REQUIRE_FALSE(list.shared());
+        REQUIRE_ALLOCATIONS(list.push_back(7), 1);
+        REQUIRE_NO_ALLOCATIONS(list.pop_back());
+
+        REQUIRE(list == shared_list { 1, 2, 3, 4, 5, 6 });
+        REQUIRE(list.back() == 6);
+        REQUIRE(snapshot.back() == 5);
+
+        shared_list copy(snapshot);
+        REQUIRE_ALLOCATIONS(copy.pop_back(), 4);
+        REQUIRE(copy == shared_list { 1, 2, 3, 4 });
+        REQUIRE(snapshot == shared_list { 1, 2, 3, 4, 5 });
+    }
+    SECTION("Popping every element of a shared list")
+    {
+        int out = 0;
+        while (!list.empty())
+        {
+            list.pop_back(out);
+        }
+        REQUIRE(out == 1);
+        REQUIRE(snapshot == shared_list { 1, 2, 3, 4, 5 });
+
+        list.push_back(1);
+        REQUIRE(list.pop_front(out) == 1);
+        REQUIRE(snapshot.size() == 5);
+    }
+}
+
+TEST_CASE("Comparing shared lists", "[sharedLists], [comparison]")
+{
+    shared_list list { 1, 2, 3 };
+    shared_list copy(list);
+    shared_list separate { 1, 2, 3 };
+
+    REQUIRE(list == copy);
+    REQUIRE(list == separate);
+
+    copy.push_front(0);
+    REQUIRE(list != copy);
+    copy.pop_front();
+    REQUIRE(list == copy);
+
+    separate.replace(separate.find(3), 4);
+    REQUIRE(list != separate);
+    REQUIRE(shared_list() != list);
+    REQUIRE(shared_list() == shared_list());
+}
+
+TEST_CASE("Shared lists hold values that own memory", "[sharedLists], [modifiers]")
+{
+    SharedLinkedList<std::string> list { std::string(40, 'a'), std::string(40, 'b') };
+    SharedLinkedList<std::string> snapshot(list);
+
+    list.replace(list.begin(), "c");
+    list.push_back(std::string(40, 'd'));
+    list.erase(list.find(std::string(40, 'b')));
+
+    REQUIRE(list == SharedLinkedList<std::string> { "c", std::string(40, 'd') });
+    REQUIRE(snapshot == SharedLinkedList<std::string> { std::string(40, 'a'), std::string(40, 'b') });
+}
+
+TEST_CASE("Snapshots read on other threads", "[sharedLists], [concurrency]")
+{
+    shared_list list;
+    for (int i = 0; i < 1000; ++i)
+    {
+        list.push_back(i);
+    }
+
+    // Every snapshot sums to a known value while the list keeps changing
+    std::vector<std::thread> readers;
+    std::vector<long long> sums(8, 0);
+    std::vector<long long> expected(8, 0);
+
+    for (size_t i = 0; i < sums.size(); ++i)
+    {
+        expected[i] = std::accumulate(list.begin(), list.end(), 0LL);
+
+        shared_list snapshot(list);
+        readers.push_back(std::thread([snapshot, &sums, i]()
+        {
+            for (int pass = 0; pass < 20; ++pass)
+            {
+                sums[i] = std::accumulate(snapshot.begin(), snapshot.end(), 0LL);
+            }
+        }));
+
+        list.push_front(static_cast<int>(i));
+        list.replace(list.find(static_cast<int>(500 + i)), 1);
+        list.erase(list.find(static_cast<int>(900 + i)));
+        list.push_back(static_cast<int>(i));
+        list.pop_front();
+    }
+
+    for (std::thread& reader : readers)
+    {
+        reader.join();
+    }
+    REQUIRE(sums == expected);
+}
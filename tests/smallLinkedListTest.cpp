@@ -0,0 +1,307 @@
+/*
+
+File: smallLinkedListTest.cpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#include <functional>
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "allocationAssertions.hpp"
+#include "catch.hpp"
+#include "smallLinkedList.hpp"
+
+typedef SmallLinkedList<int, 4> small_list;
+
+TEST_CASE("Small lists keep their first nodes inline", "[smallLists], [allocations]")
+{
+    SECTION("Up to N elements nothing is allocated")
+    {
+        REQUIRE_NO_ALLOCATIONS(small_list list);
+        REQUIRE_NO_ALLOCATIONS((small_list { 1, 2, 3, 4 }));
+        REQUIRE_ALLOCATIONS((small_list { 1, 2, 3, 4, 5, 6 }), 2);
+        REQUIRE_FREES((small_list { 1, 2, 3, 4, 5, 6 }), 2);
+    }
+    SECTION("Freed slots are taken again before the heap")
+    {
+        small_list list { 1, 2, 3, 4 };
+
+        REQUIRE_NO_ALLOCATIONS(list.pop_front());
+        REQUIRE_NO_ALLOCATIONS(list.push_back(5));
+
+        small_list::iterator position = list.begin();
+        ++position;
+        REQUIRE_NO_ALLOCATIONS(list.erase(position));
+
+        small_list::const_iterator after = list.cbegin();
+        REQUIRE_NO_ALLOCATIONS(list.insert(after, 9));
+        REQUIRE_ALLOCATIONS(list.push_front(0), 1);
+
+        REQUIRE(list == small_list { 0, 2, 9, 4, 5 });
+    }
+    SECTION("Memory usage counts only the nodes past the inline ones")
+    {
+        small_list list { 1, 2, 3, 4 };
+        REQUIRE(list.memory_usage() == sizeof(small_list));
+
+        list.push_back(5);
+        REQUIRE(list.memory_usage() == sizeof(small_list) + footprint::allocated_size(sizeof(Node<int>)));
+        REQUIRE(small_list::inline_capacity() == 4);
+    }
+}
+
+TEST_CASE("Constructing small lists", "[smallLists], [constructors]")
+{
+    SECTION("Default construction")
+    {
+        small_list list;
+
+        REQUIRE(list.empty());
+        REQUIRE(list.begin() == list.end());
+        REQUIRE(list.size() == 0);
+    }
+    SECTION("Fill, range and initializer list construction")
+    {
+        std::vector<int> values { 1, 2, 3, 4, 5, 6 };
+
+        small_list filled(6, 7);
+        small_list ranged(values.begin(), values.end());
+        small_list listed { 1, 2, 3, 4, 5, 6 };
+
+        REQUIRE(filled == small_list { 7, 7, 7, 7, 7, 7 });
+        REQUIRE(ranged == listed);
+        REQUIRE(listed.front() == 1);
+        REQUIRE(listed.back() == 6);
+    }
+    SECTION("Copies are deep, moves take the values and the heap nodes")
+    {
+        SmallLinkedList<std::string, 2> origin { "a", "b", "c", "d" };
+        SmallLinkedList<std::string, 2> copy(origin);
+
+        copy.front() = "z";
+        REQUIRE(origin.front() == "a");
+
+        SmallLinkedList<std::string, 2> moved(std::move(origin));
+        REQUIRE(origin.empty());
+        REQUIRE(moved == SmallLinkedList<std::string, 2> { "a", "b", "c", "d" });
+        REQUIRE(moved.back() == "d");
+
+        origin = moved;
+        REQUIRE(origin == moved);
+
+        copy = std::move(moved);
+        REQUIRE(moved.empty());
+        REQUIRE(copy == origin);
+
+        moved.push_back("e");
+        REQUIRE(moved.size() == 1);
+    }
+    SECTION("Moving does not allocate")
+    {
+        small_list origin { 1, 2, 3, 4, 5, 6 };
+
+        REQUIRE_NO_ALLOCATIONS(small_list moved(std::move(origin)));
+    }
+    SECTION("Swapping lists")
+    {
+        small_list left { 1, 2, 3, 4, 5 };
+        small_list right { 6 };
+
+        left.swap(right);
+
+        REQUIRE(left == small_list { 6 });
+        REQUIRE(right == small_list { 1, 2, 3, 4, 5 });
+        REQUIRE(right.back() == 5);
+    }
+}
+
+TEST_CASE("Modifying small lists", "[smallLists], [modifiers]")
+{
+    small_list list;
+
+    SECTION("Pushing to and popping from both ends past the inline slots")
+    {
+        for (int i = 0; i < 6; ++i)
+        {
+            list.push_back(i);
+            list.push_front(-i);
+        }
+        REQUIRE(list.size() == 12);
+        REQUIRE(list.front() == -5);
+        REQUIRE(list.back() == 5);
+
+        int out = 0;
+        REQUIRE(list.pop_back(out) == 5);
+        REQUIRE(list.pop_front(out) == -5);
+        while (!list.empty())
+        {
+            list.pop_back();
+        }
+
+        list.pop_front();
+        list.pop_back();
+        list.push_back(4);
+        REQUIRE(list == small_list { 4 });
+    }
+    SECTION("Erasing the last and the only element")
+    {
+        list = small_list { 1, 2 };
+
+        small_list::iterator position = list.begin();
+        ++position;
+        position = list.erase(position);
+        REQUIRE(position == list.end());
+        REQUIRE(list.back() == 1);
+
+        position = list.begin();
+        list.erase(position);
+        REQUIRE(list.empty());
+
+        list.push_back(3);
+        REQUIRE(list.front() == 3);
+        REQUIRE(list.back() == 3);
+    }
+    SECTION("Erasing a range")
+    {
+        list = small_list { 1, 2, 3, 4, 5, 6 };
+
+        small_list::iterator first = list.begin();
+        small_list::iterator last = list.find(5);
+        list.erase(first, last);
+
+        REQUIRE(list == small_list { 5, 6 });
+    }
+    SECTION("Clearing frees everything")
+    {
+        list = small_list { 1, 2, 3, 4, 5, 6 };
+
+        REQUIRE_FREES(list.clear(), 2);
+        REQUIRE(list.empty());
+        REQUIRE_NO_ALLOCATIONS((list.push_back(1), list.push_back(2)));
+    }
+}
+
+TEST_CASE("Small list operations", "[smallLists], [operations]")
+{
+    SECTION("Reverse")
+    {
+        small_list list { 1, 2, 3, 4, 5, 6 };
+        small_list empty;
+
+        list.reverse();
+        empty.reverse();
+
+        REQUIRE(list == small_list { 6, 5, 4, 3, 2, 1 });
+        REQUIRE(list.back() == 1);
+        REQUIRE(empty.empty());
+    }
+    SECTION("Remove and remove_if free inline and heap nodes")
+    {
+        small_list list { 2, 1, 2, 3, 2, 2 };
+
+        list.remove(2);
+        REQUIRE(list == small_list { 1, 3 });
+        REQUIRE(list.back() == 3);
+        REQUIRE(list.memory_usage() == sizeof(small_list));
+
+        list.remove_if([](int value) { return value > 0; });
+        REQUIRE(list.empty());
+        REQUIRE_NO_ALLOCATIONS((small_list { 1, 2, 3, 4 }).swap(list));
+    }
+    SECTION("Find")
+    {
+        small_list list { 1, 2, 3, 4, 5 };
+
+        REQUIRE(*list.find(5) == 5);
+        REQUIRE(list.find(6) == list.end());
+        REQUIRE(*list.find_if([](int value) { return value > 1; }) == 2);
+    }
+    SECTION("Unique keeps the first of each value")
+    {
+        small_list list { 3, 1, 3, 2, 1, 2 };
+
+        list.unique();
+
+        REQUIRE(list == small_list { 3, 1, 2 });
+        REQUIRE(list.back() == 2);
+    }
+    SECTION("A throwing predicate keeps the elements it did not reach")
+    {
+        small_list list { 1, 2, 3, 4, 5, 6 };
+        int calls = 0;
+
+        REQUIRE_THROWS_AS(list.remove_if([&calls](int value)
+        {
+            if (++calls == 4) { throw std::runtime_error("predicate"); }
+            return value % 2 == 0;
+        }), std::runtime_error);
+
+        REQUIRE(list == small_list { 1, 3, 4, 5, 6 });
+        REQUIRE(list.back() == 6);
+
+        list.push_back(7);
+        list.remove_if([](int value) { return value % 2 == 0; });
+        REQUIRE(list == small_list { 1, 3, 5, 7 });
+        REQUIRE(list.back() == 7);
+    }
+    SECTION("A throwing comparator keeps every element")
+    {
+        small_list list { 6, 2, 5, 1, 4, 3 };
+        int calls = 0;
+
+        REQUIRE_THROWS_AS(list.sort([&calls](int lhs, int rhs)
+        {
+            if (++calls == 5) { throw std::runtime_error("compare"); }
+            return lhs < rhs;
+        }), std::runtime_error);
+
+        REQUIRE(list.size() == 6);
+        list.push_back(0);
+        list.sort();
+        REQUIRE(list == small_list { 0, 1, 2, 3, 4, 5, 6 });
+        REQUIRE(list.back() == 6);
+    }
+    SECTION("Sorting is stable")
+    {
+        typedef std::pair<int, int> item;
+        SmallLinkedList<item, 2> list { { 2, 0 }, { 1, 1 }, { 2, 2 }, { 1, 3 }, { 0, 4 } };
+
+        list.sort([](const item& lhs, const item& rhs) { return lhs.first < rhs.first; });
+
+        REQUIRE(list == SmallLinkedList<item, 2> { { 0, 4 }, { 1, 1 }, { 1, 3 }, { 2, 0 }, { 2, 2 } });
+        REQUIRE(list.back() == item(2, 2));
+    }
+    SECTION("Sort matches std::list on random input")
+    {
+        std::mt19937 random(5);
+        for (int n : { 0, 1, 2, 3, 4, 5, 7, 64, 1000 })
+        {
+            std::list<int> expected;
+            small_list list;
+            for (int i = 0; i < n; ++i)
+            {
+                int value = static_cast<int>(random() % 100);
+                expected.push_back(value);
+                list.push_back(value);
+            }
+
+            expected.sort(std::greater<int>());
+            list.sort(std::greater<int>());
+
+            REQUIRE(std::equal(expected.begin(), expected.end(), list.begin()));
+            REQUIRE(list.size() == expected.size());
+        }
+    }
+}
@@ -0,0 +1,290 @@
+/*
+
+File: staticLinkedListTest.cpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#include <functional>
+#include <iterator>
+#include <list>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include "allocationAssertions.hpp"
+#include "catch.hpp"
+#include "staticLinkedList.hpp"
+
+typedef StaticLinkedList<int, 8> static_list;
+
+#if __cplusplus >= 202002L
+
+// Builds, edits and sums a list at compile time
+constexpr int constant_list_sum()
+{
+    StaticLinkedList<int, 8> list { 5, 3, 8, 1 };
+    list.push_front(9);
+    list.sort();
+    list.reverse();
+    list.remove(3);
+    list.pop_back();
+
+    StaticLinkedList<int, 8> copy(list);
+    copy.push_back(7);
+
+    int digits = 0;
+    for (int value : copy)
+    {
+        digits = digits * 10 + value;
+    }
+    return digits;
+}
+
+static_assert(constant_list_sum() == 9857, "StaticLinkedList is usable in constant expressions");
+
+#endif
+
+TEST_CASE("Static lists never allocate", "[staticLists], [allocations]")
+{
+    REQUIRE(sizeof(StaticLinkedList<int, 8>::index_type) == 1);
+    REQUIRE(sizeof(StaticLinkedList<int, 300>::index_type) == 2);
+    REQUIRE(sizeof(StaticLinkedList<char, 70000>::index_type) == 4);
+
+    static_list list;
+
+    REQUIRE_NO_ALLOCATIONS(for (int i = 0; i < 8; ++i) { list.push_back(i); });
+    REQUIRE_NO_ALLOCATIONS(list.sort(std::greater<int>()));
+    REQUIRE_NO_ALLOCATIONS(list.unique());
+    REQUIRE_NO_ALLOCATIONS(static_list copy(list));
+    REQUIRE_NO_ALLOCATIONS(list.clear());
+    REQUIRE(list.memory_usage() == sizeof(static_list));
+}
+
+TEST_CASE("A full static list refuses new elements", "[staticLists], [capacity]")
+{
+    StaticLinkedList<int, 3> list { 1, 2, 3, 4, 5 };
+
+    REQUIRE(list.full());
+    REQUIRE(list.size() == 3);
+    REQUIRE(list.capacity() == 3);
+    REQUIRE(list == StaticLinkedList<int, 3> { 1, 2, 3 });
+
+    StaticLinkedList<int, 3>::const_iterator position = list.cbegin();
+    std::vector<int> values { 7 };
+
+    REQUIRE_FALSE(list.push_back(4));
+    REQUIRE_FALSE(list.push_front(0));
+    REQUIRE_FALSE(list.insert(position, 9));
+    REQUIRE_FALSE(list.insert(position, 1, 9));
+    REQUIRE_FALSE(list.insert(position, values.begin(), values.end()));
+    REQUIRE(list == StaticLinkedList<int, 3> { 1, 2, 3 });
+
+    list.pop_front();
+    REQUIRE_FALSE(list.insert(position, 2, 9));
+    REQUIRE(list.size() == 2);
+    REQUIRE(list.push_back(4));
+    REQUIRE(list == StaticLinkedList<int, 3> { 2, 3, 4 });
+}
+
+TEST_CASE("Constructing static lists", "[staticLists], [constructors]")
+{
+    SECTION("Default construction")
+    {
+        static_list list;
+
+        REQUIRE(list.empty());
+        REQUIRE(list.begin() == list.end());
+        REQUIRE(list.size() == 0);
+    }
+    SECTION("Fill, range and initializer list construction")
+    {
+        std::vector<int> values { 1, 2, 3 };
+
+        static_list filled(3, 7);
+        static_list ranged(values.begin(), values.end());
+        static_list listed { 1, 2, 3 };
+
+        REQUIRE(filled == static_list { 7, 7, 7 });
+        REQUIRE(ranged == listed);
+        REQUIRE(listed.front() == 1);
+        REQUIRE(listed.back() == 3);
+    }
+    SECTION("Copies and moves of values with their own memory")
+    {
+        StaticLinkedList<std::string, 4> origin { "a", "b", "c" };
+        StaticLinkedList<std::string, 4> copy(origin);
+
+        copy.front() = "z";
+        REQUIRE(origin.front() == "a");
+
+        StaticLinkedList<std::string, 4> moved(std::move(origin));
+        REQUIRE(origin.empty());
+        REQUIRE(moved == StaticLinkedList<std::string, 4> { "a", "b", "c" });
+
+        origin = moved;
+        REQUIRE(origin == moved);
+
+        copy = std::move(moved);
+        REQUIRE(moved.empty());
+        REQUIRE(copy == origin);
+
+        copy.swap(moved);
+        REQUIRE(copy.empty());
+        REQUIRE(moved.back() == "c");
+    }
+}
+
+TEST_CASE("Modifying static lists", "[staticLists], [modifiers]")
+{
+    static_list list { 1, 2, 3, 4 };
+
+    SECTION("Popping from both ends reuses the slots")
+    {
+        int out = 0;
+
+        REQUIRE(list.pop_front(out) == 1);
+        REQUIRE(list.pop_back(out) == 4);
+        for (int i = 5; i < 11; ++i)
+        {
+            REQUIRE(list.push_back(i));
+        }
+        REQUIRE(list.full());
+        REQUIRE(list == static_list { 2, 3, 5, 6, 7, 8, 9, 10 });
+
+        while (!list.empty())
+        {
+            list.pop_back();
+        }
+        list.pop_front();
+        list.pop_back();
+        REQUIRE(list.push_front(1));
+        REQUIRE(list.back() == 1);
+    }
+    SECTION("Inserting after a position")
+    {
+        static_list::const_iterator position = list.cbegin();
+        ++position;
+
+        REQUIRE(list.insert(position, 9));
+        REQUIRE(list.insert(position, 2, 8));
+
+        std::vector<int> values { 6 };
+        static_list::const_iterator last = list.cbegin();
+        std::advance(last, 6);
+        REQUIRE(list.insert(last, values.begin(), values.end()));
+
+        REQUIRE(list == static_list { 1, 2, 8, 8, 9, 3, 4, 6 });
+        REQUIRE(list.back() == 6);
+    }
+    SECTION("Inserting into an empty list")
+    {
+        static_list empty;
+        static_list::const_iterator position = empty.cbegin();
+
+        REQUIRE(empty.insert(position, 5));
+        REQUIRE(*position == 5);
+        REQUIRE(empty.insert(position, 2, 6));
+        REQUIRE(empty == static_list { 5, 6, 6 });
+    }
+    SECTION("Erasing the first, the last and a range")
+    {
+        static_list::iterator position = list.begin();
+        position = list.erase(position);
+        REQUIRE(*position == 2);
+
+        position = list.find(4);
+        position = list.erase(position);
+        REQUIRE(position == list.end());
+        REQUIRE(list.back() == 3);
+
+        static_list::iterator first = list.begin();
+        static_list::iterator last = list.end();
+        list.erase(first, last);
+        REQUIRE(list.empty());
+
+        list.push_back(6);
+        REQUIRE(list.front() == 6);
+    }
+}
+
+TEST_CASE("Static list operations", "[staticLists], [operations]")
+{
+    SECTION("Reverse")
+    {
+        static_list list { 1, 2, 3, 4 };
+
+        list.reverse();
+
+        REQUIRE(list == static_list { 4, 3, 2, 1 });
+        REQUIRE(list.back() == 1);
+        REQUIRE(list.push_back(0));
+        REQUIRE(list.back() == 0);
+    }
+    SECTION("Remove and remove_if")
+    {
+        static_list list { 2, 1, 2, 3, 2 };
+
+        list.remove(2);
+        REQUIRE(list == static_list { 1, 3 });
+        REQUIRE(list.back() == 3);
+
+        list.remove_if([](int value) { return value > 0; });
+        REQUIRE(list.empty());
+    }
+    SECTION("Find")
+    {
+        static_list list { 1, 2, 3 };
+
+        REQUIRE(*list.find(2) == 2);
+        REQUIRE(list.find(4) == list.end());
+        REQUIRE(*list.find_if([](int value) { return value > 1; }) == 2);
+    }
+    SECTION("Unique keeps the first of each value")
+    {
+        static_list list { 3, 1, 3, 2, 1, 2 };
+
+        list.unique();
+
+        REQUIRE(list == static_list { 3, 1, 2 });
+        REQUIRE(list.back() == 2);
+    }
+    SECTION("Sorting is stable")
+    {
+        typedef std::pair<int, int> item;
+        StaticLinkedList<item, 5> list { { 2, 0 }, { 1, 1 }, { 2, 2 }, { 1, 3 }, { 0, 4 } };
+
+        list.sort([](const item& lhs, const item& rhs) { return lhs.first < rhs.first; });
+
+        REQUIRE(list == StaticLinkedList<item, 5> { { 0, 4 }, { 1, 1 }, { 1, 3 }, { 2, 0 }, { 2, 2 } });
+        REQUIRE(list.back() == item(2, 2));
+    }
+    SECTION("Sort matches std::list on random input")
+    {
+        std::mt19937 random(7);
+        for (int n : { 0, 1, 2, 3, 7, 64, 1000 })
+        {
+            std::list<int> expected;
+            StaticLinkedList<int, 1000> list;
+            for (int i = 0; i < n; ++i)
+            {
+                int value = static_cast<int>(random() % 100);
+                expected.push_back(value);
+                list.push_back(value);
+            }
+
+            expected.sort();
+            list.sort();
+
+            REQUIRE(std::equal(expected.begin(), expected.end(), list.begin()));
+            REQUIRE(list.size() == expected.size());
+        }
+    }
+}
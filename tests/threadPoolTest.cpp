@@ -0,0 +1,203 @@
+/*
+
+File: threadPoolTest.cpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#include <atomic>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "catch.hpp"
+#include "execution.hpp"
+#include "linkedList.hpp"
+
+TEST_CASE("Using a work stealing deque", "[threadPool], [deque]")
+{
+    SECTION("The owner pops in last in first out order")
+    {
+        WorkStealingDeque<int> deque(2);
+
+        for (int i = 0; i < 10; ++i)
+        {
+            deque.push(i);
+        }
+        REQUIRE(deque.size() == 10);
+
+        int item = -1;
+        for (int i = 9; i >= 0; --i)
+        {
+            REQUIRE(deque.pop(item));
+            REQUIRE(item == i);
+        }
+        REQUIRE_FALSE(deque.pop(item));
+        REQUIRE(deque.empty());
+    }
+    SECTION("Thieves steal in first in first out order")
+    {
+        WorkStealingDeque<int> deque;
+
+        deque.push(1);
+        deque.push(2);
+
+        int item = 0;
+        REQUIRE(deque.steal(item));
+        REQUIRE(item == 1);
+        REQUIRE(deque.pop(item));
+        REQUIRE(item == 2);
+        REQUIRE_FALSE(deque.steal(item));
+    }
+    SECTION("Every item is taken exactly once under concurrent stealing")
+    {
+        const int items = 20000;
+        WorkStealingDeque<int> deque(4);
+        std::atomic<long> stolen_sum(0);
+        std::atomic<bool> done(false);
+
+        std::vector<std::thread> thieves;
+        for (int t = 0; t < 3; ++t)
+        {
+            thieves.emplace_back([&deque, &stolen_sum, &done]()
+            {
+                int item = 0;
+                while (!done.load() || !deque.empty())
+                {
+                    if (deque.steal(item)) { stolen_sum += item; }
+                }
+            });
+        }
+
+        long popped_sum = 0;
+        int item = 0;
+        for (int i = 1; i <= items; ++i)
+        {
+            deque.push(i);
+            if (i % 3 == 0 && deque.pop(item)) { popped_sum += item; }
+        }
+        while (deque.pop(item)) { popped_sum += item; }
+        done.store(true);
+
+        for (auto& thief : thieves)
+        {
+            thief.join();
+        }
+        REQUIRE(popped_sum + stolen_sum == long(items) * (items + 1) / 2);
+    }
+}
+
+TEST_CASE("Scheduling work on a thread pool", "[threadPool]")
+{
+    ThreadPool pool(2);
+
+    SECTION("parallel_for runs every index once")
+    {
+        std::vector<std::atomic<int> > hits(100);
+        for (auto& hit : hits) { hit = 0; }
+
+        pool.parallel_for(hits.size(), [&hits](size_t i) { ++hits[i]; });
+
+        for (auto& hit : hits)
+        {
+            REQUIRE(hit == 1);
+        }
+    }
+    SECTION("parallel_for may be nested inside a task")
+    {
+        std::atomic<int> count(0);
+
+        pool.parallel_for(8, [&pool, &count](size_t)
+        {
+            pool.parallel_for(8, [&count](size_t) { ++count; });
+        });
+
+        REQUIRE(count == 64);
+    }
+    SECTION("An exception thrown by a task reaches the caller")
+    {
+        REQUIRE_THROWS_AS(pool.parallel_for(10, [](size_t i)
+        {
+            if (i == 7) { throw std::runtime_error("task failed"); }
+        }), std::runtime_error);
+    }
+    SECTION("Submitted tasks run before the pool is destroyed")
+    {
+        std::atomic<int> count(0);
+        {
+            ThreadPool local(3);
+            for (int i = 0; i < 50; ++i)
+            {
+                local.submit([&count]() { ++count; });
+            }
+        }
+        REQUIRE(count == 50);
+    }
+    SECTION("Worker statistics count the tasks that workers ran")
+    {
+        pool.reset_stats();
+        pool.parallel_for(200, [](size_t) { std::this_thread::yield(); });
+
+        size_t run = 0;
+        for (const ThreadPool::worker_stats& stats : pool.stats())
+        {
+            run += stats.tasks_run;
+            REQUIRE(stats.idle.count() >= 0);
+        }
+        REQUIRE(pool.stats().size() == 2);
+        REQUIRE(run <= 200);
+
+        pool.reset_stats();
+        REQUIRE(pool.stats()[0].tasks_run == 0);
+    }
+}
+
+// Runs everything on the calling thread and records that it was used
+class InlineExecutor : public Executor
+{
+public:
+
+    InlineExecutor() : calls(0) {}
+
+    size_t size() const override { return 1; }
+
+    void parallel_for(size_t count, const index_task& task) override
+    {
+        ++calls;
+        for (size_t i = 0; i < count; ++i)
+        {
+            task(i);
+        }
+    }
+
+    int calls;
+};
+
+TEST_CASE("Injecting an executor into the parallel algorithms", "[threadPool], [parallel]")
+{
+    LinkedList<int> list(100, 1);
+    InlineExecutor executor;
+
+    SECTION("Through the policy")
+    {
+        REQUIRE(list.reduce(execution::par.on(executor).grain(8), 0, std::plus<int>()) == 100);
+        REQUIRE(executor.calls == 1);
+    }
+    SECTION("As the default executor")
+    {
+        execution::set_default_executor(&executor);
+        list.for_each(execution::par.grain(8), [](int& value) { value = 2; });
+        execution::set_default_executor(nullptr);
+
+        REQUIRE(executor.calls == 1);
+        REQUIRE(list.count_if(execution::par.grain(8), [](int value) { return value == 2; }) == 100);
+        REQUIRE(executor.calls == 1);
+    }
+}
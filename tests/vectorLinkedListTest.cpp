@@ -0,0 +1,343 @@
+/*
+
+File: vectorLinkedListTest.cpp
+
+Copyright (c) 2018 Alexander DuPree
+
+This software is released as open source through the MIT License
+
+Authors: Alexander DuPree, Jacob Bickle
+
+https://github.com/AlexanderJDupree/LinkedListsCPP
+
+*/
+
+#include <functional>
+#include <iterator>
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "allocationAssertions.hpp"
+#include "catch.hpp"
+#include "vectorLinkedList.hpp"
+
+typedef VectorLinkedList<int> vector_list;
+
+TEST_CASE("Vector lists keep their nodes in one array", "[vectorLists], [allocations]")
+{
+    vector_list list;
+
+    REQUIRE(list.capacity() == 0);
+    REQUIRE_NO_ALLOCATIONS(vector_list empty);
+
+    REQUIRE_ALLOCATIONS(list.reserve(100), 1);
+    REQUIRE(list.capacity() == 100);
+    REQUIRE_NO_ALLOCATIONS(for (int i = 0; i < 100; ++i) { list.push_back(i); });
+
+    REQUIRE_ALLOCATIONS(list.push_back(100), 1);
+    REQUIRE(list.capacity() == 200);
+
+    // A copy of trivially copyable values takes one block
+    REQUIRE_ALLOCATIONS(vector_list copy(list), 1);
+
+    list.clear();
+    REQUIRE(list.capacity() == 200);
+    REQUIRE_NO_ALLOCATIONS(for (int i = 0; i < 200; ++i) { list.push_front(i); });
+}
+
+TEST_CASE("Vector list iterators survive growth", "[vectorLists], [iterators]")
+{
+    vector_list list { 1, 2, 3 };
+    vector_list::iterator second = list.begin();
+    ++second;
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        list.push_back(i);
+    }
+
+    REQUIRE(list.capacity() >= 1003);
+    REQUIRE(*second == 2);
+
+    vector_list::const_iterator position = second;
+    list.insert(position, 7);
+    REQUIRE(*++position == 7);
+    REQUIRE(list.size() == 1004);
+}
+
+TEST_CASE("Constructing vector lists", "[vectorLists], [constructors]")
+{
+    SECTION("Default construction")
+    {
+        vector_list list;
+
+        REQUIRE(list.empty());
+        REQUIRE(list.begin() == list.end());
+        REQUIRE(list.size() == 0);
+    }
+    SECTION("Fill, range and initializer list construction")
+    {
+        std::vector<int> values { 1, 2, 3 };
+
+        vector_list filled(3, 7);
+        vector_list ranged(values.begin(), values.end());
+        vector_list listed { 1, 2, 3 };
+
+        REQUIRE(filled == vector_list { 7, 7, 7 });
+        REQUIRE(ranged == listed);
+        REQUIRE(listed.front() == 1);
+        REQUIRE(listed.back() == 3);
+    }
+    SECTION("Copies keep free slots and order")
+    {
+        vector_list origin { 1, 2, 3, 4, 5 };
+        origin.remove(2);
+        origin.reverse();
+
+        vector_list copy(origin);
+        REQUIRE(copy == vector_list { 5, 4, 3, 1 });
+
+        // The free slot left by the removed value is reused in the copy
+        copy.push_back(6);
+        REQUIRE(copy.capacity() == origin.capacity());
+        REQUIRE(copy == vector_list { 5, 4, 3, 1, 6 });
+        REQUIRE(origin == vector_list { 5, 4, 3, 1 });
+
+        vector_list small { 0 };
+        small = copy;
+        REQUIRE(small == copy);
+    }
+    SECTION("Copies and moves of values with their own memory")
+    {
+        VectorLinkedList<std::string> origin { "a", "b", "c" };
+        origin.pop_front();
+        origin.push_back(std::string(40, 'd'));
+
+        VectorLinkedList<std::string> copy(origin);
+        copy.front() = "z";
+        REQUIRE(origin.front() == "b");
+
+        VectorLinkedList<std::string> moved(std::move(origin));
+        REQUIRE(origin.empty());
+        REQUIRE(moved == VectorLinkedList<std::string> { "b", "c", std::string(40, 'd') });
+
+        origin = moved;
+        REQUIRE(origin == moved);
+
+        copy = std::move(moved);
+        REQUIRE(moved.empty());
+        REQUIRE(copy == origin);
+
+        copy.swap(moved);
+        REQUIRE(copy.empty());
+        REQUIRE(moved.back() == std::string(40, 'd'));
+
+        // Growth moves the long strings to the new array
+        for (int i = 0; i < 100; ++i)
+        {
+            moved.push_front(std::string(30, char('a' + i % 26)));
+        }
+        REQUIRE(moved.size() == 103);
+        REQUIRE(moved.back() == std::string(40, 'd'));
+    }
+}
+
+TEST_CASE("Modifying vector lists", "[vectorLists], [modifiers]")
+{
+    vector_list list { 1, 2, 3, 4 };
+
+    SECTION("Popping from both ends reuses the slots")
+    {
+        int out = 0;
+
+        REQUIRE(list.pop_front(out) == 1);
+        REQUIRE(list.pop_back(out) == 4);
+        list.push_back(5);
+        list.push_front(0);
+        REQUIRE(list == vector_list { 0, 2, 3, 5 });
+
+        while (!list.empty())
+        {
+            list.pop_back();
+        }
+        list.pop_front();
+        list.pop_back();
+        list.push_front(1);
+        REQUIRE(list.back() == 1);
+    }
+    SECTION("Pushing an element of the list when the array grows")
+    {
+        VectorLinkedList<long> numbers;
+        VectorLinkedList<std::string> words;
+        for (long i = 1; numbers.size() < numbers.capacity() || numbers.empty(); ++i)
+        {
+            numbers.push_back(i);
+            words.push_back(std::string(32, static_cast<char>('a' + i)));
+        }
+        while (words.size() < words.capacity())
+        {
+            words.push_back("filler");
+        }
+
+        numbers.push_back(numbers.front());
+        words.push_back(words.front());
+        REQUIRE(numbers.back() == 1);
+        REQUIRE(words.back() == std::string(32, 'b'));
+
+        while (numbers.size() < numbers.capacity())
+        {
+            numbers.push_back(0);
+        }
+        numbers.push_front(numbers.back());
+        REQUIRE(numbers.front() == 0);
+        REQUIRE(numbers.size() == numbers.capacity() / 2 + 1);
+    }
+    SECTION("Inserting after a position")
+    {
+        vector_list::const_iterator position = list.cbegin();
+        ++position;
+
+        list.insert(position, 9);
+        list.insert(position, 2, 8);
+
+        std::vector<int> values { 6, 5 };
+        vector_list::const_iterator last = list.cbegin();
+        std::advance(last, 6);
+        list.insert(last, values.begin(), values.end());
+
+        REQUIRE(list == vector_list { 1, 2, 8, 8, 9, 3, 4, 6, 5 });
+        REQUIRE(list.back() == 5);
+    }
+    SECTION("Inserting into an empty list")
+    {
+        vector_list empty;
+        vector_list::const_iterator position = empty.cbegin();
+
+        empty.insert(position, 5);
+        REQUIRE(*position == 5);
+        empty.insert(position, 2, 6);
+        REQUIRE(empty == vector_list { 5, 6, 6 });
+    }
+    SECTION("Erasing the first, the last and a range")
+    {
+        vector_list::iterator position = list.begin();
+        position = list.erase(position);
+        REQUIRE(*position == 2);
+
+        position = list.find(4);
+        position = list.erase(position);
+        REQUIRE(position == list.end());
+        REQUIRE(list.back() == 3);
+
+        vector_list::iterator first = list.begin();
+        vector_list::iterator last = list.end();
+        list.erase(first, last);
+        REQUIRE(list.empty());
+
+        list.push_back(6);
+        REQUIRE(list.front() == 6);
+    }
+}
+
+TEST_CASE("Vector list operations", "[vectorLists], [operations]")
+{
+    SECTION("Reverse")
+    {
+        vector_list list { 1, 2, 3, 4 };
+
+        list.reverse();
+
+        REQUIRE(list == vector_list { 4, 3, 2, 1 });
+        list.push_back(0);
+        REQUIRE(list.back() == 0);
+    }
+    SECTION("Remove and remove_if")
+    {
+        vector_list list { 2, 1, 2, 3, 2 };
+
+        list.remove(2);
+        REQUIRE(list == vector_list { 1, 3 });
+        REQUIRE(list.back() == 3);
+
+        list.remove_if([](int value) { return value > 0; });
+        REQUIRE(list.empty());
+    }
+    SECTION("A throwing predicate keeps the elements it did not reach")
+    {
+        vector_list list { 1, 2, 3, 4, 5, 6 };
+        int calls = 0;
+
+        REQUIRE_THROWS_AS(list.remove_if([&calls](int value)
+        {
+            if (++calls == 4) { throw std::runtime_error("predicate"); }
+            return value % 2 == 0;
+        }), std::runtime_error);
+
+        REQUIRE(list == vector_list { 1, 3, 4, 5, 6 });
+        REQUIRE(list.back() == 6);
+
+        list.push_back(7);
+        list.remove_if([](int value) { return value % 2 == 0; });
+        REQUIRE(list == vector_list { 1, 3, 5, 7 });
+        REQUIRE(list.back() == 7);
+    }
+    SECTION("Find")
+    {
+        vector_list list { 1, 2, 3 };
+
+        REQUIRE(*list.find(2) == 2);
+        REQUIRE(list.find(4) == list.end());
+        REQUIRE(*list.find_if([](int value) { return value > 1; }) == 2);
+    }
+    SECTION("Unique keeps the first of each value")
+    {
+        vector_list list { 3, 1, 3, 2, 1, 2 };
+
+        list.unique();
+
+        REQUIRE(list == vector_list { 3, 1, 2 });
+        REQUIRE(list.back() == 2);
+    }
+    SECTION("Sorting is stable")
+    {
+        typedef std::pair<int, int> item;
+        VectorLinkedList<item> list { { 2, 0 }, { 1, 1 }, { 2, 2 }, { 1, 3 }, { 0, 4 } };
+
+        list.sort([](const item& lhs, const item& rhs) { return lhs.first < rhs.first; });
+
+        REQUIRE(list == VectorLinkedList<item> { { 0, 4 }, { 1, 1 }, { 1, 3 }, { 2, 0 }, { 2, 2 } });
+        REQUIRE(list.back() == item(2, 2));
+    }
+    SECTION("Sort matches std::list on random input")
+    {
+        std::mt19937 random(7);
+        for (int n : { 0, 1, 2, 3, 7, 64, 1000 })
+        {
+            std::list<int> expected;
+            vector_list list;
+            for (int i = 0; i < n; ++i)
+            {
+                int value = static_cast<int>(random() % 100);
+                expected.push_back(value);
+                list.push_back(value);
+            }
+
+            expected.sort(std::greater<int>());
+            list.sort(std::greater<int>());
+
+            REQUIRE(std::equal(expected.begin(), expected.end(), list.begin()));
+            REQUIRE(list.size() == expected.size());
+        }
+    }
+    SECTION("Memory usage counts the array")
+    {
+        vector_list list;
+        REQUIRE(list.memory_usage() == sizeof(vector_list));
+
+        list.reserve(10);
+        REQUIRE(list.memory_usage() == sizeof(vector_list) + footprint::allocated_size(80));
+    }
+}